@@ -44,6 +44,7 @@ SOFTWARE.
 #include "functional.h"
 #include "gcd.h"
 #include "initializer_list.h"
+#include "integral_limits.h"
 #include "invoke.h"
 #include "iterator.h"
 #include "largest.h"
@@ -91,6 +92,24 @@ namespace etl
   template <typename TIterator, typename TCompare>
   ETL_CONSTEXPR14 void insertion_sort(TIterator first, TIterator last, TCompare compare);
 
+  template <typename TIterator>
+  void intro_sort(TIterator first, TIterator last);
+
+  template <typename TIterator, typename TCompare>
+  void intro_sort(TIterator first, TIterator last, TCompare compare);
+
+  template <typename TIterator>
+  void merge_sort(TIterator first, TIterator last);
+
+  template <typename TIterator, typename TCompare>
+  void merge_sort(TIterator first, TIterator last, TCompare compare);
+
+  template <typename TIterator, typename TBufferIterator>
+  void merge_sort(TIterator first, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last);
+
+  template <typename TIterator, typename TBufferIterator, typename TCompare>
+  void merge_sort(TIterator first, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last, TCompare compare);
+
   class algorithm_exception : public etl::exception
   {
   public:
@@ -469,6 +488,80 @@ namespace etl
     return etl::upper_bound(first, last, value, compare());
   }
 
+  //***************************************************************************
+  /// branchless_lower_bound
+  /// A lower_bound for random access iterators where the loop body has no
+  /// data dependent branch, so the compiler can use a conditional move.
+  /// Always makes ceil(log2(N)) + 1 comparisons, which avoids mispredictions
+  /// when searching tables for unpredictable keys.
+  //***************************************************************************
+  template <typename TIterator, typename TValue, typename TCompare>
+  ETL_NODISCARD ETL_CONSTEXPR14 TIterator branchless_lower_bound(TIterator first, TIterator last, const TValue& value, TCompare compare)
+  {
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+    difference_t count = last - first;
+
+    if (count == 0)
+    {
+      return first;
+    }
+
+    while (count > 1)
+    {
+      const difference_t half = count / 2;
+
+      first += compare(first[half], value) ? half : difference_t(0);
+      count -= half;
+    }
+
+    return first + (compare(*first, value) ? 1 : 0);
+  }
+
+  template <typename TIterator, typename TValue>
+  ETL_NODISCARD ETL_CONSTEXPR14 TIterator branchless_lower_bound(TIterator first, TIterator last, const TValue& value)
+  {
+    typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare;
+
+    return etl::branchless_lower_bound(first, last, value, compare());
+  }
+
+  //***************************************************************************
+  /// branchless_upper_bound
+  /// An upper_bound for random access iterators where the loop body has no
+  /// data dependent branch. See branchless_lower_bound.
+  //***************************************************************************
+  template <typename TIterator, typename TValue, typename TCompare>
+  ETL_NODISCARD ETL_CONSTEXPR14 TIterator branchless_upper_bound(TIterator first, TIterator last, const TValue& value, TCompare compare)
+  {
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+    difference_t count = last - first;
+
+    if (count == 0)
+    {
+      return first;
+    }
+
+    while (count > 1)
+    {
+      const difference_t half = count / 2;
+
+      first += compare(value, first[half]) ? difference_t(0) : half;
+      count -= half;
+    }
+
+    return first + (compare(value, *first) ? 0 : 1);
+  }
+
+  template <typename TIterator, typename TValue>
+  ETL_NODISCARD ETL_CONSTEXPR14 TIterator branchless_upper_bound(TIterator first, TIterator last, const TValue& value)
+  {
+    typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare;
+
+    return etl::branchless_upper_bound(first, last, value, compare());
+  }
+
   //***************************************************************************
   // equal_range
   //***************************************************************************
@@ -2187,48 +2280,89 @@ namespace etl
   }
 
 #if ETL_NOT_USING_STL
+  namespace private_algorithm
+  {
+    //*********************************
+    // Random access iterators use intro_sort.
+    template <typename TIterator, typename TCompare>
+    void sort(TIterator first, TIterator last, TCompare compare, etl::true_type /*is_random_access*/)
+    {
+      etl::intro_sort(first, last, compare);
+    }
+
+    //*********************************
+    // Other iterators use shell_sort.
+    template <typename TIterator, typename TCompare>
+    void sort(TIterator first, TIterator last, TCompare compare, etl::false_type /*is_random_access*/)
+    {
+      etl::shell_sort(first, last, compare);
+    }
+
+    //*********************************
+    // Random access iterators use merge_sort.
+    template <typename TIterator, typename TCompare>
+    void stable_sort(TIterator first, TIterator last, TCompare compare, etl::true_type /*is_random_access*/)
+    {
+      etl::merge_sort(first, last, compare);
+    }
+
+    //*********************************
+    // Other iterators use insertion_sort.
+    template <typename TIterator, typename TCompare>
+    void stable_sort(TIterator first, TIterator last, TCompare compare, etl::false_type /*is_random_access*/)
+    {
+      etl::insertion_sort(first, last, compare);
+    }
+  } // namespace private_algorithm
+
   //***************************************************************************
   /// Sorts the elements.
   /// Uses user defined comparison.
+  /// Random access ranges use etl::intro_sort, others use etl::shell_sort.
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator, typename TCompare>
   void sort(TIterator first, TIterator last, TCompare compare)
   {
-    etl::shell_sort(first, last, compare);
+    private_algorithm::sort(first, last, compare, etl::integral_constant<bool, etl::is_random_access_iterator<TIterator>::value>());
   }
 
   //***************************************************************************
   /// Sorts the elements.
+  /// Random access ranges use etl::intro_sort, others use etl::shell_sort.
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator>
   void sort(TIterator first, TIterator last)
   {
-    etl::shell_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+    etl::sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
   }
 
   //***************************************************************************
   /// Sorts the elements.
   /// Stable.
   /// Uses user defined comparison.
+  /// Random access ranges use etl::merge_sort, merging in place, others use
+  /// etl::insertion_sort.
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator, typename TCompare>
   void stable_sort(TIterator first, TIterator last, TCompare compare)
   {
-    etl::insertion_sort(first, last, compare);
+    private_algorithm::stable_sort(first, last, compare, etl::integral_constant<bool, etl::is_random_access_iterator<TIterator>::value>());
   }
 
   //***************************************************************************
   /// Sorts the elements.
   /// Stable.
+  /// Random access ranges use etl::merge_sort, merging in place, others use
+  /// etl::insertion_sort.
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator>
   void stable_sort(TIterator first, TIterator last)
   {
-    etl::insertion_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+    etl::stable_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
   }
 #else
   //***************************************************************************
@@ -2276,6 +2410,33 @@ namespace etl
   }
 #endif
 
+  //***************************************************************************
+  /// Sorts the elements.
+  /// Stable.
+  /// Uses user defined comparison.
+  /// Uses etl::merge_sort with a caller supplied scratch buffer, so never allocates.
+  /// A buffer of half the length of the range gives O(N log N) comparisons.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TBufferIterator, typename TCompare>
+  void stable_sort(TIterator first, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last, TCompare compare)
+  {
+    etl::merge_sort(first, last, buffer_first, buffer_last, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements.
+  /// Stable.
+  /// Uses etl::merge_sort with a caller supplied scratch buffer, so never allocates.
+  /// A buffer of half the length of the range gives O(N log N) comparisons.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TBufferIterator>
+  void stable_sort(TIterator first, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last)
+  {
+    etl::merge_sort(first, last, buffer_first, buffer_last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
   //***************************************************************************
   /// Accumulates values.
   ///\ingroup algorithm
@@ -3325,6 +3486,806 @@ namespace etl
     etl::sort_heap(first, last);
   }
 
+  namespace private_algorithm
+  {
+    //*********************************
+    // Partitions smaller than this are insertion sorted.
+    static ETL_CONSTANT ptrdiff_t Sort_Insertion_Threshold = 24;
+
+    //*********************************
+    // Partitions larger than this use a ninther to choose the pivot.
+    static ETL_CONSTANT ptrdiff_t Sort_Ninther_Threshold = 128;
+
+    //*********************************
+    // The number of element moves allowed before a partial insertion sort gives up.
+    static ETL_CONSTANT ptrdiff_t Sort_Partial_Insertion_Limit = 8;
+
+    //*********************************
+    // Insertion sort for random access iterators, moving rather than rotating.
+    // Stable.
+    template <typename TIterator, typename TCompare>
+    void move_insertion_sort(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+      if (first == last)
+      {
+        return;
+      }
+
+      for (TIterator current = first + 1; current != last; ++current)
+      {
+        TIterator sift   = current;
+        TIterator sift_1 = current - 1;
+
+        if (compare(*sift, *sift_1))
+        {
+          value_type temp(ETL_MOVE(*sift));
+
+          do
+          {
+            *sift-- = ETL_MOVE(*sift_1);
+          } while ((sift != first) && compare(temp, *--sift_1));
+
+          *sift = ETL_MOVE(temp);
+        }
+      }
+    }
+
+    //*********************************
+    // Insertion sort that assumes that *(first - 1) is not greater than any
+    // element in the range, so needs no bounds check.
+    template <typename TIterator, typename TCompare>
+    void unguarded_insertion_sort(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+      if (first == last)
+      {
+        return;
+      }
+
+      for (TIterator current = first + 1; current != last; ++current)
+      {
+        TIterator sift   = current;
+        TIterator sift_1 = current - 1;
+
+        if (compare(*sift, *sift_1))
+        {
+          value_type temp(ETL_MOVE(*sift));
+
+          do
+          {
+            *sift-- = ETL_MOVE(*sift_1);
+          } while (compare(temp, *--sift_1));
+
+          *sift = ETL_MOVE(temp);
+        }
+      }
+    }
+
+    //*********************************
+    // Insertion sort that gives up if more than Sort_Partial_Insertion_Limit
+    // moves are needed. Returns true if the range was sorted.
+    template <typename TIterator, typename TCompare>
+    bool partial_insertion_sort(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+      if (first == last)
+      {
+        return true;
+      }
+
+      ptrdiff_t moves = 0;
+
+      for (TIterator current = first + 1; current != last; ++current)
+      {
+        TIterator sift   = current;
+        TIterator sift_1 = current - 1;
+
+        if (compare(*sift, *sift_1))
+        {
+          value_type temp(ETL_MOVE(*sift));
+
+          do
+          {
+            *sift-- = ETL_MOVE(*sift_1);
+          } while ((sift != first) && compare(temp, *--sift_1));
+
+          *sift = ETL_MOVE(temp);
+          moves += (current - sift);
+        }
+
+        if (moves > Sort_Partial_Insertion_Limit)
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*********************************
+    // Sorts two elements.
+    template <typename TIterator, typename TCompare>
+    void sort2(TIterator a, TIterator b, TCompare compare)
+    {
+      if (compare(*b, *a))
+      {
+        etl::iter_swap(a, b);
+      }
+    }
+
+    //*********************************
+    // Sorts three elements.
+    template <typename TIterator, typename TCompare>
+    void sort3(TIterator a, TIterator b, TIterator c, TCompare compare)
+    {
+      sort2(a, b, compare);
+      sort2(b, c, compare);
+      sort2(a, b, compare);
+    }
+
+    //*********************************
+    // Partitions [first, last) around the pivot at *first.
+    // Elements equal to the pivot go to the right partition.
+    // Returns the position of the pivot and whether the range was already partitioned.
+    template <typename TIterator, typename TCompare>
+    ETL_OR_STD::pair<TIterator, bool> partition_right(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+      value_type pivot(ETL_MOVE(*first));
+
+      TIterator begin = first;
+
+      // The median of three guarantees an element not less than the pivot.
+      while (compare(*++first, pivot))
+      {
+      }
+
+      // If no element was skipped there is no sentinel on the right.
+      if ((first - 1) == begin)
+      {
+        while ((first < last) && !compare(*--last, pivot))
+        {
+        }
+      }
+      else
+      {
+        while (!compare(*--last, pivot))
+        {
+        }
+      }
+
+      const bool already_partitioned = (first >= last);
+
+      while (first < last)
+      {
+        etl::iter_swap(first, last);
+
+        while (compare(*++first, pivot))
+        {
+        }
+
+        while (!compare(*--last, pivot))
+        {
+        }
+      }
+
+      TIterator pivot_position = first - 1;
+      *begin                   = ETL_MOVE(*pivot_position);
+      *pivot_position          = ETL_MOVE(pivot);
+
+      return ETL_OR_STD::pair<TIterator, bool>(pivot_position, already_partitioned);
+    }
+
+    //*********************************
+    // Partitions [first, last) around the pivot at *first.
+    // Elements equal to the pivot go to the left partition.
+    // Used when the pivot equals the element before the range, so the left
+    // partition is all equal and needs no further sorting.
+    template <typename TIterator, typename TCompare>
+    TIterator partition_left(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+      value_type pivot(ETL_MOVE(*first));
+
+      TIterator begin = first;
+      TIterator end   = last;
+
+      while (compare(pivot, *--last))
+      {
+      }
+
+      if ((last + 1) == end)
+      {
+        while ((first < last) && !compare(pivot, *++first))
+        {
+        }
+      }
+      else
+      {
+        while (!compare(pivot, *++first))
+        {
+        }
+      }
+
+      while (first < last)
+      {
+        etl::iter_swap(first, last);
+
+        while (compare(pivot, *--last))
+        {
+        }
+
+        while (!compare(pivot, *++first))
+        {
+        }
+      }
+
+      *begin = ETL_MOVE(*last);
+      *last  = ETL_MOVE(pivot);
+
+      return last;
+    }
+
+    //*********************************
+    // Swaps some elements of an unbalanced partition to break patterns that
+    // would cause repeated bad pivots.
+    template <typename TIterator>
+    void break_patterns(TIterator first, TIterator last)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
+
+      const difference_type size = last - first;
+
+      if (size >= Sort_Insertion_Threshold)
+      {
+        const difference_type quarter = size / 4;
+
+        etl::iter_swap(first, first + quarter);
+        etl::iter_swap(last - 1, last - quarter);
+
+        if (size > Sort_Ninther_Threshold)
+        {
+          etl::iter_swap(first + 1, first + (quarter + 1));
+          etl::iter_swap(first + 2, first + (quarter + 2));
+          etl::iter_swap(last - 2, last - (quarter + 1));
+          etl::iter_swap(last - 3, last - (quarter + 2));
+        }
+      }
+    }
+
+    //*********************************
+    // The pattern defeating quicksort loop.
+    // Recurses in to the smaller partition and loops on the larger, so the
+    // stack depth is O(log N).
+    template <typename TIterator, typename TCompare>
+    void intro_sort_loop(TIterator first, TIterator last, TCompare compare, int bad_allowed, bool leftmost)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
+
+      while (true)
+      {
+        const difference_type size = last - first;
+
+        if (size < Sort_Insertion_Threshold)
+        {
+          if (leftmost)
+          {
+            move_insertion_sort(first, last, compare);
+          }
+          else
+          {
+            unguarded_insertion_sort(first, last, compare);
+          }
+
+          return;
+        }
+
+        // Choose the pivot and move it to *first.
+        const difference_type half = size / 2;
+
+        if (size > Sort_Ninther_Threshold)
+        {
+          sort3(first, first + half, last - 1, compare);
+          sort3(first + 1, first + (half - 1), last - 2, compare);
+          sort3(first + 2, first + (half + 1), last - 3, compare);
+          sort3(first + (half - 1), first + half, first + (half + 1), compare);
+          etl::iter_swap(first, first + half);
+        }
+        else
+        {
+          sort3(first + half, first, last - 1, compare);
+        }
+
+        // If the pivot equals the element before the range then the range
+        // contains many equal elements. Put them all on the left; they need no more sorting.
+        if (!leftmost && !compare(*(first - 1), *first))
+        {
+          first = partition_left(first, last, compare) + 1;
+          continue;
+        }
+
+        ETL_OR_STD::pair<TIterator, bool> result = partition_right(first, last, compare);
+
+        TIterator  pivot_position      = result.first;
+        const bool already_partitioned = result.second;
+
+        const difference_type left_size  = pivot_position - first;
+        const difference_type right_size = last - (pivot_position + 1);
+
+        if ((left_size < (size / 8)) || (right_size < (size / 8)))
+        {
+          // Too many bad pivots; fall back to a guaranteed O(N log N) sort.
+          if (--bad_allowed == 0)
+          {
+            etl::heap_sort(first, last, compare);
+            return;
+          }
+
+          break_patterns(first, pivot_position);
+          break_patterns(pivot_position + 1, last);
+        }
+        else if (already_partitioned && partial_insertion_sort(first, pivot_position, compare)
+                 && partial_insertion_sort(pivot_position + 1, last, compare))
+        {
+          // The range was probably already sorted.
+          return;
+        }
+
+        if (left_size < right_size)
+        {
+          intro_sort_loop(first, pivot_position, compare, bad_allowed, leftmost);
+          first    = pivot_position + 1;
+          leftmost = false;
+        }
+        else
+        {
+          intro_sort_loop(pivot_position + 1, last, compare, bad_allowed, false);
+          last = pivot_position;
+        }
+      }
+    }
+
+    //*********************************
+    // Merges the sorted ranges [first, middle) and [middle, last).
+    // Moves the shorter range to the buffer if it fits, otherwise splits the
+    // merge in to two smaller ones with a rotate.
+    // Stable.
+    template <typename TIterator, typename TBufferIterator, typename TDistance, typename TCompare>
+    void merge_adaptive(TIterator first, TIterator middle, TIterator last, TDistance length1, TDistance length2, TBufferIterator buffer,
+                        TDistance buffer_size, TCompare compare)
+    {
+      if ((length1 == 0) || (length2 == 0))
+      {
+        return;
+      }
+
+      if ((length1 + length2) == 2)
+      {
+        if (compare(*middle, *first))
+        {
+          etl::iter_swap(first, middle);
+        }
+
+        return;
+      }
+
+      if (length1 <= buffer_size)
+      {
+        // Merge forwards from the buffer and the right range.
+        TBufferIterator buffer_end = etl::move(first, middle, buffer);
+
+        while ((buffer != buffer_end) && (middle != last))
+        {
+          if (compare(*middle, *buffer))
+          {
+            *first = ETL_MOVE(*middle);
+            ++middle;
+          }
+          else
+          {
+            *first = ETL_MOVE(*buffer);
+            ++buffer;
+          }
+
+          ++first;
+        }
+
+        etl::move(buffer, buffer_end, first);
+      }
+      else if (length2 <= buffer_size)
+      {
+        // Merge backwards from the left range and the buffer.
+        TBufferIterator buffer_end = etl::move(middle, last, buffer);
+
+        TIterator       left  = middle - 1;
+        TBufferIterator right = buffer_end - 1;
+
+        while (true)
+        {
+          if (compare(*right, *left))
+          {
+            *--last = ETL_MOVE(*left);
+
+            if (left == first)
+            {
+              etl::move_backward(buffer, right + 1, last);
+              return;
+            }
+
+            --left;
+          }
+          else
+          {
+            *--last = ETL_MOVE(*right);
+
+            if (right == buffer)
+            {
+              return;
+            }
+
+            --right;
+          }
+        }
+      }
+      else
+      {
+        TIterator first_cut;
+        TIterator second_cut;
+        TDistance length11;
+        TDistance length22;
+
+        if (length1 > length2)
+        {
+          length11   = length1 / 2;
+          first_cut  = first + length11;
+          second_cut = etl::lower_bound(middle, last, *first_cut, compare);
+          length22   = static_cast<TDistance>(second_cut - middle);
+        }
+        else
+        {
+          length22   = length2 / 2;
+          second_cut = middle + length22;
+          first_cut  = etl::upper_bound(first, middle, *second_cut, compare);
+          length11   = static_cast<TDistance>(first_cut - first);
+        }
+
+        TIterator new_middle = etl::rotate(first_cut, middle, second_cut);
+
+        merge_adaptive(first, first_cut, new_middle, length11, length22, buffer, buffer_size, compare);
+        merge_adaptive(new_middle, second_cut, last, TDistance(length1 - length11), TDistance(length2 - length22), buffer, buffer_size, compare);
+      }
+    }
+
+    //*********************************
+    // Top down merge sort.
+    template <typename TIterator, typename TBufferIterator, typename TDistance, typename TCompare>
+    void merge_sort(TIterator first, TIterator last, TBufferIterator buffer, TDistance buffer_size, TCompare compare)
+    {
+      const TDistance length = static_cast<TDistance>(last - first);
+
+      if (length < Sort_Insertion_Threshold)
+      {
+        move_insertion_sort(first, last, compare);
+        return;
+      }
+
+      const TDistance half   = length / 2;
+      TIterator       middle = first + half;
+
+      merge_sort(first, middle, buffer, buffer_size, compare);
+      merge_sort(middle, last, buffer, buffer_size, compare);
+
+      // Already in order?
+      if (!compare(*middle, *(middle - 1)))
+      {
+        return;
+      }
+
+      merge_adaptive(first, middle, last, half, TDistance(length - half), buffer, buffer_size, compare);
+    }
+  } // namespace private_algorithm
+
+  //***************************************************************************
+  /// Sorts the elements using a pattern defeating introsort.
+  /// Quicksort with median of 3 or ninther pivots, insertion sort for small
+  /// partitions, detection of already sorted and equal element runs, and a
+  /// heap sort fallback, so is O(N log N) in the worst case.
+  /// Not stable. Requires random access iterators. Does not allocate.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void intro_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
+
+    difference_type size = last - first;
+
+    if (size < 2)
+    {
+      return;
+    }
+
+    int log2_size = 0;
+
+    while ((size >>= 1) != 0)
+    {
+      ++log2_size;
+    }
+
+    private_algorithm::intro_sort_loop(first, last, compare, log2_size, true);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using a pattern defeating introsort.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void intro_sort(TIterator first, TIterator last)
+  {
+    etl::intro_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using merge sort, merging in place with rotations.
+  /// O(N log^2 N). Stable. Requires random access iterators. Does not allocate.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void merge_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
+    typedef typename etl::iterator_traits<TIterator>::value_type      value_type;
+
+    private_algorithm::merge_sort(first, last, static_cast<value_type*>(ETL_NULLPTR), difference_type(0), compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using merge sort, merging in place with rotations.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void merge_sort(TIterator first, TIterator last)
+  {
+    etl::merge_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using merge sort, with a caller supplied scratch buffer.
+  /// The buffer must contain assignable objects of the value type of the range.
+  /// With a buffer of at least half the length of the range the sort is
+  /// O(N log N); smaller buffers fall back to in place merging for the larger merges.
+  /// Stable. Requires random access iterators. Does not allocate.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TBufferIterator, typename TCompare>
+  void merge_sort(TIterator first, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last, TCompare compare)
+  {
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
+
+    private_algorithm::merge_sort(first, last, buffer_first, static_cast<difference_type>(buffer_last - buffer_first), compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using merge sort, with a caller supplied scratch buffer.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TBufferIterator>
+  void merge_sort(TIterator first, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last)
+  {
+    etl::merge_sort(first, last, buffer_first, buffer_last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  namespace private_algorithm
+  {
+    //*********************************
+    // Unsigned type with the same bit pattern size as a floating point key.
+    template <size_t Size>
+    struct radix_float_bits;
+
+    template <>
+    struct radix_float_bits<4U>
+    {
+      typedef uint32_t type;
+    };
+
+#if ETL_USING_64BIT_TYPES
+    template <>
+    struct radix_float_bits<8U>
+    {
+      typedef uint64_t type;
+    };
+#endif
+
+    //*********************************
+    // Maps a key to an unsigned value with the same ordering.
+    template <typename TKey, bool Is_Floating_Point = etl::is_floating_point<TKey>::value>
+    struct radix_key;
+
+    //*********************************
+    // Integral keys.
+    // Signed keys have the sign bit flipped.
+    template <typename TKey>
+    struct radix_key<TKey, false>
+    {
+      ETL_STATIC_ASSERT(etl::is_integral<TKey>::value, "radix_sort requires an integral or floating point key");
+
+      typedef typename etl::make_unsigned<TKey>::type type;
+
+      static type encode(TKey key)
+      {
+        type value = static_cast<type>(key);
+
+        if ETL_IF_CONSTEXPR (etl::is_signed<TKey>::value)
+        {
+          value ^= static_cast<type>(type(1U) << (etl::integral_limits<type>::bits - 1U));
+        }
+
+        return value;
+      }
+    };
+
+    //*********************************
+    // Floating point keys.
+    // Negative keys have all bits flipped, positive keys have the sign bit flipped.
+    // -0.0 orders before +0.0. NaNs order after +infinity, or before -infinity if negative.
+    template <typename TKey>
+    struct radix_key<TKey, true>
+    {
+      typedef typename radix_float_bits<sizeof(TKey)>::type type;
+
+      static type encode(TKey key)
+      {
+        type value;
+        memcpy(&value, &key, sizeof(type));
+
+        const type sign_bit = static_cast<type>(type(1U) << (etl::integral_limits<type>::bits - 1U));
+
+        return ((value & sign_bit) != 0U) ? static_cast<type>(~value) : static_cast<type>(value ^ sign_bit);
+      }
+    };
+
+    //*********************************
+    // The default key projection. Returns the element itself.
+    template <typename T>
+    struct radix_identity
+    {
+      const T& operator()(const T& value) const
+      {
+        return value;
+      }
+    };
+
+    //*********************************
+    // One counting sort pass on the byte of the encoded key at 'shift'.
+    // Returns false, without moving anything, if every element has the same byte.
+    template <typename TKeyType, typename TSourceIterator, typename TDestinationIterator, typename TKey>
+    bool radix_pass(TSourceIterator first, TSourceIterator last, TDestinationIterator destination, size_t length, unsigned shift, TKey key)
+    {
+      typedef radix_key<TKeyType> encoder;
+
+      size_t count[256];
+      etl::fill_n(count, 256U, size_t(0U));
+
+      for (TSourceIterator itr = first; itr != last; ++itr)
+      {
+        ++count[static_cast<size_t>((encoder::encode(key(*itr)) >> shift) & 0xFFU)];
+      }
+
+      // All in the same bucket?
+      if (count[static_cast<size_t>((encoder::encode(key(*first)) >> shift) & 0xFFU)] == length)
+      {
+        return false;
+      }
+
+      size_t offset = 0U;
+
+      for (size_t i = 0U; i < 256U; ++i)
+      {
+        const size_t n = count[i];
+        count[i]       = offset;
+        offset += n;
+      }
+
+      for (TSourceIterator itr = first; itr != last; ++itr)
+      {
+        const size_t digit = static_cast<size_t>((encoder::encode(key(*itr)) >> shift) & 0xFFU);
+
+        *(destination + static_cast<typename etl::iterator_traits<TDestinationIterator>::difference_type>(count[digit]++)) = ETL_MOVE(*itr);
+      }
+
+      return true;
+    }
+
+    //*********************************
+    // LSD radix sort, one byte per pass, ping-ponging between the range and the buffer.
+    template <typename TKeyType, typename TIterator, typename TBufferIterator, typename TKey>
+    void radix_sort(TIterator first, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last, TKey key)
+    {
+      typedef typename radix_key<TKeyType>::type encoded_type;
+
+      const size_t length = static_cast<size_t>(etl::distance(first, last));
+
+      if (length < 2U)
+      {
+        return;
+      }
+
+      ETL_ASSERT_OR_RETURN(static_cast<size_t>(etl::distance(buffer_first, buffer_last)) >= length, ETL_ERROR(algorithm_error));
+
+      TBufferIterator buffer_end = buffer_first;
+      etl::advance(buffer_end, length);
+
+      bool in_buffer = false;
+
+      for (unsigned shift = 0U; shift < etl::integral_limits<encoded_type>::bits; shift += 8U)
+      {
+        if (in_buffer)
+        {
+          if (radix_pass<TKeyType>(buffer_first, buffer_end, first, length, shift, key))
+          {
+            in_buffer = false;
+          }
+        }
+        else
+        {
+          if (radix_pass<TKeyType>(first, last, buffer_first, length, shift, key))
+          {
+            in_buffer = true;
+          }
+        }
+      }
+
+      if (in_buffer)
+      {
+        etl::move(buffer_first, buffer_end, first);
+      }
+    }
+  } // namespace private_algorithm
+
+  //***************************************************************************
+  /// Sorts the elements using an LSD radix sort, one byte of the key per pass.
+  /// For integral and floating point value types.
+  /// O(N) for a fixed key size. Passes where every element has the same byte are skipped.
+  /// Stable. Requires random access iterators.
+  /// The caller supplies a scratch buffer of at least the length of the range, so it never allocates.
+  /// Floating point values order -0.0 before +0.0.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TBufferIterator>
+  void radix_sort(TIterator first, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last)
+  {
+    typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+    private_algorithm::radix_sort<value_type>(first, last, buffer_first, buffer_last, private_algorithm::radix_identity<value_type>());
+  }
+
+#if ETL_USING_CPP11
+  //***************************************************************************
+  /// Sorts the elements using an LSD radix sort, one byte of the key per pass.
+  /// The key is projected from each element by 'key' and must be an integral or floating point type.
+  /// The projection is called twice per element per pass, so should be cheap.
+  /// O(N) for a fixed key size. Stable. Requires random access iterators.
+  /// The caller supplies a scratch buffer of at least the length of the range, so it never allocates.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TBufferIterator, typename TKey>
+  void radix_sort(TIterator first, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last, TKey key)
+  {
+    typedef typename etl::decay<decltype(key(*first))>::type key_type;
+
+    private_algorithm::radix_sort<key_type>(first, last, buffer_first, buffer_last, key);
+  }
+#endif
+
   //***************************************************************************
   /// Returns the maximum value.
   //***************************************************************************
@@ -400,7 +400,7 @@ namespace etl
       const uint8_t* pb = reinterpret_cast<const uint8_t*>(aw.data());
       const uint8_t* pe = pb + (SIZE * sizeof(T));
 
-      return etl::private_hash::generic_hash<size_t>(pb, pe);
+      return etl::private_hash::buffer_hash<size_t>(pb, pe);
     }
   };
 #endif
@@ -105,6 +105,77 @@ namespace etl
     }
   };
 
+  namespace private_base64
+  {
+    //*************************************************************************
+    /// Reverse lookup table from a character to its sextet, for a character
+    /// set with C62 and C63 as the 62nd and 63rd characters.
+    /// Characters that are not in the set map to Invalid.
+    //*************************************************************************
+    template <char C62, char C63>
+    struct decoder_table
+    {
+      enum
+      {
+        Invalid    = 0xFF,
+        Plus       = (C62 == '+') ? 62 : ((C63 == '+') ? 63 : Invalid),
+        Comma      = (C62 == ',') ? 62 : ((C63 == ',') ? 63 : Invalid),
+        Minus      = (C62 == '-') ? 62 : ((C63 == '-') ? 63 : Invalid),
+        Slash      = (C62 == '/') ? 62 : ((C63 == '/') ? 63 : Invalid),
+        Underscore = (C62 == '_') ? 62 : ((C63 == '_') ? 63 : Invalid)
+      };
+
+#if !ETL_USING_CPP11
+      static const uint8_t* data()
+      {
+#endif
+      static ETL_CONSTANT uint8_t table[256U] = {
+        Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,
+        Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,
+        Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,
+        Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,
+        Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,
+        Invalid,    Invalid,    Invalid,    Plus,       Comma,      Minus,      Invalid,    Slash,
+        52,         53,         54,         55,         56,         57,         58,         59,
+        60,         61,         Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,
+        Invalid,    0,          1,          2,          3,          4,          5,          6,
+        7,          8,          9,          10,         11,         12,         13,         14,
+        15,         16,         17,         18,         19,         20,         21,         22,
+        23,         24,         25,         Invalid,    Invalid,    Invalid,    Invalid,    Underscore,
+        Invalid,    26,         27,         28,         29,         30,         31,         32,
+        33,         34,         35,         36,         37,         38,         39,         40,
+        41,         42,         43,         44,         45,         46,         47,         48,
+        49,         50,         51,         Invalid,    Invalid,    Invalid,    Invalid,    Invalid,
+        Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,
+        Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,
+        Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,
+        Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,
+        Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,
+        Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,
+        Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,
+        Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,
+        Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,
+        Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,
+        Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,
+        Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,
+        Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,
+        Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,
+        Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,
+        Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid,    Invalid};
+#if ETL_USING_CPP11
+      static ETL_CONSTEXPR14 const uint8_t* data()
+      {
+#endif
+        return table;
+      }
+    };
+
+#if ETL_USING_CPP11
+    template <char C62, char C63>
+    ETL_CONSTANT uint8_t decoder_table<C62, C63>::table[256U];
+#endif
+  } // namespace private_base64
+
   //***************************************************************************
   /// Common Base64 definitions
   //***************************************************************************
@@ -205,6 +276,30 @@ namespace etl
       return "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+,";
     }
 
+    //*************************************************************************
+    // Reverse lookup table for RFC-1421, RFC-2045, RFC-2152 and RFC-4648
+    //*************************************************************************
+    static ETL_CONSTEXPR14 const uint8_t* decoder_table_1()
+    {
+      return private_base64::decoder_table<'+', '/'>::data();
+    }
+
+    //*************************************************************************
+    // Reverse lookup table for RFC-4648-URL
+    //*************************************************************************
+    static ETL_CONSTEXPR14 const uint8_t* decoder_table_2()
+    {
+      return private_base64::decoder_table<'-', '_'>::data();
+    }
+
+    //*************************************************************************
+    // Reverse lookup table for RFC-3501-URL
+    //*************************************************************************
+    static ETL_CONSTEXPR14 const uint8_t* decoder_table_3()
+    {
+      return private_base64::decoder_table<'+', ','>::data();
+    }
+
     const char* encoder_table;
     const bool  use_padding;
   };
@@ -48,6 +48,10 @@ SOFTWARE.
   #include <iterator>
 #endif
 
+#if ETL_USING_BASE64_SSSE3
+  #include <tmmintrin.h>
+#endif
+
 #define ETL_IS_8_BIT_INTEGRAL(Type) \
   (etl::is_integral<typename etl::remove_cv<Type>::type>::value && (etl::integral_limits<typename etl::remove_cv<Type>::type>::bits == 8U))
 
@@ -62,6 +66,13 @@ namespace etl
   //*************************************************************************
   class ibase64_decoder : public base64
   {
+  private:
+
+    enum
+    {
+      Invalid_Sextet = 0xFF
+    };
+
   public:
 
     typedef etl::span<const unsigned char>        span_type;
@@ -105,9 +116,40 @@ namespace etl
     {
       ETL_STATIC_ASSERT(ETL_IS_ITERATOR_TYPE_8_BIT_INTEGRAL(TInputIterator), "Input type must be an 8 bit integral");
 
+      typedef typename etl::iterator_traits<TInputIterator>::value_type value_type;
+
+#if ETL_USING_BASE64_SSSE3
+      if (!etl::is_constant_evaluated())
+      {
+        decode_blocks_ssse3(input_begin, contiguous_length(input_begin, input_end));
+      }
+#endif
+
       while (input_begin != input_end)
       {
-        if (!decode(*input_begin++))
+        if (can_decode_quad())
+        {
+          // Read up to four characters and decode them together.
+          value_type quad[4]  = {0, 0, 0, 0};
+          size_t     length   = 0U;
+
+          while ((length < 4U) && (input_begin != input_end))
+          {
+            quad[length++] = *input_begin++;
+          }
+
+          if ((length != 4U) || !decode_quad(quad))
+          {
+            for (size_t i = 0U; i < length; ++i)
+            {
+              if (!decode(quad[i]))
+              {
+                return false;
+              }
+            }
+          }
+        }
+        else if (!decode(*input_begin++))
         {
           return false;
         }
@@ -124,11 +166,48 @@ namespace etl
     {
       ETL_STATIC_ASSERT(ETL_IS_ITERATOR_TYPE_8_BIT_INTEGRAL(TInputIterator), "Input type must be an 8 bit integral");
 
-      while (input_length-- != 0)
+      typedef typename etl::iterator_traits<TInputIterator>::value_type value_type;
+
+#if ETL_USING_BASE64_SSSE3
+      if (!etl::is_constant_evaluated())
+      {
+        input_length -= decode_blocks_ssse3(input_begin, input_length);
+      }
+#endif
+
+      while (input_length != 0)
       {
-        if (!decode(*input_begin++))
+        if ((input_length >= 4U) && can_decode_quad())
         {
-          return false;
+          // Decode four characters together.
+          value_type quad[4] = {0, 0, 0, 0};
+
+          for (size_t i = 0U; i < 4U; ++i)
+          {
+            quad[i] = *input_begin++;
+          }
+
+          input_length -= 4U;
+
+          if (!decode_quad(quad))
+          {
+            for (size_t i = 0U; i < 4U; ++i)
+            {
+              if (!decode(quad[i]))
+              {
+                return false;
+              }
+            }
+          }
+        }
+        else
+        {
+          --input_length;
+
+          if (!decode(*input_begin++))
+          {
+            return false;
+          }
         }
       }
 
@@ -288,9 +367,10 @@ namespace etl
     //*************************************************************************
     /// Constructor
     //*************************************************************************
-    ETL_CONSTEXPR14 ibase64_decoder(const char* encoder_table_, bool use_padding_, unsigned char* p_output_buffer_, size_t ouput_buffer_max_size_,
-                              callback_type callback_)
+    ETL_CONSTEXPR14 ibase64_decoder(const char* encoder_table_, const uint8_t* decoder_table_, bool use_padding_, unsigned char* p_output_buffer_,
+                                    size_t ouput_buffer_max_size_, callback_type callback_)
       : base64(encoder_table_, use_padding_)
+      , decoder_table(decoder_table_)
       , input_buffer()
       , input_buffer_length(0)
       , p_output_buffer(p_output_buffer_)
@@ -320,12 +400,11 @@ namespace etl
     template <typename T>
     ETL_CONSTEXPR14 uint32_t get_index_from_sextet(T sextet)
     {
-      const char* encoder_table_end = encoder_table + 64;
-      const char* p_sextet          = etl::find(encoder_table, encoder_table_end, static_cast<char>(sextet));
+      const uint32_t index = decoder_table[static_cast<unsigned char>(sextet)];
 
-      if (p_sextet != encoder_table_end)
+      if (index != Invalid_Sextet)
       {
-        return static_cast<uint32_t>(etl::distance(encoder_table, p_sextet));
+        return index;
       }
       else
       {
@@ -334,6 +413,151 @@ namespace etl
       }
     }
 
+    //*************************************************************************
+    /// Can four characters be decoded directly to the output buffer?
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool can_decode_quad() const
+    {
+      return (input_buffer_length == 0U) && !padding_received && ((output_buffer_max_size - output_buffer_length) >= 3U);
+    }
+
+    //*************************************************************************
+    /// Decodes four characters directly to the output buffer.
+    /// Returns false, having done nothing, if any of them is not in the
+    /// character set, so that the caller may decode them one at a time.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 bool decode_quad(const T (&quad)[4])
+    {
+      const uint32_t s0 = decoder_table[static_cast<unsigned char>(quad[0])];
+      const uint32_t s1 = decoder_table[static_cast<unsigned char>(quad[1])];
+      const uint32_t s2 = decoder_table[static_cast<unsigned char>(quad[2])];
+      const uint32_t s3 = decoder_table[static_cast<unsigned char>(quad[3])];
+
+      // Invalid_Sextet is the only value with the top bit set.
+      if (((s0 | s1 | s2 | s3) & 0x80U) != 0U)
+      {
+        return false;
+      }
+
+      const uint32_t sextets = (s0 << 18) | (s1 << 12) | (s2 << 6) | s3;
+
+      p_output_buffer[output_buffer_length++] = static_cast<unsigned char>((sextets >> 16) & 0xFF);
+      p_output_buffer[output_buffer_length++] = static_cast<unsigned char>((sextets >> 8) & 0xFF);
+      p_output_buffer[output_buffer_length++] = static_cast<unsigned char>((sextets >> 0) & 0xFF);
+
+      if (callback.is_valid() && output_buffer_is_full())
+      {
+        callback(span());
+        reset_output_buffer();
+      }
+
+      return true;
+    }
+
+#if ETL_USING_BASE64_SSSE3
+    //*************************************************************************
+    /// The number of characters from a pointer range.
+    //*************************************************************************
+    template <typename T>
+    static size_t contiguous_length(T* first, T* last)
+    {
+      return static_cast<size_t>(last - first);
+    }
+
+    //*************************************************************************
+    /// Other iterators are not decoded with SSSE3.
+    //*************************************************************************
+    template <typename TIterator>
+    static size_t contiguous_length(TIterator, TIterator)
+    {
+      return 0U;
+    }
+
+    //*************************************************************************
+    /// Other iterators are not decoded with SSSE3.
+    //*************************************************************************
+    template <typename TIterator>
+    size_t decode_blocks_ssse3(TIterator&, size_t)
+    {
+      return 0U;
+    }
+
+    //*************************************************************************
+    /// Decodes blocks of 16 characters, 12 octets, directly to the output
+    /// buffer, while there is room for 16 octets.
+    /// Stops at the first block containing padding or invalid data, which is
+    /// left to the scalar decoder.
+    /// As each block leaves room in the output buffer, the callback would not
+    /// have been called for any of them.
+    ///\return The number of characters decoded.
+    //*************************************************************************
+    template <typename T>
+    size_t decode_blocks_ssse3(T*& p_input, size_t input_length)
+    {
+      if ((input_buffer_length != 0U) || padding_received)
+      {
+        return 0U;
+      }
+
+      const __m128i upper_a  = _mm_set1_epi8('A' - 1);
+      const __m128i upper_z  = _mm_set1_epi8('Z' + 1);
+      const __m128i lower_a  = _mm_set1_epi8('a' - 1);
+      const __m128i lower_z  = _mm_set1_epi8('z' + 1);
+      const __m128i digit_0  = _mm_set1_epi8('0' - 1);
+      const __m128i digit_9  = _mm_set1_epi8('9' + 1);
+      const __m128i char_62  = _mm_set1_epi8(encoder_table[62]);
+      const __m128i char_63  = _mm_set1_epi8(encoder_table[63]);
+      const __m128i merge_1  = _mm_set1_epi32(0x01400140);
+      const __m128i merge_2  = _mm_set1_epi32(0x00011000);
+      const __m128i shuffle  = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+      size_t decoded = 0U;
+
+      while (((input_length - decoded) >= 16U) && ((output_buffer_max_size - output_buffer_length) >= 16U))
+      {
+        const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_input));
+
+        // Characters >= 0x80 are negative, so fall in none of the ranges.
+        const __m128i is_upper = _mm_and_si128(_mm_cmpgt_epi8(chars, upper_a), _mm_cmplt_epi8(chars, upper_z));
+        const __m128i is_lower = _mm_and_si128(_mm_cmpgt_epi8(chars, lower_a), _mm_cmplt_epi8(chars, lower_z));
+        const __m128i is_digit = _mm_and_si128(_mm_cmpgt_epi8(chars, digit_0), _mm_cmplt_epi8(chars, digit_9));
+        const __m128i is_62    = _mm_cmpeq_epi8(chars, char_62);
+        const __m128i is_63    = _mm_cmpeq_epi8(chars, char_63);
+
+        const __m128i is_valid = _mm_or_si128(_mm_or_si128(_mm_or_si128(is_upper, is_lower), _mm_or_si128(is_digit, is_62)), is_63);
+
+        if (_mm_movemask_epi8(is_valid) != 0xFFFF)
+        {
+          break;
+        }
+
+        // The offset from each character to its sextet.
+        __m128i offset = _mm_and_si128(is_upper, _mm_set1_epi8(static_cast<char>(0 - 'A')));
+        offset         = _mm_or_si128(offset, _mm_and_si128(is_lower, _mm_set1_epi8(static_cast<char>(26 - 'a'))));
+        offset         = _mm_or_si128(offset, _mm_and_si128(is_digit, _mm_set1_epi8(static_cast<char>(52 - '0'))));
+        offset         = _mm_or_si128(offset, _mm_and_si128(is_62, _mm_set1_epi8(static_cast<char>(62 - encoder_table[62]))));
+        offset         = _mm_or_si128(offset, _mm_and_si128(is_63, _mm_set1_epi8(static_cast<char>(63 - encoder_table[63]))));
+
+        const __m128i sextets = _mm_add_epi8(chars, offset);
+
+        // Merge pairs of sextets into 12 bits, then pairs of those into 24 bits.
+        const __m128i pairs   = _mm_maddubs_epi16(sextets, merge_1);
+        const __m128i triples = _mm_madd_epi16(pairs, merge_2);
+        const __m128i octets  = _mm_shuffle_epi8(triples, shuffle);
+
+        // Writes 16 octets, of which the last 4 are overwritten later.
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p_output_buffer + output_buffer_length), octets);
+
+        output_buffer_length += 12U;
+        p_input              += 16U;
+        decoded              += 16U;
+      }
+
+      return decoded;
+    }
+#endif
+
     //*************************************************************************
     /// Gets the padding character
     //*************************************************************************
@@ -479,6 +703,8 @@ namespace etl
       input_buffer_length = 0;
     }
 
+    const uint8_t* decoder_table;
+
     char   input_buffer[4];
     size_t input_buffer_length;
 
@@ -507,7 +733,7 @@ namespace etl
     /// Base64 RFC-2152 constructor.
     //*************************************************************************
     ETL_CONSTEXPR14 base64_rfc2152_decoder()
-      : ibase64_decoder(etl::base64::character_set_1(), etl::base64::Padding::No_Padding, output_buffer, Buffer_Size, callback_type())
+      : ibase64_decoder(etl::base64::character_set_1(), etl::base64::decoder_table_1(), etl::base64::Padding::No_Padding, output_buffer, Buffer_Size, callback_type())
       , output_buffer()
     {
     }
@@ -516,7 +742,7 @@ namespace etl
     /// Base64 RFC-2152 constructor.
     //*************************************************************************
     ETL_CONSTEXPR14 base64_rfc2152_decoder(callback_type callback_)
-      : ibase64_decoder(etl::base64::character_set_1(), etl::base64::Padding::No_Padding, output_buffer, Buffer_Size, callback_)
+      : ibase64_decoder(etl::base64::character_set_1(), etl::base64::decoder_table_1(), etl::base64::Padding::No_Padding, output_buffer, Buffer_Size, callback_)
       , output_buffer()
     {
     }
@@ -551,7 +777,7 @@ namespace etl
     /// Base64 RFC-3501 constructor.
     //*************************************************************************
     ETL_CONSTEXPR14 base64_rfc3501_decoder()
-      : ibase64_decoder(etl::base64::character_set_3(), etl::base64::Padding::No_Padding, output_buffer, Buffer_Size, callback_type())
+      : ibase64_decoder(etl::base64::character_set_3(), etl::base64::decoder_table_3(), etl::base64::Padding::No_Padding, output_buffer, Buffer_Size, callback_type())
       , output_buffer()
     {
     }
@@ -560,7 +786,7 @@ namespace etl
     /// Base64 RFC-3501 constructor.
     //*************************************************************************
     ETL_CONSTEXPR14 base64_rfc3501_decoder(callback_type callback_)
-      : ibase64_decoder(etl::base64::character_set_3(), etl::base64::Padding::No_Padding, output_buffer, Buffer_Size, callback_)
+      : ibase64_decoder(etl::base64::character_set_3(), etl::base64::decoder_table_3(), etl::base64::Padding::No_Padding, output_buffer, Buffer_Size, callback_)
       , output_buffer()
     {
     }
@@ -595,7 +821,7 @@ namespace etl
     /// Base64 RFC-4648 constructor.
     //*************************************************************************
     ETL_CONSTEXPR14 base64_rfc4648_decoder()
-      : ibase64_decoder(etl::base64::character_set_1(), etl::base64::Padding::No_Padding, output_buffer, Buffer_Size, callback_type())
+      : ibase64_decoder(etl::base64::character_set_1(), etl::base64::decoder_table_1(), etl::base64::Padding::No_Padding, output_buffer, Buffer_Size, callback_type())
       , output_buffer()
     {
     }
@@ -604,7 +830,7 @@ namespace etl
     /// Base64 RFC-4648 constructor.
     //*************************************************************************
     ETL_CONSTEXPR14 base64_rfc4648_decoder(callback_type callback_)
-      : ibase64_decoder(etl::base64::character_set_1(), etl::base64::Padding::No_Padding, output_buffer, Buffer_Size, callback_)
+      : ibase64_decoder(etl::base64::character_set_1(), etl::base64::decoder_table_1(), etl::base64::Padding::No_Padding, output_buffer, Buffer_Size, callback_)
       , output_buffer()
     {
     }
@@ -639,7 +865,7 @@ namespace etl
     /// Base64 RFC-4648-Padding constructor.
     //*************************************************************************
     ETL_CONSTEXPR14 base64_rfc4648_padding_decoder()
-      : ibase64_decoder(etl::base64::character_set_1(), etl::base64::Padding::Use_Padding, output_buffer, Buffer_Size, callback_type())
+      : ibase64_decoder(etl::base64::character_set_1(), etl::base64::decoder_table_1(), etl::base64::Padding::Use_Padding, output_buffer, Buffer_Size, callback_type())
       , output_buffer()
     {
     }
@@ -648,7 +874,7 @@ namespace etl
     /// Base64 RFC-4648-Padding constructor.
     //*************************************************************************
     ETL_CONSTEXPR14 base64_rfc4648_padding_decoder(callback_type callback_)
-      : ibase64_decoder(etl::base64::character_set_1(), etl::base64::Padding::Use_Padding, output_buffer, Buffer_Size, callback_)
+      : ibase64_decoder(etl::base64::character_set_1(), etl::base64::decoder_table_1(), etl::base64::Padding::Use_Padding, output_buffer, Buffer_Size, callback_)
       , output_buffer()
     {
     }
@@ -683,7 +909,7 @@ namespace etl
     /// Base64 RFC-4648-Padding constructor.
     //*************************************************************************
     ETL_CONSTEXPR14 base64_rfc4648_url_decoder()
-      : ibase64_decoder(etl::base64::character_set_2(), etl::base64::Padding::No_Padding, output_buffer, Buffer_Size, callback_type())
+      : ibase64_decoder(etl::base64::character_set_2(), etl::base64::decoder_table_2(), etl::base64::Padding::No_Padding, output_buffer, Buffer_Size, callback_type())
       , output_buffer()
     {
     }
@@ -692,7 +918,7 @@ namespace etl
     /// Base64 RFC-4648-Padding constructor.
     //*************************************************************************
     ETL_CONSTEXPR14 base64_rfc4648_url_decoder(callback_type callback_)
-      : ibase64_decoder(etl::base64::character_set_2(), etl::base64::Padding::No_Padding, output_buffer, Buffer_Size, callback_)
+      : ibase64_decoder(etl::base64::character_set_2(), etl::base64::decoder_table_2(), etl::base64::Padding::No_Padding, output_buffer, Buffer_Size, callback_)
       , output_buffer()
     {
     }
@@ -727,7 +953,7 @@ namespace etl
     /// Base64 RFC-4648-Padding constructor.
     //*************************************************************************
     ETL_CONSTEXPR14 base64_rfc4648_url_padding_decoder()
-      : ibase64_decoder(etl::base64::character_set_2(), etl::base64::Padding::Use_Padding, output_buffer, Buffer_Size, callback_type())
+      : ibase64_decoder(etl::base64::character_set_2(), etl::base64::decoder_table_2(), etl::base64::Padding::Use_Padding, output_buffer, Buffer_Size, callback_type())
       , output_buffer()
     {
     }
@@ -736,7 +962,7 @@ namespace etl
     /// Base64 RFC-4648-Padding constructor.
     //*************************************************************************
     ETL_CONSTEXPR14 base64_rfc4648_url_padding_decoder(callback_type callback_)
-      : ibase64_decoder(etl::base64::character_set_2(), etl::base64::Padding::Use_Padding, output_buffer, Buffer_Size, callback_)
+      : ibase64_decoder(etl::base64::character_set_2(), etl::base64::decoder_table_2(), etl::base64::Padding::Use_Padding, output_buffer, Buffer_Size, callback_)
       , output_buffer()
     {
     }
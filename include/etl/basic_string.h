@@ -62,6 +62,7 @@ SOFTWARE.
   #include <ostream>
 #endif
 
+#include "private/string_search.h"
 #include "private/minmax_push.h"
 
 //*****************************************************************************
@@ -1447,7 +1448,7 @@ namespace etl
     //*********************************************************************
     size_type find(const ibasic_string<T>& str, size_type pos = 0) const
     {
-      return find_impl(str.begin(), str.end(), str.size(), pos);
+      return find_impl(str.data(), str.size(), pos);
     }
 
     //*********************************************************************
@@ -1458,7 +1459,7 @@ namespace etl
     template <typename TOtherTraits>
     size_type find(const etl::basic_string_view<T, TOtherTraits>& view, size_type pos = 0) const
     {
-      return find_impl(view.begin(), view.end(), view.size(), pos);
+      return find_impl(view.data(), view.size(), pos);
     }
 
     //*********************************************************************
@@ -1468,9 +1469,7 @@ namespace etl
     //*********************************************************************
     size_type find(const_pointer s, size_type pos = 0) const
     {
-      size_t sz = etl::strlen(s);
-
-      return find_impl(s, s + sz, sz, pos);
+      return find_impl(s, etl::strlen(s), pos);
     }
 
     //*********************************************************************
@@ -1481,9 +1480,7 @@ namespace etl
     //*********************************************************************
     size_type find(const_pointer s, size_type pos, size_type n) const
     {
-      size_t sz = etl::strlen(s);
-
-      return find_impl(s, s + n, sz, pos);
+      return find_impl(s, n, pos);
     }
 
     //*********************************************************************
@@ -1493,16 +1490,14 @@ namespace etl
     //*********************************************************************
     size_type find(T c, size_type position = 0) const
     {
-      const_iterator i = etl::find(begin() + position, end(), c);
-
-      if (i != end())
-      {
-        return static_cast<size_type>(etl::distance(begin(), i));
-      }
-      else
+      if (position >= size())
       {
         return npos;
       }
+
+      const_pointer p = etl::private_string_search::find_character(cbegin() + position, cend(), c);
+
+      return (p == cend()) ? npos : static_cast<size_type>(p - cbegin());
     }
 
     //*********************************************************************
@@ -2040,21 +2035,14 @@ namespace etl
     //*********************************************************************
     size_type find_first_of(const_pointer s, size_type position, size_type n) const
     {
-      if (position < size())
+      if ((position >= size()) || (n == 0U))
       {
-        for (size_type i = position; i < size(); ++i)
-        {
-          for (size_type j = 0; j < n; ++j)
-          {
-            if (p_buffer[i] == s[j])
-            {
-              return i;
-            }
-          }
-        }
+        return npos;
       }
 
-      return npos;
+      const_pointer p = etl::private_string_search::find_first_in_set(cbegin() + position, cend(), s, s + n, true);
+
+      return (p == cend()) ? npos : static_cast<size_type>(p - cbegin());
     }
 
     //*********************************************************************
@@ -2064,18 +2052,7 @@ namespace etl
     //*********************************************************************
     size_type find_first_of(value_type c, size_type position = 0) const
     {
-      if (position < size())
-      {
-        for (size_type i = position; i < size(); ++i)
-        {
-          if (p_buffer[i] == c)
-          {
-            return i;
-          }
-        }
-      }
-
-      return npos;
+      return find(c, position);
     }
 
     //*********************************************************************
@@ -2122,25 +2099,10 @@ namespace etl
         return npos;
       }
 
-      position = etl::min(position, size() - 1);
-
-      const_reverse_iterator it = rbegin() + static_cast<difference_type>(size() - position - 1);
-
-      while (it != rend())
-      {
-        for (size_type j = 0; j < n; ++j)
-        {
-          if (p_buffer[position] == s[j])
-          {
-            return position;
-          }
-        }
-
-        ++it;
-        --position;
-      }
+      const_pointer last = cbegin() + etl::min(position, size() - 1) + 1;
+      const_pointer p    = etl::private_string_search::find_last_in_set(cbegin(), last, s, s + n, true);
 
-      return npos;
+      return (p == last) ? npos : static_cast<size_type>(p - cbegin());
     }
 
     //*********************************************************************
@@ -2212,28 +2174,14 @@ namespace etl
     //*********************************************************************
     size_type find_first_not_of(const_pointer s, size_type position, size_type n) const
     {
-      if (position < size())
+      if (position >= size())
       {
-        for (size_type i = position; i < size(); ++i)
-        {
-          bool found = false;
-
-          for (size_type j = 0; j < n; ++j)
-          {
-            if (p_buffer[i] == s[j])
-            {
-              found = true;
-            }
-          }
-
-          if (!found)
-          {
-            return i;
-          }
-        }
+        return npos;
       }
 
-      return npos;
+      const_pointer p = etl::private_string_search::find_first_in_set(cbegin() + position, cend(), s, s + n, false);
+
+      return (p == cend()) ? npos : static_cast<size_type>(p - cbegin());
     }
 
     //*********************************************************************
@@ -2301,32 +2249,10 @@ namespace etl
         return npos;
       }
 
-      position = etl::min(position, size() - 1);
-
-      const_reverse_iterator it = rbegin() + static_cast<difference_type>(size() - position - 1);
-
-      while (it != rend())
-      {
-        bool found = false;
-
-        for (size_type j = 0; j < n; ++j)
-        {
-          if (p_buffer[position] == s[j])
-          {
-            found = true;
-          }
-        }
-
-        if (!found)
-        {
-          return position;
-        }
-
-        ++it;
-        --position;
-      }
+      const_pointer last = cbegin() + etl::min(position, size() - 1) + 1;
+      const_pointer p    = etl::private_string_search::find_last_in_set(cbegin(), last, s, s + n, false);
 
-      return npos;
+      return (p == last) ? npos : static_cast<size_type>(p - cbegin());
     }
 
     //*********************************************************************
@@ -2863,23 +2789,22 @@ namespace etl
     //*************************************************************************
     /// Common implementation for 'find'.
     //*************************************************************************
-    template <typename TIterator>
-    size_type find_impl(TIterator first, TIterator last, size_type sz, size_type pos = 0) const
+    size_type find_impl(const_pointer s, size_type sz, size_type pos = 0) const
     {
-      if ((pos + sz) > size())
+      if ((pos > size()) || (sz > (size() - pos)))
       {
         return npos;
       }
 
-      const_iterator iposition = etl::search(begin() + pos, end(), first, last);
+      const_pointer p = etl::private_string_search::find_substring(cbegin() + pos, cend(), s, s + sz);
 
-      if (iposition == end())
+      if ((p == cend()) && (sz != 0U))
       {
         return npos;
       }
       else
       {
-        return static_cast<size_type>(etl::distance(begin(), iposition));
+        return static_cast<size_type>(p - cbegin());
       }
     }
 
@@ -32,13 +32,23 @@ SOFTWARE.
 #define ETL_BLOOM_FILTER_INCLUDED
 
 #include "platform.h"
+#include "algorithm.h"
 #include "binary.h"
 #include "bitset.h"
 #include "log.h"
 #include "parameter_type.h"
 #include "power.h"
+#include "span.h"
+#include "static_assert.h"
 #include "type_traits.h"
 
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_USING_BLOOM_FILTER_AVX2
+  #include <immintrin.h>
+#endif
+
 ///\defgroup bloom_filter bloom_filter
 /// A Bloom filter
 ///\ingroup containers
@@ -56,6 +66,18 @@ namespace etl
         return 0;
       }
     };
+
+    //*************************************************************************
+    /// Hints that the memory at 'p' will be read soon.
+    //*************************************************************************
+    inline void prefetch(const void* p)
+    {
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+      __builtin_prefetch(p);
+#else
+      (void)p;
+#endif
+    }
   } // namespace private_bloom_filter
 
   //***************************************************************************
@@ -183,6 +205,325 @@ namespace etl
     /// The Bloom filter flags.
     etl::bitset<WIDTH> flags;
   };
+
+#if ETL_USING_64BIT_TYPES
+  //***************************************************************************
+  /// A blocked bloom filter.
+  /// Each key maps to one 512 bit block, the size of a typical cache line, and
+  /// sets or tests K bits within it, so an add or lookup touches one line of
+  /// memory whatever the value of K.
+  /// The block and the K bit positions are derived from one 64 bit hash by
+  /// double hashing. The hash result is mixed first, so a 32 bit or
+  /// identity hash may be used, though the full 64 bits give fewer false
+  /// positives in large filters.
+  ///\tparam Desired_Width The desired number of bits in the filter.
+  /// Rounded up to a whole number of blocks.
+  ///\tparam K             The number of bits set for each key.
+  ///\tparam THash         The hash generator class. It must define
+  /// <b>argument_type</b>.
+  ///\ingroup bloom_filter
+  //***************************************************************************
+  template <size_t Desired_Width, size_t K, typename THash>
+  class blocked_bloom_filter
+  {
+  private:
+
+    typedef typename etl::parameter_type<typename THash::argument_type>::type parameter_t;
+
+  public:
+
+    ETL_STATIC_ASSERT(K > 0U, "K must be at least 1");
+
+    typedef typename THash::argument_type key_type;
+
+    enum
+    {
+      BLOCK_BITS  = 512,
+      BLOCK_WORDS = BLOCK_BITS / 64,
+      BLOCKS      = (Desired_Width + BLOCK_BITS - 1) / BLOCK_BITS,
+      WIDTH       = BLOCKS * BLOCK_BITS
+    };
+
+    ETL_STATIC_ASSERT(BLOCKS > 0U, "Desired_Width must be at least 1");
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    blocked_bloom_filter()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Clears the bloom filter of all entries.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < BLOCKS; ++i)
+      {
+        for (size_t j = 0U; j < BLOCK_WORDS; ++j)
+        {
+          blocks[i].word[j] = 0U;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a key to the filter.
+    ///\param key The key to add.
+    //*************************************************************************
+    void add(parameter_t key)
+    {
+      const uint64_t hash = get_hash(key);
+
+      block_type& block = blocks[get_block(hash)];
+
+      uint32_t       h    = get_h1(hash);
+      const uint32_t step = get_h2(hash);
+      size_t         word = get_first_word(hash);
+
+      for (size_t i = 0U; i < K; ++i)
+      {
+        block.word[word] |= get_bit(h);
+        h += step;
+        word = (word + 1U) % BLOCK_WORDS;
+      }
+    }
+
+    //*************************************************************************
+    /// Tests a key to see if it exists in the filter.
+    ///\param  key The key to test.
+    ///\return <b>true</b> if the key may exist in the filter.
+    //*************************************************************************
+    bool exists(parameter_t key) const
+    {
+      const uint64_t hash = get_hash(key);
+
+      return contains(blocks[get_block(hash)], hash);
+    }
+
+    //*************************************************************************
+    /// Tests a range of keys.
+    /// The keys are hashed in groups and the blocks for each group are
+    /// prefetched before they are tested, so that the cache misses overlap.
+    /// Processes the smaller of the two sizes.
+    ///\param keys    The keys to test.
+    ///\param results Set to <b>true</b> for each key that may exist.
+    ///\return The number of keys that may exist.
+    //*************************************************************************
+    size_t exists(etl::span<const key_type> keys, etl::span<bool> results) const
+    {
+      const size_t size  = etl::min(keys.size(), results.size());
+      size_t       count = 0U;
+
+      uint64_t          hashes[Group_Size];
+      const block_type* group[Group_Size];
+
+      for (size_t first = 0U; first < size; first += Group_Size)
+      {
+        const size_t length = etl::min(size_t(Group_Size), size - first);
+
+        for (size_t i = 0U; i < length; ++i)
+        {
+          hashes[i] = get_hash(keys[first + i]);
+          group[i]  = &blocks[get_block(hashes[i])];
+          private_bloom_filter::prefetch(group[i]);
+        }
+
+        for (size_t i = 0U; i < length; ++i)
+        {
+          const bool result = contains(*group[i], hashes[i]);
+
+          results[first + i] = result;
+          count += result ? 1U : 0U;
+        }
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Returns the width of the Bloom filter.
+    //*************************************************************************
+    size_t width() const
+    {
+      return WIDTH;
+    }
+
+    //*************************************************************************
+    /// Returns the percentage of usage. Range 0 to 100.
+    //*************************************************************************
+    size_t usage() const
+    {
+      return (100 * count()) / WIDTH;
+    }
+
+    //*************************************************************************
+    /// Returns the number of filter flags set.
+    //*************************************************************************
+    size_t count() const
+    {
+      size_t n = 0U;
+
+      for (size_t i = 0U; i < BLOCKS; ++i)
+      {
+        for (size_t j = 0U; j < BLOCK_WORDS; ++j)
+        {
+          n += etl::count_bits(blocks[i].word[j]);
+        }
+      }
+
+      return n;
+    }
+
+  private:
+
+    /// The number of keys hashed before their blocks are tested.
+    static ETL_CONSTANT size_t Group_Size = 16U;
+
+    //*************************************************************************
+    /// One block of flags.
+    //*************************************************************************
+#if ETL_USING_CPP11
+    struct alignas(BLOCK_BITS / 8) block_type
+#else
+    struct block_type
+#endif
+    {
+      uint64_t word[BLOCK_WORDS];
+    };
+
+    //*************************************************************************
+    /// Gets the mixed hash for the key.
+    //*************************************************************************
+    static uint64_t get_hash(parameter_t key)
+    {
+      uint64_t hash = static_cast<uint64_t>(THash()(key));
+
+      // The MurmurHash3 finaliser.
+      hash ^= hash >> 33U;
+      hash *= UINT64_C(0xFF51AFD7ED558CCD);
+      hash ^= hash >> 33U;
+      hash *= UINT64_C(0xC4CEB9FE1A85EC53);
+      hash ^= hash >> 33U;
+
+      return hash;
+    }
+
+    //*************************************************************************
+    /// Gets the block index from the upper half of the hash.
+    /// Multiplies rather than divides to map it to the number of blocks.
+    //*************************************************************************
+    static size_t get_block(uint64_t hash)
+    {
+      return static_cast<size_t>(((hash >> 32U) * uint64_t(BLOCKS)) >> 32U);
+    }
+
+    //*************************************************************************
+    /// The K bits of a key are spread over consecutive words of the block,
+    /// starting at the word selected by the low bits of the hash, so that
+    /// each word holds at most one of them when K is 8 or less.
+    /// The bit within the word for bit i is the top 6 bits of h1 + (i * h2),
+    /// where h1 is the lower half of the hash and h2 an odd value from the
+    /// upper half. The upper half is rotated so that keys in the same block
+    /// do not share the same step.
+    //*************************************************************************
+    static uint32_t get_h1(uint64_t hash)
+    {
+      return static_cast<uint32_t>(hash);
+    }
+
+    //*************************************************************************
+    static uint32_t get_h2(uint64_t hash)
+    {
+      return etl::rotate_left(static_cast<uint32_t>(hash >> 32U), 16) | 1U;
+    }
+
+    //*************************************************************************
+    static size_t get_first_word(uint64_t hash)
+    {
+      return static_cast<size_t>(hash % BLOCK_WORDS);
+    }
+
+    //*************************************************************************
+    static uint64_t get_bit(uint32_t h)
+    {
+      return uint64_t(1U) << (h >> 26U);
+    }
+
+    //*************************************************************************
+    /// Are all of the bits for the hash set in the block?
+    //*************************************************************************
+    static bool contains(const block_type& block, uint64_t hash)
+    {
+#if ETL_USING_BLOOM_FILTER_AVX2
+      return contains_avx2(block, hash);
+#else
+
+      uint32_t       h       = get_h1(hash);
+      const uint32_t step    = get_h2(hash);
+      size_t         word    = get_first_word(hash);
+      uint64_t       missing = 0U;
+
+      // Testing every bit, rather than returning at the first clear one,
+      // avoids a mispredicted branch for most keys that are not present.
+      for (size_t i = 0U; i < K; ++i)
+      {
+        missing |= get_bit(h) & ~block.word[word];
+        h += step;
+        word = (word + 1U) % BLOCK_WORDS;
+      }
+
+      return missing == 0U;
+#endif
+    }
+
+#if ETL_USING_BLOOM_FILTER_AVX2
+    //*************************************************************************
+    /// Builds the mask for all eight words at once, eight bits per round,
+    /// and tests it against the block.
+    //*************************************************************************
+    static bool contains_avx2(const block_type& block, uint64_t hash)
+    {
+      const __m256i step  = _mm256_set1_epi32(static_cast<int>(get_h2(hash)));
+      const __m256i words = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+      const __m256i ones  = _mm256_set1_epi64x(1);
+
+      // The bit number i held by each word in the first round.
+      const __m256i index = _mm256_and_si256(_mm256_sub_epi32(words, _mm256_set1_epi32(static_cast<int>(get_first_word(hash)))), _mm256_set1_epi32(7));
+
+      __m256i h       = _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(get_h1(hash))), _mm256_mullo_epi32(index, step));
+      __m256i mask_lo = _mm256_setzero_si256();
+      __m256i mask_hi = _mm256_setzero_si256();
+
+      for (size_t round = 0U; round < K; round += BLOCK_WORDS)
+      {
+        const __m256i enabled = _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int>(K - round)), index);
+        const __m256i shift   = _mm256_srli_epi32(h, 26);
+
+        const __m256i bits_lo = _mm256_sllv_epi64(ones, _mm256_cvtepu32_epi64(_mm256_castsi256_si128(shift)));
+        const __m256i bits_hi = _mm256_sllv_epi64(ones, _mm256_cvtepu32_epi64(_mm256_extracti128_si256(shift, 1)));
+
+        mask_lo = _mm256_or_si256(mask_lo, _mm256_and_si256(bits_lo, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(enabled))));
+        mask_hi = _mm256_or_si256(mask_hi, _mm256_and_si256(bits_hi, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(enabled, 1))));
+
+        h = _mm256_add_epi32(h, _mm256_slli_epi32(step, 3));
+      }
+
+      const __m256i* b = reinterpret_cast<const __m256i*>(block.word);
+
+      // testc is set when the bits of the mask are a subset of the block.
+      return (_mm256_testc_si256(_mm256_loadu_si256(b), mask_lo) != 0) && (_mm256_testc_si256(_mm256_loadu_si256(b + 1), mask_hi) != 0);
+    }
+#endif
+
+    /// The Bloom filter blocks.
+    block_type blocks[BLOCKS];
+  };
+
+  template <size_t Desired_Width, size_t K, typename THash>
+  ETL_CONSTANT size_t blocked_bloom_filter<Desired_Width, K, THash>::Group_Size;
+#endif
 } // namespace etl
 
 #endif
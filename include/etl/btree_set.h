@@ -0,0 +1,492 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BTREE_SET_INCLUDED
+#define ETL_BTREE_SET_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "functional.h"
+#include "initializer_list.h"
+#include "iterator.h"
+#include "nth_type.h"
+#include "pool.h"
+#include "type_traits.h"
+#include "utility.h"
+
+#include "private/btree_base.h"
+
+//*****************************************************************************
+///\defgroup btree_set btree_set
+/// A set implemented as a B+tree, with the capacity defined at compile time.
+/// Unlike etl::set, which allocates a tree node per element, the elements
+/// are held in leaves of several cache lines, so a lookup touches a few
+/// nodes and iteration walks the elements in order through linked leaves.
+/// Has insertion, erasure and find of O(logN).
+/// Insertion and erasure invalidate iterators.
+/// Duplicate entries are not allowed.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for specifically sized btree_sets.
+  /// Can be used as a reference type for all btree_sets containing a
+  /// specific type.
+  ///\ingroup btree_set
+  //***************************************************************************
+  template <typename T, typename TKeyCompare = etl::less<T> >
+  class ibtree_set
+    : public etl::ibtree_base<T, T, TKeyCompare, etl::private_btree::key_of_value<T> >
+  {
+  private:
+
+    typedef etl::ibtree_base<T, T, TKeyCompare, etl::private_btree::key_of_value<T> > base_t;
+
+  public:
+
+    typedef typename base_t::value_type      value_type;
+    typedef typename base_t::key_type        key_type;
+    typedef typename base_t::key_compare     key_compare;
+    typedef key_compare                      value_compare;
+    typedef typename base_t::reference       reference;
+    typedef typename base_t::const_reference const_reference;
+#if ETL_USING_CPP11
+    typedef typename base_t::rvalue_reference rvalue_reference;
+#endif
+    typedef typename base_t::pointer         pointer;
+    typedef typename base_t::const_pointer   const_pointer;
+    typedef typename base_t::size_type       size_type;
+    typedef typename base_t::iterator        iterator;
+    typedef typename base_t::const_iterator  const_iterator;
+    typedef typename base_t::difference_type difference_type;
+
+    using base_t::capacity;
+    using base_t::clear;
+    using base_t::end;
+    using base_t::lower_bound;
+
+    //*********************************************************************
+    /// Assigns values to the btree_set.
+    /// If asserts or exceptions are enabled, emits btree_full if
+    /// the btree_set does not have enough free space.
+    /// Sorted input is appended without searching or moving elements.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+#if ETL_IS_DEBUG_BUILD
+      difference_type d = etl::distance(first, last);
+      ETL_ASSERT(d <= difference_type(capacity()), ETL_ERROR(btree_full));
+#endif
+
+      clear();
+
+      while (first != last)
+      {
+        insert(end(), *first);
+        ++first;
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the btree_set.
+    /// If asserts or exceptions are enabled, emits btree_full if
+    /// the btree_set is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference value)
+    {
+      return insert_at(lower_bound(value), value);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Moves a value to the btree_set.
+    /// If asserts or exceptions are enabled, emits btree_full if
+    /// the btree_set is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference value)
+    {
+      iterator i_element = lower_bound(value);
+
+      return insert_at(i_element, etl::move(value));
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the btree_set.
+    /// If 'position' is where the value belongs then no search is made.
+    /// If asserts or exceptions are enabled, emits btree_full if
+    /// the btree_set is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator position, const_reference value)
+    {
+      return insert_at(this->lower_bound_from_hint(position, value), value).first;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Moves a value to the btree_set.
+    /// If 'position' is where the value belongs then no search is made.
+    /// If asserts or exceptions are enabled, emits btree_full if
+    /// the btree_set is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator position, rvalue_reference value)
+    {
+      iterator i_element = this->lower_bound_from_hint(position, value);
+
+      return insert_at(i_element, etl::move(value)).first;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the btree_set.
+    /// If asserts or exceptions are enabled, emits btree_full if
+    /// the btree_set does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the set.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> emplace(const_reference value)
+    {
+      return insert(value);
+    }
+
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT
+    //*************************************************************************
+    /// Emplaces a value to the set.
+    /// The value is constructed first, as its key is the value.
+    //*************************************************************************
+    template <typename... Args>
+    ETL_OR_STD::pair<iterator, bool> emplace(Args&&... args)
+    {
+      return insert(value_type(etl::forward<Args>(args)...));
+    }
+#else
+    //*************************************************************************
+    /// Emplaces a value to the set.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> emplace()
+    {
+      return insert(value_type());
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the set.
+    //*************************************************************************
+    template <typename T1>
+    ETL_OR_STD::pair<iterator, bool> emplace(const T1& value1)
+    {
+      return insert(value_type(value1));
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the set.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    ETL_OR_STD::pair<iterator, bool> emplace(const T1& value1, const T2& value2)
+    {
+      return insert(value_type(value1, value2));
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the set.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    ETL_OR_STD::pair<iterator, bool> emplace(const T1& value1, const T2& value2, const T3& value3)
+    {
+      return insert(value_type(value1, value2, value3));
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the set.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    ETL_OR_STD::pair<iterator, bool> emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      return insert(value_type(value1, value2, value3, value4));
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets the value comparison function.
+    //*************************************************************************
+    value_compare value_comp() const
+    {
+      return this->key_comp();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    ibtree_set& operator=(const ibtree_set& rhs)
+    {
+      this->copy_container(rhs);
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    ibtree_set& operator=(ibtree_set&& rhs)
+    {
+      this->move_container(etl::move(rhs));
+
+      return *this;
+    }
+#endif
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    ibtree_set(etl::ipool& leaf_pool_, etl::ipool& inner_pool_, size_type max_size_)
+      : base_t(leaf_pool_, inner_pool_, max_size_)
+    {
+    }
+
+  private:
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename TValueType>
+    ETL_OR_STD::pair<iterator, bool> insert_at(iterator i_element, TValueType&& value)
+    {
+      if (this->is_match(i_element, value))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(i_element, false);
+      }
+
+      this->insert_value(i_element, value_type(etl::forward<TValueType>(value)));
+
+      return ETL_OR_STD::pair<iterator, bool>(i_element, true);
+    }
+#else
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert_at(iterator i_element, const_reference value)
+    {
+      if (this->is_match(i_element, value))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(i_element, false);
+      }
+
+      this->insert_value(i_element, value_type(value));
+
+      return ETL_OR_STD::pair<iterator, bool>(i_element, true);
+    }
+#endif
+
+    // Disable copy construction.
+    ibtree_set(const ibtree_set&);
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first btree_set.
+  ///\param rhs Reference to the second btree_set.
+  ///\return <b>true</b> if the arrays are equal, otherwise <b>false</b>
+  ///\ingroup btree_set
+  //***************************************************************************
+  template <typename T, typename TKeyCompare>
+  bool operator==(const etl::ibtree_set<T, TKeyCompare>& lhs, const etl::ibtree_set<T, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first btree_set.
+  ///\param rhs Reference to the second btree_set.
+  ///\return <b>true</b> if the arrays are not equal, otherwise <b>false</b>
+  ///\ingroup btree_set
+  //***************************************************************************
+  template <typename T, typename TKeyCompare>
+  bool operator!=(const etl::ibtree_set<T, TKeyCompare>& lhs, const etl::ibtree_set<T, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// A btree_set implementation that uses fixed size pools.
+  ///\tparam T         The value type.
+  ///\tparam MAX_SIZE_ The maximum number of elements that can be stored.
+  ///\tparam TCompare  The type to compare keys. Default = etl::less<T>
+  ///\ingroup btree_set
+  //***************************************************************************
+  template <typename T, const size_t MAX_SIZE_, typename TCompare = etl::less<T> >
+  class btree_set : public etl::ibtree_set<T, TCompare>
+  {
+  private:
+
+    typedef etl::ibtree_set<T, TCompare> base_t;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    btree_set()
+      : base_t(leaf_pool, inner_pool, MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    btree_set(const btree_set& other)
+      : base_t(leaf_pool, inner_pool, MAX_SIZE)
+    {
+      this->copy_container(other);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    btree_set(btree_set&& other)
+      : base_t(leaf_pool, inner_pool, MAX_SIZE)
+    {
+      this->move_container(etl::move(other));
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    btree_set(TIterator first, TIterator last)
+      : base_t(leaf_pool, inner_pool, MAX_SIZE)
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    btree_set(std::initializer_list<T> init)
+      : base_t(leaf_pool, inner_pool, MAX_SIZE)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~btree_set()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    btree_set& operator=(const btree_set& rhs)
+    {
+      this->copy_container(rhs);
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    btree_set& operator=(btree_set&& rhs)
+    {
+      this->move_container(etl::move(rhs));
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    typedef etl::private_btree::pool_sizes<T, T, MAX_SIZE_> pool_sizes_t;
+
+    /// The leaves and inner nodes.
+    etl::pool<typename base_t::leaf_node, pool_sizes_t::LEAF_NODES>   leaf_pool;
+    etl::pool<typename base_t::inner_node, pool_sizes_t::INNER_NODES> inner_pool;
+  };
+
+  template <typename T, const size_t MAX_SIZE_, typename TCompare>
+  ETL_CONSTANT size_t btree_set<T, MAX_SIZE_, TCompare>::MAX_SIZE;
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if ETL_USING_CPP17 && ETL_HAS_INITIALIZER_LIST
+  template <typename... T>
+  btree_set(T...) -> btree_set<etl::nth_type_t<0, T...>, sizeof...(T)>;
+#endif
+
+  //*************************************************************************
+  /// Make
+  //*************************************************************************
+#if ETL_USING_CPP11 && ETL_HAS_INITIALIZER_LIST
+  template <typename TKey, typename TKeyCompare = etl::less<TKey>, typename... T>
+  constexpr auto make_btree_set(T&&... keys) -> etl::btree_set<TKey, sizeof...(T), TKeyCompare>
+  {
+    return {etl::forward<T>(keys)...};
+  }
+#endif
+} // namespace etl
+
+#endif
@@ -0,0 +1,556 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CALLBACK_TIMER_WHEEL_LOCKED_INCLUDED
+#define ETL_CALLBACK_TIMER_WHEEL_LOCKED_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "delegate.h"
+#include "error_handler.h"
+#include "nullptr.h"
+#include "placement_new.h"
+#include "static_assert.h"
+#include "timer.h"
+#include "private/timer_wheel.h"
+
+#include <stdint.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// Interface for callback timer using a hierarchical timer wheel.
+  /// Has the same API as etl::icallback_timer_locked, but start, stop and
+  /// the processing of each expiry in tick are O(1) in the number of active
+  /// timers, rather than O(N).
+  //***************************************************************************
+  class icallback_timer_wheel_locked
+  {
+  public:
+
+    typedef etl::delegate<void(void)> callback_type;
+    typedef etl::delegate<bool(void)> try_lock_type;
+    typedef etl::delegate<void(void)> lock_type;
+    typedef etl::delegate<void(void)> unlock_type;
+
+    typedef etl::delegate<void(etl::timer::id::type)> event_callback_type;
+
+    //*******************************************
+    /// Register a timer.
+    //*******************************************
+    etl::timer::id::type register_timer(const callback_type& callback_, uint32_t period_, bool repeating_)
+    {
+      etl::timer::id::type id = etl::timer::id::NO_TIMER;
+
+      bool is_space = (number_of_registered_timers < Max_Timers);
+
+      if (is_space)
+      {
+        // Search for the free space.
+        for (uint_least8_t i = 0U; i < Max_Timers; ++i)
+        {
+          timer_data& timer = timer_array[i];
+
+          if (timer.id == etl::timer::id::NO_TIMER)
+          {
+            // Create in-place.
+            new (&timer) timer_data(i, callback_, period_, repeating_);
+            ++number_of_registered_timers;
+            id = i;
+            break;
+          }
+        }
+      }
+
+      return id;
+    }
+
+    //*******************************************
+    /// Unregister a timer.
+    //*******************************************
+    bool unregister_timer(etl::timer::id::type id_)
+    {
+      bool result = false;
+
+      if (id_ != etl::timer::id::NO_TIMER)
+      {
+        timer_data& timer = timer_array[id_];
+
+        if (timer.id != etl::timer::id::NO_TIMER)
+        {
+          if (timer.is_active())
+          {
+            lock();
+            active_wheel.remove(timer.id);
+            remove_callback.call_if(timer.id);
+            unlock();
+          }
+
+          // Reset in-place.
+          new (&timer) timer_data();
+          --number_of_registered_timers;
+
+          result = true;
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Enable/disable the timer.
+    //*******************************************
+    void enable(bool state_)
+    {
+      enabled = state_;
+    }
+
+    //*******************************************
+    /// Get the enable/disable state.
+    //*******************************************
+    bool is_running() const
+    {
+      return enabled;
+    }
+
+    //*******************************************
+    /// Clears the timer of data.
+    //*******************************************
+    void clear()
+    {
+      lock();
+      active_wheel.clear();
+      unlock();
+
+      for (uint8_t i = 0U; i < Max_Timers; ++i)
+      {
+        ::new (&timer_array[i]) timer_data();
+      }
+
+      number_of_registered_timers = 0;
+    }
+
+    //*******************************************
+    // Called by the timer service to indicate the
+    // amount of time that has elapsed since the last successful call to 'tick'.
+    // Returns true if the tick was processed,
+    // false if not.
+    //*******************************************
+    virtual bool tick(uint32_t count) = 0;
+
+    //*******************************************
+    /// Starts a timer.
+    //*******************************************
+    bool start(etl::timer::id::type id_, bool immediate_ = false)
+    {
+      bool result = false;
+
+      // Valid timer id?
+      if (id_ != etl::timer::id::NO_TIMER)
+      {
+        timer_data& timer = timer_array[id_];
+
+        // Registered timer?
+        if (timer.id != etl::timer::id::NO_TIMER)
+        {
+          // Has a valid period.
+          if (timer.period != etl::timer::state::Inactive)
+          {
+            lock();
+            if (timer.is_active())
+            {
+              active_wheel.remove(timer.id);
+              remove_callback.call_if(timer.id);
+            }
+
+            active_wheel.insert(timer.id, immediate_ ? 0U : timer.period);
+            insert_callback.call_if(timer.id);
+            unlock();
+
+            result = true;
+          }
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Stops a timer.
+    //*******************************************
+    bool stop(etl::timer::id::type id_)
+    {
+      bool result = false;
+
+      // Valid timer id?
+      if (id_ != etl::timer::id::NO_TIMER)
+      {
+        timer_data& timer = timer_array[id_];
+
+        // Registered timer?
+        if (timer.id != etl::timer::id::NO_TIMER)
+        {
+          if (timer.is_active())
+          {
+            lock();
+            active_wheel.remove(timer.id);
+            remove_callback.call_if(timer.id);
+            unlock();
+          }
+
+          result = true;
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Sets a timer's period.
+    //*******************************************
+    bool set_period(etl::timer::id::type id_, uint32_t period_)
+    {
+      if (stop(id_))
+      {
+        timer_array[id_].period = period_;
+        return true;
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Sets a timer's mode.
+    //*******************************************
+    bool set_mode(etl::timer::id::type id_, bool repeating_)
+    {
+      if (stop(id_))
+      {
+        timer_array[id_].repeating = repeating_;
+        return true;
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Sets the lock and unlock delegates.
+    //*******************************************
+    void set_locks(try_lock_type try_lock_, lock_type lock_, lock_type unlock_)
+    {
+      try_lock = try_lock_;
+      lock     = lock_;
+      unlock   = unlock_;
+    }
+
+    //*******************************************
+    /// Check if there is an active timer.
+    //*******************************************
+    bool has_active_timer() const
+    {
+      lock();
+      bool result = !active_wheel.empty();
+      unlock();
+
+      return result;
+    }
+
+    //*******************************************
+    /// Get the time to the next timer event.
+    /// Returns etl::timer::interval::No_Active_Interval if there is no active
+    /// timer.
+    //*******************************************
+    uint32_t time_to_next() const
+    {
+      lock();
+      uint32_t delta = active_wheel.time_to_next();
+      unlock();
+
+      return delta;
+    }
+
+    //*******************************************
+    /// Checks if a timer is currently active.
+    /// Returns <b>true</b> if the timer is active, otherwise <b>false</b>.
+    //*******************************************
+    bool is_active(etl::timer::id::type id_) const
+    {
+      bool result = false;
+
+      // Valid timer id?
+      if (is_valid_timer_id(id_))
+      {
+        lock();
+        const timer_data& timer = timer_array[id_];
+
+        // Registered timer?
+        if (timer.id != etl::timer::id::NO_TIMER)
+        {
+          result = timer.is_active();
+        }
+        unlock();
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Set a callback when a timer is inserted on list
+    //*******************************************
+    void set_insert_callback(event_callback_type insert_)
+    {
+      insert_callback = insert_;
+    }
+
+    //*******************************************
+    /// Set a callback when a timer is removed from list
+    //*******************************************
+    void set_remove_callback(event_callback_type remove_)
+    {
+      remove_callback = remove_;
+    }
+
+    //*******************************************
+    void clear_insert_callback()
+    {
+      insert_callback.clear();
+    }
+
+    //*******************************************
+    void clear_remove_callback()
+    {
+      remove_callback.clear();
+    }
+
+  protected:
+
+    class callback_node
+    {
+    public:
+
+      callback_node(callback_type& callback_, uint_least8_t priority_)
+        : callback(callback_)
+        , priority(priority_)
+      {
+      }
+
+      bool operator<(const callback_node& p) const
+      {
+        return this->priority > p.priority; // comparison was inverted here to
+                                            // easy the code design
+      }
+
+      callback_type callback;
+      uint_least8_t priority;
+    };
+
+    //*************************************************************************
+    /// The configuration of a timer.
+    struct timer_data
+    {
+      //*******************************************
+      timer_data()
+        : callback()
+        , period(0U)
+        , expiry(0U)
+        , id(etl::timer::id::NO_TIMER)
+        , previous(etl::timer::id::NO_TIMER)
+        , next(etl::timer::id::NO_TIMER)
+        , slot(etl::private_timer::timer_wheel_constants::No_Slot)
+        , repeating(true)
+      {
+      }
+
+      //*******************************************
+      /// ETL delegate callback
+      //*******************************************
+      timer_data(etl::timer::id::type id_, callback_type callback_, uint32_t period_, bool repeating_)
+        : callback(callback_)
+        , period(period_)
+        , expiry(0U)
+        , id(id_)
+        , previous(etl::timer::id::NO_TIMER)
+        , next(etl::timer::id::NO_TIMER)
+        , slot(etl::private_timer::timer_wheel_constants::No_Slot)
+        , repeating(repeating_)
+      {
+      }
+
+      //*******************************************
+      /// Returns true if the timer is active.
+      //*******************************************
+      bool is_active() const
+      {
+        return slot != etl::private_timer::timer_wheel_constants::No_Slot;
+      }
+
+      callback_type        callback;
+      uint32_t             period;
+      uint32_t             expiry;
+      etl::timer::id::type id;
+      uint_least8_t        previous;
+      uint_least8_t        next;
+      uint_least8_t        slot;
+      bool                 repeating;
+
+    private:
+
+      // Disabled.
+      timer_data(const timer_data& other) ETL_DELETE;
+      timer_data& operator=(const timer_data& other) ETL_DELETE;
+    };
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    icallback_timer_wheel_locked(timer_data* const timer_array_, const uint_least8_t Max_Timers_)
+      : timer_array(timer_array_)
+      , active_wheel(timer_array_)
+      , enabled(false)
+      , number_of_registered_timers(0U)
+      , Max_Timers(Max_Timers_)
+    {
+    }
+
+  private:
+
+    //*******************************************
+    /// Check that the timer id is valid.
+    //*******************************************
+    bool is_valid_timer_id(etl::timer::id::type id_) const
+    {
+      return (id_ < Max_Timers);
+    }
+
+    // The array of timer data structures.
+    timer_data* const timer_array;
+
+    // The wheel of active timers.
+    etl::private_timer::timer_wheel<timer_data> active_wheel;
+
+    bool          enabled;
+    uint_least8_t number_of_registered_timers;
+
+    try_lock_type try_lock; ///< The callback that tries to lock.
+    lock_type     lock;     ///< The callback that locks.
+    unlock_type   unlock;   ///< The callback that unlocks.
+
+    event_callback_type insert_callback;
+    event_callback_type remove_callback;
+
+  public:
+
+    template <uint_least8_t>
+    friend class callback_timer_wheel_locked;
+
+    template <uint_least8_t, uint32_t>
+    friend class callback_timer_wheel_deferred_locked;
+
+    const uint_least8_t Max_Timers;
+  };
+
+  //***************************************************************************
+  /// The callback timer using a hierarchical timer wheel.
+  //***************************************************************************
+  template <uint_least8_t Max_Timers_>
+  class callback_timer_wheel_locked : public etl::icallback_timer_wheel_locked
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Max_Timers_ <= 254U, "No more than 254 timers are allowed");
+
+    typedef icallback_timer_wheel_locked::callback_type callback_type;
+    typedef icallback_timer_wheel_locked::try_lock_type try_lock_type;
+    typedef icallback_timer_wheel_locked::lock_type     lock_type;
+    typedef icallback_timer_wheel_locked::unlock_type   unlock_type;
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    callback_timer_wheel_locked()
+      : icallback_timer_wheel_locked(timer_array, Max_Timers_)
+    {
+    }
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    callback_timer_wheel_locked(try_lock_type try_lock_, lock_type lock_, unlock_type unlock_)
+      : icallback_timer_wheel_locked(timer_array, Max_Timers_)
+    {
+      this->set_locks(try_lock_, lock_, unlock_);
+    }
+
+    //*******************************************
+    /// Handle the tick call
+    //*******************************************
+    bool tick(uint32_t count) final
+    {
+      if (enabled)
+      {
+        if (try_lock())
+        {
+          etl::timer::id::type id = active_wheel.expire(count);
+
+          while (id != etl::timer::id::NO_TIMER)
+          {
+            timer_data& timer = timer_array[id];
+
+            remove_callback.call_if(timer.id);
+
+            if (timer.callback.is_valid())
+            {
+              timer.callback();
+            }
+
+            if (timer.repeating)
+            {
+              // Reinsert the timer.
+              active_wheel.insert(timer.id, timer.period);
+              insert_callback.call_if(timer.id);
+            }
+
+            id = active_wheel.expire(count);
+          }
+
+          unlock();
+
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+  private:
+
+    timer_data timer_array[Max_Timers_];
+  };
+} // namespace etl
+
+#endif
@@ -38,6 +38,7 @@ SOFTWARE.
 #include "iterator.h"
 #include "memory.h"
 #include "memory_model.h"
+#include "span.h"
 #include "static_assert.h"
 #include "type_traits.h"
 #include "vector.h"
@@ -900,6 +901,40 @@ namespace etl
       return pbuffer[(out + index) % buffer_size];
     }
 
+    //*************************************************************************
+    /// Gets the first contiguous segment of the buffer, starting at the front.
+    //*************************************************************************
+    etl::span<T> array_one()
+    {
+      return etl::span<T>(pbuffer + out, segment_one_size());
+    }
+
+    //*************************************************************************
+    /// Gets the first contiguous segment of the buffer, starting at the front.
+    //*************************************************************************
+    etl::span<const T> array_one() const
+    {
+      return etl::span<const T>(pbuffer + out, segment_one_size());
+    }
+
+    //*************************************************************************
+    /// Gets the second contiguous segment of the buffer, ending at the back.
+    /// Empty if the items have not wrapped around the end of the storage.
+    //*************************************************************************
+    etl::span<T> array_two()
+    {
+      return etl::span<T>(pbuffer, segment_two_size());
+    }
+
+    //*************************************************************************
+    /// Gets the second contiguous segment of the buffer, ending at the back.
+    /// Empty if the items have not wrapped around the end of the storage.
+    //*************************************************************************
+    etl::span<const T> array_two() const
+    {
+      return etl::span<const T>(pbuffer, segment_two_size());
+    }
+
     //*************************************************************************
     /// push.
     /// Adds an item to the buffer.
@@ -961,6 +996,16 @@ namespace etl
       }
     }
 
+    //*************************************************************************
+    /// Push a span of items.
+    /// If the buffer is filled then the oldest items are overwritten.
+    /// Trivially copyable items are copied with, at most, two memcpy.
+    //*************************************************************************
+    void push(etl::span<const T> values)
+    {
+      push_block(values.data(), values.size(), etl::integral_constant<bool, etl::is_trivially_copyable<T>::value>());
+    }
+
     //*************************************************************************
     /// pop
     //*************************************************************************
@@ -983,6 +1028,21 @@ namespace etl
       }
     }
 
+    //*************************************************************************
+    /// Pops items from the front of the buffer into a span.
+    /// Pops as many as are available, up to the size of the span.
+    /// Trivially copyable items are copied with, at most, two memcpy.
+    ///\return The number of items popped.
+    //*************************************************************************
+    size_type pop_into(etl::span<T> values)
+    {
+      const size_type n = (values.size() < size()) ? values.size() : size();
+
+      pop_block(values.data(), n, etl::integral_constant<bool, etl::is_trivially_copyable<T>::value>());
+
+      return n;
+    }
+
     //*************************************************************************
     /// Clears the buffer.
     //*************************************************************************
@@ -1090,6 +1150,108 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// The number of items from 'out' to the end of the first segment.
+    //*************************************************************************
+    size_type segment_one_size() const
+    {
+      return (in >= out) ? in - out : buffer_size - out;
+    }
+
+    //*************************************************************************
+    /// The number of items wrapped around to the start of the storage.
+    //*************************************************************************
+    size_type segment_two_size() const
+    {
+      return (in >= out) ? 0U : in;
+    }
+
+    //*************************************************************************
+    /// Push a block of trivially copyable items.
+    //*************************************************************************
+    void push_block(const T* p_values, size_type n, etl::true_type)
+    {
+      if (n == 0U)
+      {
+        return;
+      }
+
+      // Only the newest 'max_size' items would survive.
+      if (n > max_size())
+      {
+        p_values += (n - max_size());
+        n = max_size();
+      }
+
+      const size_type new_size = ((size() + n) > max_size()) ? max_size() : size() + n;
+      const size_type n_one    = ((buffer_size - in) < n) ? buffer_size - in : n;
+
+      etl::mem_copy(p_values, n_one, pbuffer + in);
+      etl::mem_copy(p_values + n_one, n - n_one, pbuffer);
+
+      in += n;
+      if (in >= buffer_size)
+      {
+        in -= buffer_size;
+      }
+
+      // Any overwritten items are dropped from the front.
+      out = (in >= new_size) ? in - new_size : in + buffer_size - new_size;
+
+      ETL_SET_DEBUG_COUNT(int32_t(new_size));
+    }
+
+    //*************************************************************************
+    /// Push a block of items one at a time.
+    //*************************************************************************
+    void push_block(const T* p_values, size_type n, etl::false_type)
+    {
+      while (n-- != 0U)
+      {
+        push(*p_values++);
+      }
+    }
+
+    //*************************************************************************
+    /// Pop a block of 'n' trivially copyable items.
+    //*************************************************************************
+    void pop_block(T* p_values, size_type n, etl::true_type)
+    {
+      if (n == 0U)
+      {
+        return;
+      }
+
+      const size_type n_one = ((buffer_size - out) < n) ? buffer_size - out : n;
+
+      etl::mem_copy(pbuffer + out, n_one, p_values);
+      etl::mem_copy(pbuffer, n - n_one, p_values + n_one);
+
+      out += n;
+      if (out >= buffer_size)
+      {
+        out -= buffer_size;
+      }
+
+      ETL_SUBTRACT_DEBUG_COUNT(n);
+    }
+
+    //*************************************************************************
+    /// Pop a block of 'n' items one at a time.
+    //*************************************************************************
+    void pop_block(T* p_values, size_type n, etl::false_type)
+    {
+      while (n-- != 0U)
+      {
+#if ETL_USING_CPP11
+        *p_values++ = etl::move(pbuffer[out]);
+#else
+        *p_values++ = pbuffer[out];
+#endif
+        pop();
+      }
+    }
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
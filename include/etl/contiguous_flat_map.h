@@ -0,0 +1,624 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CONTIGUOUS_FLAT_MAP_INCLUDED
+#define ETL_CONTIGUOUS_FLAT_MAP_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "alignment.h"
+#include "functional.h"
+#include "initializer_list.h"
+#include "iterator.h"
+#include "nth_type.h"
+#include "type_traits.h"
+#include "utility.h"
+
+#include "private/comparator_is_transparent.h"
+#include "private/contiguous_flat_base.h"
+
+//*****************************************************************************
+///\defgroup contiguous_flat_map contiguous_flat_map
+/// A flat_map that holds its elements by value in a single sorted array,
+/// with the capacity defined at compile time.
+/// Unlike etl::flat_map, which sorts pointers to elements held in a pool,
+/// searches and iteration only touch contiguous memory.
+/// Has insertion of O(N) and find of O(logN).
+/// Duplicate entries are not allowed.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for specifically sized contiguous_flat_maps.
+  /// Can be used as a reference type for all contiguous_flat_maps containing a
+  /// specific type.
+  ///\ingroup contiguous_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare = etl::less<TKey> >
+  class icontiguous_flat_map
+    : public etl::icontiguous_flat_base<ETL_OR_STD::pair<const TKey, TMapped>, TKey, TKeyCompare,
+                                        etl::private_contiguous_flat::key_of_pair<TKey, ETL_OR_STD::pair<const TKey, TMapped> > >
+  {
+  private:
+
+    typedef etl::icontiguous_flat_base<ETL_OR_STD::pair<const TKey, TMapped>, TKey, TKeyCompare,
+                                       etl::private_contiguous_flat::key_of_pair<TKey, ETL_OR_STD::pair<const TKey, TMapped> > >
+      base_t;
+
+  public:
+
+    typedef typename base_t::value_type      value_type;
+    typedef typename base_t::key_type        key_type;
+    typedef TMapped                          mapped_type;
+    typedef typename base_t::key_compare     key_compare;
+    typedef typename base_t::reference       reference;
+    typedef typename base_t::const_reference const_reference;
+#if ETL_USING_CPP11
+    typedef typename base_t::rvalue_reference rvalue_reference;
+#endif
+    typedef typename base_t::pointer         pointer;
+    typedef typename base_t::const_pointer   const_pointer;
+    typedef typename base_t::size_type       size_type;
+    typedef typename base_t::iterator        iterator;
+    typedef typename base_t::const_iterator  const_iterator;
+    typedef typename base_t::difference_type difference_type;
+
+    typedef const key_type& const_key_reference;
+#if ETL_USING_CPP11
+    typedef key_type&& rvalue_key_reference;
+#endif
+    typedef mapped_type&       mapped_reference;
+    typedef const mapped_type& const_mapped_reference;
+
+    using base_t::begin;
+    using base_t::capacity;
+    using base_t::clear;
+    using base_t::end;
+    using base_t::lower_bound;
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference operator[](rvalue_key_reference key)
+    {
+      iterator i_element = lower_bound(key);
+
+      // Doesn't already exist?
+      if (!this->is_match(i_element, key))
+      {
+        this->insert_value(i_element, value_type(etl::move(key), mapped_type()));
+      }
+
+      return i_element->second;
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference operator[](const_key_reference key)
+    {
+      iterator i_element = lower_bound(key);
+
+      // Doesn't already exist?
+      if (!this->is_match(i_element, key))
+      {
+        this->insert_value(i_element, value_type(key, mapped_type()));
+      }
+
+      return i_element->second;
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an
+    /// etl::contiguous_flat_out_of_bounds if the key is not in the range.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference at(const_key_reference key)
+    {
+      iterator i_element = this->find(key);
+
+      ETL_ASSERT(i_element != end(), ETL_ERROR(contiguous_flat_out_of_bounds));
+
+      return i_element->second;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    mapped_reference at(const K& key)
+    {
+      iterator i_element = this->find(key);
+
+      ETL_ASSERT(i_element != end(), ETL_ERROR(contiguous_flat_out_of_bounds));
+
+      return i_element->second;
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an
+    /// etl::contiguous_flat_out_of_bounds if the key is not in the range.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
+    //*********************************************************************
+    const_mapped_reference at(const_key_reference key) const
+    {
+      const_iterator i_element = this->find(key);
+
+      ETL_ASSERT(i_element != end(), ETL_ERROR(contiguous_flat_out_of_bounds));
+
+      return i_element->second;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_mapped_reference at(const K& key) const
+    {
+      const_iterator i_element = this->find(key);
+
+      ETL_ASSERT(i_element != end(), ETL_ERROR(contiguous_flat_out_of_bounds));
+
+      return i_element->second;
+    }
+#endif
+
+    //*********************************************************************
+    /// Assigns values to the contiguous_flat_map.
+    /// If asserts or exceptions are enabled, emits contiguous_flat_full if
+    /// the contiguous_flat_map does not have enough free space.
+    /// Sorted input is appended without searching or moving elements.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+#if ETL_IS_DEBUG_BUILD
+      difference_type d = etl::distance(first, last);
+      ETL_ASSERT(d <= difference_type(capacity()), ETL_ERROR(contiguous_flat_full));
+#endif
+
+      clear();
+
+      while (first != last)
+      {
+        insert(end(), *first);
+        ++first;
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the contiguous_flat_map.
+    /// If asserts or exceptions are enabled, emits contiguous_flat_full if
+    /// the contiguous_flat_map is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference value)
+    {
+      return insert_at(lower_bound(value.first), value);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Moves a value to the contiguous_flat_map.
+    /// If asserts or exceptions are enabled, emits contiguous_flat_full if
+    /// the contiguous_flat_map is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference value)
+    {
+      return insert_at(lower_bound(value.first), etl::move(value));
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the contiguous_flat_map.
+    /// If 'position' is where the value belongs then no search is made.
+    /// If asserts or exceptions are enabled, emits contiguous_flat_full if
+    /// the contiguous_flat_map is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator position, const_reference value)
+    {
+      return insert_at(this->lower_bound_from_hint(position, value.first), value).first;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Moves a value to the contiguous_flat_map.
+    /// If 'position' is where the value belongs then no search is made.
+    /// If asserts or exceptions are enabled, emits contiguous_flat_full if
+    /// the contiguous_flat_map is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator position, rvalue_reference value)
+    {
+      return insert_at(this->lower_bound_from_hint(position, value.first), etl::move(value)).first;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the contiguous_flat_map.
+    /// If asserts or exceptions are enabled, emits contiguous_flat_full if
+    /// the contiguous_flat_map does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the map.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> emplace(const value_type& value)
+    {
+      return insert(value);
+    }
+
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT
+    //*************************************************************************
+    /// Emplaces a value to the map.
+    //*************************************************************************
+    template <typename... Args>
+    ETL_OR_STD::pair<iterator, bool> emplace(const_key_reference key, Args&&... args)
+    {
+      iterator i_element = lower_bound(key);
+
+      if (this->is_match(i_element, key))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(i_element, false);
+      }
+
+      this->insert_value(i_element, value_type(key, mapped_type(etl::forward<Args>(args)...)));
+
+      return ETL_OR_STD::pair<iterator, bool>(i_element, true);
+    }
+#else
+    //*************************************************************************
+    /// Emplaces a value to the map.
+    //*************************************************************************
+    template <typename T1>
+    ETL_OR_STD::pair<iterator, bool> emplace(const_key_reference key, const T1& value1)
+    {
+      iterator i_element = lower_bound(key);
+
+      if (this->is_match(i_element, key))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(i_element, false);
+      }
+
+      this->insert_value(i_element, value_type(key, mapped_type(value1)));
+
+      return ETL_OR_STD::pair<iterator, bool>(i_element, true);
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the map.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    ETL_OR_STD::pair<iterator, bool> emplace(const_key_reference key, const T1& value1, const T2& value2)
+    {
+      iterator i_element = lower_bound(key);
+
+      if (this->is_match(i_element, key))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(i_element, false);
+      }
+
+      this->insert_value(i_element, value_type(key, mapped_type(value1, value2)));
+
+      return ETL_OR_STD::pair<iterator, bool>(i_element, true);
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the map.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    ETL_OR_STD::pair<iterator, bool> emplace(const_key_reference key, const T1& value1, const T2& value2, const T3& value3)
+    {
+      iterator i_element = lower_bound(key);
+
+      if (this->is_match(i_element, key))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(i_element, false);
+      }
+
+      this->insert_value(i_element, value_type(key, mapped_type(value1, value2, value3)));
+
+      return ETL_OR_STD::pair<iterator, bool>(i_element, true);
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the map.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    ETL_OR_STD::pair<iterator, bool> emplace(const_key_reference key, const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      iterator i_element = lower_bound(key);
+
+      if (this->is_match(i_element, key))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(i_element, false);
+      }
+
+      this->insert_value(i_element, value_type(key, mapped_type(value1, value2, value3, value4)));
+
+      return ETL_OR_STD::pair<iterator, bool>(i_element, true);
+    }
+#endif
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    icontiguous_flat_map& operator=(const icontiguous_flat_map& rhs)
+    {
+      this->copy_container(rhs);
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    icontiguous_flat_map& operator=(icontiguous_flat_map&& rhs)
+    {
+      this->move_container(etl::move(rhs));
+
+      return *this;
+    }
+#endif
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    icontiguous_flat_map(value_type* p_buffer_, size_type max_size_)
+      : base_t(p_buffer_, max_size_)
+    {
+    }
+
+  private:
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename TValueType>
+    ETL_OR_STD::pair<iterator, bool> insert_at(iterator i_element, TValueType&& value)
+    {
+      if (this->is_match(i_element, value.first))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(i_element, false);
+      }
+
+      this->insert_value(i_element, value_type(etl::forward<TValueType>(value)));
+
+      return ETL_OR_STD::pair<iterator, bool>(i_element, true);
+    }
+#else
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert_at(iterator i_element, const_reference value)
+    {
+      if (this->is_match(i_element, value.first))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(i_element, false);
+      }
+
+      this->insert_value(i_element, value_type(value));
+
+      return ETL_OR_STD::pair<iterator, bool>(i_element, true);
+    }
+#endif
+
+    // Disable copy construction.
+    icontiguous_flat_map(const icontiguous_flat_map&);
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first contiguous_flat_map.
+  ///\param rhs Reference to the second contiguous_flat_map.
+  ///\return <b>true</b> if the arrays are equal, otherwise <b>false</b>
+  ///\ingroup contiguous_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator==(const etl::icontiguous_flat_map<TKey, TMapped, TKeyCompare>& lhs, const etl::icontiguous_flat_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first contiguous_flat_map.
+  ///\param rhs Reference to the second contiguous_flat_map.
+  ///\return <b>true</b> if the arrays are not equal, otherwise <b>false</b>
+  ///\ingroup contiguous_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator!=(const etl::icontiguous_flat_map<TKey, TMapped, TKeyCompare>& lhs, const etl::icontiguous_flat_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// A contiguous_flat_map implementation that uses a fixed size buffer.
+  ///\tparam TKey      The key type.
+  ///\tparam TValue    The value type.
+  ///\tparam MAX_SIZE_ The maximum number of elements that can be stored.
+  ///\tparam TCompare  The type to compare keys. Default = etl::less<TKey>
+  ///\ingroup contiguous_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare = etl::less<TKey> >
+  class contiguous_flat_map : public etl::icontiguous_flat_map<TKey, TValue, TCompare>
+  {
+  private:
+
+    typedef etl::icontiguous_flat_map<TKey, TValue, TCompare> base_t;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    contiguous_flat_map()
+      : base_t(reinterpret_cast<typename base_t::value_type*>(&buffer[0]), MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    contiguous_flat_map(const contiguous_flat_map& other)
+      : base_t(reinterpret_cast<typename base_t::value_type*>(&buffer[0]), MAX_SIZE)
+    {
+      this->copy_container(other);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    contiguous_flat_map(contiguous_flat_map&& other)
+      : base_t(reinterpret_cast<typename base_t::value_type*>(&buffer[0]), MAX_SIZE)
+    {
+      this->move_container(etl::move(other));
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    contiguous_flat_map(TIterator first, TIterator last)
+      : base_t(reinterpret_cast<typename base_t::value_type*>(&buffer[0]), MAX_SIZE)
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    contiguous_flat_map(std::initializer_list<typename base_t::value_type> init)
+      : base_t(reinterpret_cast<typename base_t::value_type*>(&buffer[0]), MAX_SIZE)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~contiguous_flat_map()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    contiguous_flat_map& operator=(const contiguous_flat_map& rhs)
+    {
+      this->copy_container(rhs);
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    contiguous_flat_map& operator=(contiguous_flat_map&& rhs)
+    {
+      this->move_container(etl::move(rhs));
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    typedef typename base_t::value_type node_t;
+
+    /// The sorted elements.
+    typename etl::aligned_storage<sizeof(node_t), etl::alignment_of<node_t>::value>::type buffer[MAX_SIZE];
+  };
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare>
+  ETL_CONSTANT size_t contiguous_flat_map<TKey, TValue, MAX_SIZE_, TCompare>::MAX_SIZE;
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if ETL_USING_CPP17 && ETL_HAS_INITIALIZER_LIST
+  template <typename... TPairs>
+  contiguous_flat_map(TPairs...) -> contiguous_flat_map<typename etl::nth_type_t<0, TPairs...>::first_type,
+                                                        typename etl::nth_type_t<0, TPairs...>::second_type, sizeof...(TPairs)>;
+#endif
+
+  //*************************************************************************
+  /// Make
+  //*************************************************************************
+#if ETL_USING_CPP11 && ETL_HAS_INITIALIZER_LIST
+  template <typename TKey, typename TMapped, typename TKeyCompare = etl::less<TKey>, typename... TPairs>
+  constexpr auto make_contiguous_flat_map(TPairs&&... pairs) -> etl::contiguous_flat_map<TKey, TMapped, sizeof...(TPairs), TKeyCompare>
+  {
+    return {etl::forward<TPairs>(pairs)...};
+  }
+#endif
+} // namespace etl
+
+#endif
@@ -0,0 +1,476 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CONTIGUOUS_FLAT_MULTISET_INCLUDED
+#define ETL_CONTIGUOUS_FLAT_MULTISET_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "alignment.h"
+#include "functional.h"
+#include "initializer_list.h"
+#include "iterator.h"
+#include "nth_type.h"
+#include "type_traits.h"
+#include "utility.h"
+
+#include "private/contiguous_flat_base.h"
+
+//*****************************************************************************
+///\defgroup contiguous_flat_multiset contiguous_flat_multiset
+/// A flat_multiset that holds its elements by value in a single sorted array,
+/// with the capacity defined at compile time.
+/// Has insertion of O(N) and find of O(logN).
+/// Duplicate entries are allowed and are kept in insertion order.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for specifically sized contiguous_flat_multisets.
+  /// Can be used as a reference type for all contiguous_flat_multisets containing a
+  /// specific type.
+  ///\ingroup contiguous_flat_multiset
+  //***************************************************************************
+  template <typename T, typename TKeyCompare = etl::less<T> >
+  class icontiguous_flat_multiset
+    : public etl::icontiguous_flat_base<T, T, TKeyCompare, etl::private_contiguous_flat::key_of_value<T> >
+  {
+  private:
+
+    typedef etl::icontiguous_flat_base<T, T, TKeyCompare, etl::private_contiguous_flat::key_of_value<T> > base_t;
+
+  public:
+
+    typedef typename base_t::value_type      value_type;
+    typedef typename base_t::key_type        key_type;
+    typedef typename base_t::key_compare     key_compare;
+    typedef key_compare                      value_compare;
+    typedef typename base_t::reference       reference;
+    typedef typename base_t::const_reference const_reference;
+#if ETL_USING_CPP11
+    typedef typename base_t::rvalue_reference rvalue_reference;
+#endif
+    typedef typename base_t::pointer         pointer;
+    typedef typename base_t::const_pointer   const_pointer;
+    typedef typename base_t::size_type       size_type;
+    typedef typename base_t::iterator        iterator;
+    typedef typename base_t::const_iterator  const_iterator;
+    typedef typename base_t::difference_type difference_type;
+
+    using base_t::capacity;
+    using base_t::clear;
+    using base_t::end;
+    using base_t::upper_bound;
+
+    //*********************************************************************
+    /// Assigns values to the contiguous_flat_multiset.
+    /// If asserts or exceptions are enabled, emits contiguous_flat_full if
+    /// the contiguous_flat_multiset does not have enough free space.
+    /// Sorted input is appended without searching or moving elements.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+#if ETL_IS_DEBUG_BUILD
+      difference_type d = etl::distance(first, last);
+      ETL_ASSERT(d <= difference_type(capacity()), ETL_ERROR(contiguous_flat_full));
+#endif
+
+      clear();
+
+      while (first != last)
+      {
+        insert(end(), *first);
+        ++first;
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the contiguous_flat_multiset.
+    /// If asserts or exceptions are enabled, emits contiguous_flat_full if
+    /// the contiguous_flat_multiset is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference value)
+    {
+      return insert_at(upper_bound(value), value);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Moves a value to the contiguous_flat_multiset.
+    /// If asserts or exceptions are enabled, emits contiguous_flat_full if
+    /// the contiguous_flat_multiset is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference value)
+    {
+      iterator i_element = upper_bound(value);
+
+      return insert_at(i_element, etl::move(value));
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the contiguous_flat_multiset.
+    /// If 'position' is where the value belongs then no search is made.
+    /// If asserts or exceptions are enabled, emits contiguous_flat_full if
+    /// the contiguous_flat_multiset is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator position, const_reference value)
+    {
+      return insert_at(this->upper_bound_from_hint(position, value), value).first;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Moves a value to the contiguous_flat_multiset.
+    /// If 'position' is where the value belongs then no search is made.
+    /// If asserts or exceptions are enabled, emits contiguous_flat_full if
+    /// the contiguous_flat_multiset is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator position, rvalue_reference value)
+    {
+      iterator i_element = this->upper_bound_from_hint(position, value);
+
+      return insert_at(i_element, etl::move(value)).first;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the contiguous_flat_multiset.
+    /// If asserts or exceptions are enabled, emits contiguous_flat_full if
+    /// the contiguous_flat_multiset does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the multiset.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> emplace(const_reference value)
+    {
+      return insert(value);
+    }
+
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT
+    //*************************************************************************
+    /// Emplaces a value to the multiset.
+    /// The value is constructed first, as its key is the value.
+    //*************************************************************************
+    template <typename... Args>
+    ETL_OR_STD::pair<iterator, bool> emplace(Args&&... args)
+    {
+      return insert(value_type(etl::forward<Args>(args)...));
+    }
+#else
+    //*************************************************************************
+    /// Emplaces a value to the multiset.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> emplace()
+    {
+      return insert(value_type());
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the multiset.
+    //*************************************************************************
+    template <typename T1>
+    ETL_OR_STD::pair<iterator, bool> emplace(const T1& value1)
+    {
+      return insert(value_type(value1));
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the multiset.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    ETL_OR_STD::pair<iterator, bool> emplace(const T1& value1, const T2& value2)
+    {
+      return insert(value_type(value1, value2));
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the multiset.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    ETL_OR_STD::pair<iterator, bool> emplace(const T1& value1, const T2& value2, const T3& value3)
+    {
+      return insert(value_type(value1, value2, value3));
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the multiset.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    ETL_OR_STD::pair<iterator, bool> emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      return insert(value_type(value1, value2, value3, value4));
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets the value comparison function.
+    //*************************************************************************
+    value_compare value_comp() const
+    {
+      return this->key_comp();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    icontiguous_flat_multiset& operator=(const icontiguous_flat_multiset& rhs)
+    {
+      this->copy_container(rhs);
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    icontiguous_flat_multiset& operator=(icontiguous_flat_multiset&& rhs)
+    {
+      this->move_container(etl::move(rhs));
+
+      return *this;
+    }
+#endif
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    icontiguous_flat_multiset(value_type* p_buffer_, size_type max_size_)
+      : base_t(p_buffer_, max_size_)
+    {
+    }
+
+  private:
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename TValueType>
+    ETL_OR_STD::pair<iterator, bool> insert_at(iterator i_element, TValueType&& value)
+    {
+      this->insert_value(i_element, value_type(etl::forward<TValueType>(value)));
+
+      return ETL_OR_STD::pair<iterator, bool>(i_element, true);
+    }
+#else
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert_at(iterator i_element, const_reference value)
+    {
+      this->insert_value(i_element, value_type(value));
+
+      return ETL_OR_STD::pair<iterator, bool>(i_element, true);
+    }
+#endif
+
+    // Disable copy construction.
+    icontiguous_flat_multiset(const icontiguous_flat_multiset&);
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first contiguous_flat_multiset.
+  ///\param rhs Reference to the second contiguous_flat_multiset.
+  ///\return <b>true</b> if the arrays are equal, otherwise <b>false</b>
+  ///\ingroup contiguous_flat_multiset
+  //***************************************************************************
+  template <typename T, typename TKeyCompare>
+  bool operator==(const etl::icontiguous_flat_multiset<T, TKeyCompare>& lhs, const etl::icontiguous_flat_multiset<T, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first contiguous_flat_multiset.
+  ///\param rhs Reference to the second contiguous_flat_multiset.
+  ///\return <b>true</b> if the arrays are not equal, otherwise <b>false</b>
+  ///\ingroup contiguous_flat_multiset
+  //***************************************************************************
+  template <typename T, typename TKeyCompare>
+  bool operator!=(const etl::icontiguous_flat_multiset<T, TKeyCompare>& lhs, const etl::icontiguous_flat_multiset<T, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// A contiguous_flat_multiset implementation that uses a fixed size buffer.
+  ///\tparam T         The value type.
+  ///\tparam MAX_SIZE_ The maximum number of elements that can be stored.
+  ///\tparam TCompare  The type to compare keys. Default = etl::less<T>
+  ///\ingroup contiguous_flat_multiset
+  //***************************************************************************
+  template <typename T, const size_t MAX_SIZE_, typename TCompare = etl::less<T> >
+  class contiguous_flat_multiset : public etl::icontiguous_flat_multiset<T, TCompare>
+  {
+  private:
+
+    typedef etl::icontiguous_flat_multiset<T, TCompare> base_t;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    contiguous_flat_multiset()
+      : base_t(reinterpret_cast<T*>(&buffer[0]), MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    contiguous_flat_multiset(const contiguous_flat_multiset& other)
+      : base_t(reinterpret_cast<T*>(&buffer[0]), MAX_SIZE)
+    {
+      this->copy_container(other);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    contiguous_flat_multiset(contiguous_flat_multiset&& other)
+      : base_t(reinterpret_cast<T*>(&buffer[0]), MAX_SIZE)
+    {
+      this->move_container(etl::move(other));
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    contiguous_flat_multiset(TIterator first, TIterator last)
+      : base_t(reinterpret_cast<T*>(&buffer[0]), MAX_SIZE)
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    contiguous_flat_multiset(std::initializer_list<T> init)
+      : base_t(reinterpret_cast<T*>(&buffer[0]), MAX_SIZE)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~contiguous_flat_multiset()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    contiguous_flat_multiset& operator=(const contiguous_flat_multiset& rhs)
+    {
+      this->copy_container(rhs);
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    contiguous_flat_multiset& operator=(contiguous_flat_multiset&& rhs)
+    {
+      this->move_container(etl::move(rhs));
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The sorted elements.
+    typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type buffer[MAX_SIZE];
+  };
+
+  template <typename T, const size_t MAX_SIZE_, typename TCompare>
+  ETL_CONSTANT size_t contiguous_flat_multiset<T, MAX_SIZE_, TCompare>::MAX_SIZE;
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if ETL_USING_CPP17 && ETL_HAS_INITIALIZER_LIST
+  template <typename... T>
+  contiguous_flat_multiset(T...) -> contiguous_flat_multiset<etl::nth_type_t<0, T...>, sizeof...(T)>;
+#endif
+
+  //*************************************************************************
+  /// Make
+  //*************************************************************************
+#if ETL_USING_CPP11 && ETL_HAS_INITIALIZER_LIST
+  template <typename TKey, typename TKeyCompare = etl::less<TKey>, typename... T>
+  constexpr auto make_contiguous_flat_multiset(T&&... keys) -> etl::contiguous_flat_multiset<TKey, sizeof...(T), TKeyCompare>
+  {
+    return {etl::forward<T>(keys)...};
+  }
+#endif
+} // namespace etl
+
+#endif
@@ -70,9 +70,11 @@ namespace etl
   };
 #endif
 
-  typedef etl::crc32_t<256U> crc32_t256;
-  typedef etl::crc32_t<16U>  crc32_t16;
-  typedef etl::crc32_t<4U>   crc32_t4;
-  typedef crc32_t256         crc32;
+  typedef etl::crc32_t<4096U> crc32_t4096; ///< Slicing-by-16.
+  typedef etl::crc32_t<2048U> crc32_t2048; ///< Slicing-by-8.
+  typedef etl::crc32_t<256U>  crc32_t256;
+  typedef etl::crc32_t<16U>   crc32_t16;
+  typedef etl::crc32_t<4U>    crc32_t4;
+  typedef crc32_t256          crc32;
 } // namespace etl
 #endif
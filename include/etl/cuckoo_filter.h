@@ -0,0 +1,452 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CUCKOO_FILTER_INCLUDED
+#define ETL_CUCKOO_FILTER_INCLUDED
+
+#include "platform.h"
+#include "hash.h"
+#include "integral_limits.h"
+#include "log.h"
+#include "parameter_type.h"
+#include "power.h"
+#include "static_assert.h"
+#include "type_traits.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup cuckoo_filter cuckoo_filter
+/// A cuckoo filter
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// A fixed capacity cuckoo filter.
+  /// An approximate membership filter, like etl::bloom_filter, that also
+  /// allows keys to be removed.
+  /// Each key is stored as a fingerprint in one of the four slots of one of
+  /// two buckets. The second bucket is found from the first and the
+  /// fingerprint alone, so a fingerprint can be moved to make room for
+  /// another without knowing its key.
+  /// The number of buckets is a power of 2, sized so that Capacity keys fill
+  /// no more than 90% of the slots.
+  ///\tparam TKey         The key type.
+  ///\tparam Capacity     The number of keys that the filter is sized for.
+  ///\tparam THash        The hash generator class. Defaults to etl::hash<TKey>.
+  /// The result is mixed before it is used, so an identity hash may be used.
+  ///\tparam TFingerprint The unsigned type of the fingerprints. The false
+  /// positive rate is about 8 / 2^bits.
+  ///\ingroup cuckoo_filter
+  //***************************************************************************
+  template <typename TKey, size_t Capacity, typename THash = etl::hash<TKey>, typename TFingerprint = uint16_t>
+  class cuckoo_filter
+  {
+  private:
+
+    typedef typename etl::parameter_type<TKey>::type parameter_t;
+
+    ETL_STATIC_ASSERT(etl::is_unsigned<TFingerprint>::value, "TFingerprint must be an unsigned type");
+    ETL_STATIC_ASSERT(sizeof(TFingerprint) <= sizeof(uint32_t), "TFingerprint must be 32 bits or less");
+
+  public:
+
+    typedef TKey         key_type;
+    typedef TFingerprint fingerprint_type;
+
+    enum
+    {
+      BUCKET_SIZE = 4,
+      BUCKETS     = etl::power_of_2_round_up<((Capacity * 10) + 35) / 36>::value,
+      SLOTS       = BUCKETS * BUCKET_SIZE
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    cuckoo_filter()
+      : seed(1U)
+      , victim_fingerprint(Empty)
+      , victim_index(0U)
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Clears the filter of all entries.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < BUCKETS; ++i)
+      {
+        for (size_t j = 0U; j < BUCKET_SIZE; ++j)
+        {
+          buckets[i][j] = Empty;
+        }
+      }
+
+      stored        = 0U;
+      victim_stored = false;
+    }
+
+    //*************************************************************************
+    /// Adds a key to the filter.
+    /// Adding a key that is already present stores a second copy, so that
+    /// each add may be matched by a remove.
+    /// The add that fills the filter succeeds, but leaves a fingerprint that
+    /// it displaced aside. Further adds fail until a remove makes room for it.
+    ///\param key The key to add.
+    ///\return <b>true</b> if the key was added, <b>false</b> if the filter is
+    /// full.
+    //*************************************************************************
+    bool add(parameter_t key)
+    {
+      if (victim_stored)
+      {
+        return false;
+      }
+
+      const hash_t hash = get_hash(key);
+
+      place(get_index(hash), get_fingerprint(hash));
+      ++stored;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Tests a key to see if it exists in the filter.
+    ///\param  key The key to test.
+    ///\return <b>true</b> if the key may exist in the filter.
+    //*************************************************************************
+    bool exists(parameter_t key) const
+    {
+      const hash_t       hash        = get_hash(key);
+      const TFingerprint fingerprint = get_fingerprint(hash);
+      const size_t       index1      = get_index(hash);
+      const size_t       index2      = get_alternate_index(index1, fingerprint);
+
+      if (victim_stored && (victim_fingerprint == fingerprint) && ((victim_index == index1) || (victim_index == index2)))
+      {
+        return true;
+      }
+
+      return contains(index1, fingerprint) || contains(index2, fingerprint);
+    }
+
+    //*************************************************************************
+    /// Removes a key from the filter.
+    /// Only keys that have been added should be removed. Removing any other
+    /// key may remove a different key that shares its fingerprint.
+    ///\param key The key to remove.
+    ///\return <b>true</b> if a fingerprint for the key was found and removed.
+    //*************************************************************************
+    bool remove(parameter_t key)
+    {
+      const hash_t       hash        = get_hash(key);
+      const TFingerprint fingerprint = get_fingerprint(hash);
+      const size_t       index1      = get_index(hash);
+      const size_t       index2      = get_alternate_index(index1, fingerprint);
+
+      if (erase(index1, fingerprint) || erase(index2, fingerprint))
+      {
+        --stored;
+
+        // There is now a free slot, so the victim may fit.
+        if (victim_stored)
+        {
+          reinsert_victim();
+        }
+
+        return true;
+      }
+
+      if (victim_stored && (victim_fingerprint == fingerprint) && ((victim_index == index1) || (victim_index == index2)))
+      {
+        victim_stored = false;
+        --stored;
+
+        return true;
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Returns the number of fingerprint slots in the filter.
+    //*************************************************************************
+    size_t width() const
+    {
+      return SLOTS;
+    }
+
+    //*************************************************************************
+    /// Returns the percentage of usage. Range 0 to 100.
+    //*************************************************************************
+    size_t usage() const
+    {
+      return (100 * count()) / SLOTS;
+    }
+
+    //*************************************************************************
+    /// Returns the number of keys in the filter.
+    //*************************************************************************
+    size_t count() const
+    {
+      return stored;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the filter is full and no more keys can be
+    /// added until one is removed.
+    //*************************************************************************
+    bool full() const
+    {
+      return victim_stored;
+    }
+
+  private:
+
+    /// The maximum number of fingerprints moved by one add.
+    static ETL_CONSTANT size_t Max_Kicks = 500U;
+
+    /// Marks an empty slot. Fingerprints are never zero.
+    static ETL_CONSTANT TFingerprint Empty = 0U;
+
+    static ETL_CONSTANT size_t Fingerprint_Bits = etl::integral_limits<TFingerprint>::bits;
+
+#if ETL_USING_64BIT_TYPES
+    typedef uint64_t hash_t;
+#else
+    typedef uint32_t hash_t;
+#endif
+
+    static ETL_CONSTANT size_t Hash_Bits  = etl::integral_limits<hash_t>::bits;
+    static ETL_CONSTANT size_t Index_Bits = etl::log2<BUCKETS>::value;
+
+    // The index is taken from the lower bits of the hash and the fingerprint
+    // from the upper bits. If they shared bits, the fingerprints of the keys
+    // in a bucket would have fewer distinct values.
+    ETL_STATIC_ASSERT((Index_Bits + Fingerprint_Bits) <= Hash_Bits, "The bucket index and fingerprint bits overlap");
+
+    //*************************************************************************
+    /// Gets the mixed hash for the key.
+    //*************************************************************************
+    static hash_t get_hash(parameter_t key)
+    {
+#if ETL_USING_64BIT_TYPES
+      // The 64 bit MurmurHash3 finaliser.
+      uint64_t h = static_cast<uint64_t>(THash()(key));
+
+      h ^= h >> 33U;
+      h *= uint64_t(0xFF51AFD7ED558CCDULL);
+      h ^= h >> 33U;
+      h *= uint64_t(0xC4CEB9FE1A85EC53ULL);
+      h ^= h >> 33U;
+#else
+      size_t hash = THash()(key);
+
+      if (sizeof(size_t) > sizeof(uint32_t))
+      {
+        // Two shifts, as one of the full width is undefined for a 32 bit size_t.
+        hash ^= (hash >> 16U) >> 16U;
+      }
+
+      // The MurmurHash3 finaliser.
+      uint32_t h = static_cast<uint32_t>(hash);
+
+      h ^= h >> 16U;
+      h *= uint32_t(0x85EBCA6BUL);
+      h ^= h >> 13U;
+      h *= uint32_t(0xC2B2AE35UL);
+      h ^= h >> 16U;
+#endif
+
+      return h;
+    }
+
+    //*************************************************************************
+    /// Gets the fingerprint from the upper bits of the hash.
+    /// Zero is mapped to one, as it marks an empty slot.
+    //*************************************************************************
+    static TFingerprint get_fingerprint(hash_t hash)
+    {
+      const TFingerprint fingerprint = static_cast<TFingerprint>(hash >> (Hash_Bits - Fingerprint_Bits));
+
+      return (fingerprint == Empty) ? TFingerprint(1U) : fingerprint;
+    }
+
+    //*************************************************************************
+    /// Gets the first bucket from the lower bits of the hash.
+    //*************************************************************************
+    static size_t get_index(hash_t hash)
+    {
+      return static_cast<size_t>(hash) & (BUCKETS - 1U);
+    }
+
+    //*************************************************************************
+    /// Gets the other bucket for the fingerprint.
+    /// The mapping is its own inverse, so applies to either bucket.
+    //*************************************************************************
+    static size_t get_alternate_index(size_t index, TFingerprint fingerprint)
+    {
+      return (index ^ static_cast<size_t>(uint32_t(uint32_t(fingerprint) * uint32_t(0x5BD1E995UL)))) & (BUCKETS - 1U);
+    }
+
+    //*************************************************************************
+    /// Stores the fingerprint in an empty slot of the bucket.
+    //*************************************************************************
+    bool insert(size_t index, TFingerprint fingerprint)
+    {
+      for (size_t i = 0U; i < BUCKET_SIZE; ++i)
+      {
+        if (buckets[index][i] == Empty)
+        {
+          buckets[index][i] = fingerprint;
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Removes one copy of the fingerprint from the bucket.
+    //*************************************************************************
+    bool erase(size_t index, TFingerprint fingerprint)
+    {
+      for (size_t i = 0U; i < BUCKET_SIZE; ++i)
+      {
+        if (buckets[index][i] == fingerprint)
+        {
+          buckets[index][i] = Empty;
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Does the bucket contain the fingerprint?
+    //*************************************************************************
+    bool contains(size_t index, TFingerprint fingerprint) const
+    {
+      const TFingerprint* bucket = buckets[index];
+
+      return (bucket[0] == fingerprint) || (bucket[1] == fingerprint) || (bucket[2] == fingerprint) || (bucket[3] == fingerprint);
+    }
+
+    //*************************************************************************
+    /// Stores the fingerprint in one of its buckets.
+    /// When both buckets are full, fingerprints are moved to their alternate
+    /// buckets to make room. If that fails, the last fingerprint moved is kept
+    /// aside as the victim and the filter is full.
+    //*************************************************************************
+    void place(size_t index, TFingerprint fingerprint)
+    {
+      if (insert(index, fingerprint) || insert(get_alternate_index(index, fingerprint), fingerprint))
+      {
+        return;
+      }
+
+      // Move fingerprints along until one finds an empty slot.
+      index = ((next_random() & 1U) == 0U) ? index : get_alternate_index(index, fingerprint);
+
+      for (size_t kick = 0U; kick < Max_Kicks; ++kick)
+      {
+        TFingerprint& slot = buckets[index][next_random() % BUCKET_SIZE];
+
+        const TFingerprint evicted = slot;
+        slot                       = fingerprint;
+        fingerprint                = evicted;
+
+        index = get_alternate_index(index, fingerprint);
+
+        if (insert(index, fingerprint))
+        {
+          return;
+        }
+      }
+
+      victim_fingerprint = fingerprint;
+      victim_index       = index;
+      victim_stored      = true;
+    }
+
+    //*************************************************************************
+    /// Tries to move the victim back into the table, now that there is a
+    /// free slot.
+    //*************************************************************************
+    void reinsert_victim()
+    {
+      victim_stored = false;
+
+      place(victim_index, victim_fingerprint);
+    }
+
+    //*************************************************************************
+    /// A xorshift generator, to choose the fingerprints to move.
+    //*************************************************************************
+    uint32_t next_random()
+    {
+      seed ^= seed << 13U;
+      seed ^= seed >> 17U;
+      seed ^= seed << 5U;
+
+      return seed;
+    }
+
+    TFingerprint buckets[BUCKETS][BUCKET_SIZE];
+    size_t       stored;
+    uint32_t     seed;
+    TFingerprint victim_fingerprint;
+    size_t       victim_index;
+    bool         victim_stored;
+  };
+
+  template <typename TKey, size_t Capacity, typename THash, typename TFingerprint>
+  ETL_CONSTANT size_t cuckoo_filter<TKey, Capacity, THash, TFingerprint>::Max_Kicks;
+
+  template <typename TKey, size_t Capacity, typename THash, typename TFingerprint>
+  ETL_CONSTANT TFingerprint cuckoo_filter<TKey, Capacity, THash, TFingerprint>::Empty;
+
+  template <typename TKey, size_t Capacity, typename THash, typename TFingerprint>
+  ETL_CONSTANT size_t cuckoo_filter<TKey, Capacity, THash, TFingerprint>::Fingerprint_Bits;
+
+  template <typename TKey, size_t Capacity, typename THash, typename TFingerprint>
+  ETL_CONSTANT size_t cuckoo_filter<TKey, Capacity, THash, TFingerprint>::Hash_Bits;
+
+  template <typename TKey, size_t Capacity, typename THash, typename TFingerprint>
+  ETL_CONSTANT size_t cuckoo_filter<TKey, Capacity, THash, TFingerprint>::Index_Bits;
+} // namespace etl
+
+#endif
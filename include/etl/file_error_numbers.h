@@ -111,4 +111,7 @@ SOFTWARE.
 #define ETL_SIGNAL_FILE_ID                         "78"
 #define ETL_FORMAT_FILE_ID                         "79"
 #define ETL_INPLACE_FUNCTION_FILE_ID               "80"
+#define ETL_UNORDERED_FLAT_MAP_FILE_ID             "81"
+#define ETL_CONTIGUOUS_FLAT_FILE_ID                "82"
+#define ETL_BTREE_FILE_ID                          "83"
 #endif
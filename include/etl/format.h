@@ -37,6 +37,7 @@ SOFTWARE.
 #include "array.h"
 #include "array_view.h"
 #include "error_handler.h"
+#include "integral_limits.h"
 #include "limits.h"
 #include "math.h"
 #include "optional.h"
@@ -47,6 +48,8 @@ SOFTWARE.
 #include "utility.h"
 #include "variant.h"
 #include "visitor.h"
+#include "private/floating_point_digits.h"
+#include "private/integral_digits.h"
 
 #if ETL_USING_FORMAT_FLOATING_POINT
   #include <cmath>
@@ -794,34 +797,6 @@ namespace etl
 
   namespace private_format
   {
-    // for 4321, return 1000
-    template <typename UnsignedT, typename = etl::enable_if_t<etl::is_unsigned<UnsignedT>::value>>
-    UnsignedT get_highest_digit(UnsignedT value, size_t base = 10)
-    {
-      ETL_ASSERT(base > 1, ETL_ERROR(bad_format_string_exception));
-      UnsignedT result = 1;
-      value /= base;
-      while (result <= value)
-      {
-        result *= base;
-      }
-      return result;
-    }
-
-    template <typename T>
-    T int_pow(T base, T exp)
-    {
-      T result = 1;
-      while (exp > 0)
-      {
-        if (exp % 2 == 1)
-          result *= base;
-        base *= base;
-        exp /= 2;
-      }
-      return result;
-    }
-
     template <typename OutputIt, typename T>
     void format_sign(OutputIt& it, T value, const format_spec_t& spec)
     {
@@ -946,27 +921,6 @@ namespace etl
       return c >= 'A' && c <= 'Z';
     }
 
-    template <typename OutputIt, typename T>
-    void format_digit_char(OutputIt& it, T value, const format_spec_t& spec)
-    {
-      if (value <= 9)
-      {
-        *it = static_cast<char_type>('0' + static_cast<typename etl::make_unsigned<T>::type>(value));
-      }
-      else
-      {
-        if (spec.type.has_value() && is_uppercase(spec.type.value()))
-        {
-          *it = static_cast<char_type>('A' + static_cast<typename etl::make_unsigned<T>::type>(value - 10));
-        }
-        else
-        {
-          *it = static_cast<char_type>('a' + static_cast<typename etl::make_unsigned<T>::type>(value - 10));
-        }
-      }
-      ++it;
-    }
-
     inline void adjust_width_from_spec(const format_spec_t& spec, size_t& width)
     {
       if (spec.zero && spec.width.has_value())
@@ -994,30 +948,43 @@ namespace etl
 
       UnsignedT unsigned_value = etl::absolute_unsigned(value);
 
-      size_t    base          = base_from_spec<default_base>(spec);
-      UnsignedT highest_digit = get_highest_digit<UnsignedT>(unsigned_value, base);
-      if (width > 0)
+      const uint32_t base       = static_cast<uint32_t>(base_from_spec<default_base>(spec));
+      const bool     upper_case = spec.type.has_value() && is_uppercase(spec.type.value());
+
+      // the digits are written backwards, so no reversal is needed
+      char_type  buffer[etl::integral_limits<UnsignedT>::bits];
+      char_type* last  = buffer + etl::integral_limits<UnsignedT>::bits;
+      char_type* first = etl::private_integral_digits::write_digits(last, unsigned_value, base, upper_case);
+
+      if ETL_IF_CONSTEXPR (skip_last_zeros)
       {
-        UnsignedT align_highest_digit = int_pow<UnsignedT>(base, width - 1);
-        highest_digit                 = etl::max<UnsignedT>(align_highest_digit, highest_digit);
+        if (unsigned_value == 0)
+        {
+          format_plain_char(it, '0');
+          return;
+        }
       }
 
-      // this loop is iterated at least once, to print a number
-      while (highest_digit > 0)
+      const size_t digits = static_cast<size_t>(etl::distance(first, last));
+
+      if (width > digits)
       {
-        UnsignedT digit = unsigned_value / highest_digit;
-        unsigned_value %= highest_digit;
-        format_digit_char(it, digit, spec);
+        fill(it, width - digits, '0');
+      }
 
-        if ETL_IF_CONSTEXPR (skip_last_zeros)
+      if ETL_IF_CONSTEXPR (skip_last_zeros)
+      {
+        while (*(last - 1) == '0')
         {
-          if (unsigned_value == 0)
-          {
-            break;
-          }
+          --last;
         }
+      }
 
-        highest_digit /= base;
+      while (first != last)
+      {
+        *it = *first;
+        ++it;
+        ++first;
       }
     }
 
@@ -1034,33 +1001,58 @@ namespace etl
     }
 
   #if ETL_USING_FORMAT_FLOATING_POINT
+    // long double is formatted as double
+    template <typename T>
+    struct floating_digits_type
+    {
+      using type = double;
+    };
+
+    template <>
+    struct floating_digits_type<float>
+    {
+      using type = float;
+    };
+
+    inline size_t floating_precision(const format_spec_t& spec)
+    {
+      if (spec.precision.has_value() && !spec.precision_nested_replacement)
+      {
+        return spec.precision.value();
+      }
+
+      return 6; // default
+    }
+
+    template <typename OutputIt, typename T>
+    void format_floating_sign(OutputIt& it, T value, const format_spec_t& spec)
+    {
+      format_sign<OutputIt, int>(it, signbit(value) ? -1 : 0, spec);
+    }
+
+    // shortest representation that reads back as the same value,
+    // with at least one digit after the point
     template <typename OutputIt, typename T>
     void format_floating_default(OutputIt& it, T value, const format_spec_t& spec)
     {
-      const size_t fractional_decimals = 6; // default
+      using digits_type = typename floating_digits_type<T>::type;
 
-      T                      integral;
-      T                      fractional = modf(value, &integral);
-      bool                   sign;
-      unsigned long long int fractional_int;
-      unsigned long long int integral_int;
-      if (integral < 0.0)
+      const private_floating_point_digits::decimal d = private_floating_point_digits::to_shortest(static_cast<digits_type>(value));
+
+      const int digits = private_floating_point_digits::digit_count(d.significand);
+      const int point  = digits + d.exponent;
+
+      format_floating_sign(it, value, spec);
+
+      if ((point > -4) && (point <= 16))
       {
-        sign           = true;
-        fractional_int = static_cast<unsigned long long int>(-fractional * pow(10., fractional_decimals));
-        integral_int   = static_cast<unsigned long long int>(-integral);
+        const size_t places = (d.exponent < 0) ? static_cast<size_t>(-d.exponent) : 1U;
+        private_floating_point_digits::write_fixed(it, d, places, false);
       }
       else
       {
-        sign           = false;
-        fractional_int = static_cast<unsigned long long int>(fractional * pow(10., fractional_decimals));
-        integral_int   = static_cast<unsigned long long int>(integral);
+        private_floating_point_digits::write_scientific(it, d, point - 1, static_cast<size_t>(digits - 1), false, false);
       }
-
-      private_format::format_sign<OutputIt, int>(it, sign ? -1 : 0, spec);
-      private_format::format_plain_num<OutputIt, unsigned long long int>(it, integral_int, spec);
-      private_format::format_sequence<OutputIt>(it, ".");
-      private_format::format_plain_num<OutputIt, unsigned long long int, 10, true>(it, fractional_int, spec, fractional_decimals);
     }
 
     // floating point in hex notation
@@ -1129,85 +1121,29 @@ namespace etl
     template <typename OutputIt, typename T>
     void format_floating_e(OutputIt& it, T value, const format_spec_t& spec)
     {
-      static const size_t fractional_decimals = 6; // default
-      static const size_t exponent_decimals   = 2;
-      long long int       exponent_int        = 0;
+      using digits_type = typename floating_digits_type<T>::type;
 
-      bool                   sign;
-      unsigned long long int fractional_int;
-      unsigned long long int integral_int;
+      const size_t places = floating_precision(spec);
 
-      T integral;
-      T fractional = modf(value, &integral);
+      int                                                  exponent10;
+      const private_floating_point_digits::decimal_digits d =
+        private_floating_point_digits::to_precision(static_cast<digits_type>(value), static_cast<int>(places) + 1, exponent10);
 
-      while (value >= 10 || value <= -10)
-      {
-        ++exponent_int;
-        value /= 10;
-        fractional = modf(value, &integral);
-      }
-
-      while ((value > 0.0000000000001 && value < 1) || (value < -0.0000000000001 && value > -1))
-      {
-        --exponent_int;
-        value *= 10;
-        fractional = modf(value, &integral);
-      }
-
-      if (integral < 0.0)
-      {
-        sign           = true;
-        fractional_int = static_cast<unsigned long long int>(-fractional * pow(10., fractional_decimals));
-        integral_int   = static_cast<unsigned long long int>(-integral);
-      }
-      else
-      {
-        sign           = false;
-        fractional_int = static_cast<unsigned long long int>(fractional * pow(10., fractional_decimals));
-        integral_int   = static_cast<unsigned long long int>(integral);
-      }
-
-      private_format::format_sign<OutputIt, int>(it, sign ? -1 : 0, spec);
-      private_format::format_plain_num<OutputIt, unsigned long long int>(it, integral_int, spec);
-      private_format::format_sequence<OutputIt>(it, ".");
-      private_format::format_plain_num<OutputIt, unsigned long long int>(it, fractional_int, spec, fractional_decimals);
-      char letter = 'e';
-      if (is_uppercase(spec.type.value()))
-      {
-        letter = 'E';
-      }
-      private_format::format_plain_char<OutputIt>(it, letter);
-      private_format::format_plain_char<OutputIt>(it, (exponent_int < 0) ? '-' : '+');
-      private_format::format_plain_num<OutputIt, long long int>(it, exponent_int, spec, exponent_decimals);
+      format_floating_sign(it, value, spec);
+      private_floating_point_digits::write_scientific(it, d, exponent10, places, is_uppercase(spec.type.value()), spec.hash);
     }
 
     template <typename OutputIt, typename T>
     void format_floating_f(OutputIt& it, T value, const format_spec_t& spec)
     {
-      const size_t fractional_decimals = 6; // default
+      using digits_type = typename floating_digits_type<T>::type;
 
-      T                      integral;
-      T                      fractional = modf(value, &integral);
-      bool                   sign;
-      unsigned long long int fractional_int;
-      unsigned long long int integral_int;
-      if (integral < 0.0)
-      {
-        sign           = true;
-        fractional_int = static_cast<unsigned long long int>(-fractional * pow(10., fractional_decimals));
-        integral_int   = static_cast<unsigned long long int>(-integral);
-      }
-      else
-      {
-        sign           = false;
-        fractional_int = static_cast<unsigned long long int>(fractional * pow(10., fractional_decimals));
-        integral_int   = static_cast<unsigned long long int>(integral);
-      }
+      const size_t places = floating_precision(spec);
 
-      private_format::format_sign<OutputIt, int>(it, sign ? -1 : 0, spec);
-      private_format::format_plain_num<OutputIt, unsigned long long int>(it, integral_int, spec);
-      private_format::format_sequence<OutputIt>(it, ".");
-      private_format::format_plain_num<OutputIt, unsigned long long int>(it, fractional_int, spec, fractional_decimals);
+      const private_floating_point_digits::decimal_digits d = private_floating_point_digits::to_fixed(static_cast<digits_type>(value), static_cast<int>(places));
+
+      format_floating_sign(it, value, spec);
+      private_floating_point_digits::write_fixed(it, d, places, spec.hash);
     }
   #endif
 
@@ -1341,21 +1277,28 @@ namespace etl
     };
 
   #if ETL_USING_FORMAT_FLOATING_POINT
+    // the shorter of 'e' and 'f'
     template <typename OutputIt, typename T>
     void format_floating_g(OutputIt& it, T value, const format_spec_t& spec)
     {
-      private_format::counter_iterator counter_e, counter_f;
+      using digits_type = typename floating_digits_type<T>::type;
+
+      const size_t places = floating_precision(spec);
+
+      int                                                  exponent10;
+      const private_floating_point_digits::decimal_digits e =
+        private_floating_point_digits::to_precision(static_cast<digits_type>(value), static_cast<int>(places) + 1, exponent10);
+      const private_floating_point_digits::decimal_digits f = private_floating_point_digits::to_fixed(static_cast<digits_type>(value), static_cast<int>(places));
 
-      format_floating_e(counter_e, value, spec);
-      format_floating_f(counter_f, value, spec);
+      format_floating_sign(it, value, spec);
 
-      if (counter_e.value() < counter_f.value())
+      if (private_floating_point_digits::scientific_length(exponent10, places, spec.hash) < private_floating_point_digits::fixed_length(f, places, spec.hash))
       {
-        format_floating_e(it, value, spec);
+        private_floating_point_digits::write_scientific(it, e, exponent10, places, is_uppercase(spec.type.value()), spec.hash);
       }
       else
       {
-        format_floating_f(it, value, spec);
+        private_floating_point_digits::write_fixed(it, f, places, spec.hash);
       }
     }
 
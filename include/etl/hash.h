@@ -36,10 +36,12 @@ SOFTWARE.
 #if ETL_USING_8BIT_TYPES
 
   // The default hash calculation.
+  #include "binary.h"
   #include "fnv_1.h"
   #include "math.h"
   #include "static_assert.h"
   #include "type_traits.h"
+  #include "wyhash.h"
 
   #include <stdint.h>
   #include <stdlib.h>
@@ -87,6 +89,57 @@ namespace etl
     }
   #endif
 
+  #if ETL_USING_WYHASH_FOR_HASH && ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// Hash for strings, views, spans and blobs, when size_t is 16 bits.
+    /// Uses wyhash, folded to size_t.
+    /// T is always expected to be size_t.
+    //*************************************************************************
+    template <typename T>
+    typename enable_if<sizeof(T) == sizeof(uint16_t), size_t>::type buffer_hash(const uint8_t* begin, const uint8_t* end)
+    {
+      uint64_t h = etl::wyhash(begin, end).value();
+      h ^= (h >> 32U);
+
+      return static_cast<size_t>(h ^ (h >> 16U));
+    }
+
+    //*************************************************************************
+    /// Hash for strings, views, spans and blobs, when size_t is 32 bits.
+    /// Uses wyhash, folded to size_t.
+    /// T is always expected to be size_t.
+    //*************************************************************************
+    template <typename T>
+    typename enable_if<sizeof(T) == sizeof(uint32_t), size_t>::type buffer_hash(const uint8_t* begin, const uint8_t* end)
+    {
+      uint64_t h = etl::wyhash(begin, end).value();
+
+      return static_cast<size_t>(h ^ (h >> 32U));
+    }
+
+    //*************************************************************************
+    /// Hash for strings, views, spans and blobs, when size_t is 64 bits.
+    /// Uses wyhash.
+    /// T is always expected to be size_t.
+    //*************************************************************************
+    template <typename T>
+    typename enable_if<sizeof(T) == sizeof(uint64_t), size_t>::type buffer_hash(const uint8_t* begin, const uint8_t* end)
+    {
+      return static_cast<size_t>(etl::wyhash(begin, end).value());
+    }
+  #else
+    //*************************************************************************
+    /// Hash for strings, views, spans and blobs.
+    /// The same as generic_hash, unless ETL_USE_WYHASH_FOR_HASH is defined.
+    /// T is always expected to be size_t.
+    //*************************************************************************
+    template <typename T>
+    size_t buffer_hash(const uint8_t* begin, const uint8_t* end)
+    {
+      return generic_hash<T>(begin, end);
+    }
+  #endif
+
     //*************************************************************************
     /// Primary definition of base hash class, by default is poisoned
     //*************************************************************************
@@ -537,7 +590,202 @@ namespace etl
         }
       }
     };
+
+    //*************************************************************************
+    /// Fibonacci mix when size_t is 16 bits.
+    //*************************************************************************
+    template <typename T>
+    typename enable_if<sizeof(T) == sizeof(uint16_t), size_t>::type fibonacci_mix(size_t h)
+    {
+      uint32_t x = static_cast<uint32_t>(h);
+
+      x ^= x >> 16U;
+      x *= 0x9E3779B9UL;
+
+      return static_cast<size_t>(etl::reverse_bytes(x));
+    }
+
+    //*************************************************************************
+    /// Fibonacci mix when size_t is 32 bits.
+    //*************************************************************************
+    template <typename T>
+    typename enable_if<sizeof(T) == sizeof(uint32_t), size_t>::type fibonacci_mix(size_t h)
+    {
+      uint32_t x = static_cast<uint32_t>(h);
+
+      x ^= x >> 16U;
+      x *= 0x9E3779B9UL;
+
+      return static_cast<size_t>(etl::reverse_bytes(x));
+    }
+
+  #if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// Fibonacci mix when size_t is 64 bits.
+    //*************************************************************************
+    template <typename T>
+    typename enable_if<sizeof(T) == sizeof(uint64_t), size_t>::type fibonacci_mix(size_t h)
+    {
+      uint64_t x = static_cast<uint64_t>(h);
+
+      x ^= x >> 32U;
+      x *= 0x9E3779B97F4A7C15ULL;
+
+      return static_cast<size_t>(etl::reverse_bytes(x));
+    }
+  #endif
+
+    //*************************************************************************
+    /// Murmur3 'fmix32' finaliser.
+    //*************************************************************************
+    inline uint32_t murmur3_mix(uint32_t x)
+    {
+      x ^= x >> 16U;
+      x *= 0x85EBCA6BUL;
+      x ^= x >> 13U;
+      x *= 0xC2B2AE35UL;
+      x ^= x >> 16U;
+
+      return x;
+    }
+
+    //*************************************************************************
+    /// Murmur3 mix when size_t is 16 bits.
+    //*************************************************************************
+    template <typename T>
+    typename enable_if<sizeof(T) == sizeof(uint16_t), size_t>::type murmur3_mix(size_t h)
+    {
+      uint32_t x = murmur3_mix(static_cast<uint32_t>(h));
+
+      return static_cast<size_t>(x ^ (x >> 16U));
+    }
+
+    //*************************************************************************
+    /// Murmur3 mix when size_t is 32 bits.
+    //*************************************************************************
+    template <typename T>
+    typename enable_if<sizeof(T) == sizeof(uint32_t), size_t>::type murmur3_mix(size_t h)
+    {
+      return static_cast<size_t>(murmur3_mix(static_cast<uint32_t>(h)));
+    }
+
+  #if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// Murmur3 'fmix64' finaliser, when size_t is 64 bits.
+    //*************************************************************************
+    template <typename T>
+    typename enable_if<sizeof(T) == sizeof(uint64_t), size_t>::type murmur3_mix(size_t h)
+    {
+      uint64_t x = static_cast<uint64_t>(h);
+
+      x ^= x >> 33U;
+      x *= 0xFF51AFD7ED558CCDULL;
+      x ^= x >> 33U;
+      x *= 0xC4CEB9FE1A85EC53ULL;
+      x ^= x >> 33U;
+
+      return static_cast<size_t>(x);
+    }
+  #endif
   } // namespace private_hash
+
+  //***************************************************************************
+  /// Hash finaliser that returns the hash unchanged.
+  ///\ingroup hash
+  //***************************************************************************
+  struct identity_hash_finaliser
+  {
+    size_t operator()(size_t h) const
+    {
+      return h;
+    }
+  };
+
+  //***************************************************************************
+  /// Hash finaliser that folds the high half of the hash into the low half,
+  /// multiplies by 2^N / phi, then byte reverses the product so that its
+  /// best mixed high bits end up where a bucket mask or modulus looks.
+  /// A single multiply, but weaker than murmur3_hash_finaliser.
+  ///\ingroup hash
+  //***************************************************************************
+  struct fibonacci_hash_finaliser
+  {
+    size_t operator()(size_t h) const
+    {
+      return private_hash::fibonacci_mix<size_t>(h);
+    }
+  };
+
+  //***************************************************************************
+  /// Hash finaliser using the murmur3 xor-shift-multiply avalanche.
+  ///\ingroup hash
+  //***************************************************************************
+  struct murmur3_hash_finaliser
+  {
+    size_t operator()(size_t h) const
+    {
+      return private_hash::murmur3_mix<size_t>(h);
+    }
+  };
+
+  //***************************************************************************
+  /// Adapts a hash function by passing its result through a finaliser.
+  /// Useful for weak hashes, such as the identity etl::hash for integrals,
+  /// where keys that differ only in their high bits would otherwise share a
+  /// bucket, particularly when the number of buckets is a power of 2.
+  /// e.g. etl::unordered_map<uint64_t, T, 64, 64, etl::finalised_hash<etl::hash<uint64_t> > >
+  ///\ingroup hash
+  //***************************************************************************
+  template <typename THash, typename TFinaliser = etl::fibonacci_hash_finaliser>
+  class finalised_hash
+  {
+  public:
+
+    typedef THash      hasher;
+    typedef TFinaliser finaliser_type;
+
+    //*************************************************************************
+    finalised_hash()
+      : key_hash()
+      , finaliser()
+    {
+    }
+
+    //*************************************************************************
+    explicit finalised_hash(const THash& key_hash_, const TFinaliser& finaliser_ = TFinaliser())
+      : key_hash(key_hash_)
+      , finaliser(finaliser_)
+    {
+    }
+
+    //*************************************************************************
+    template <typename TKey>
+    size_t operator()(const TKey& key) const
+    {
+      return finaliser(static_cast<size_t>(key_hash(key)));
+    }
+
+    //*************************************************************************
+    /// Gets the underlying hash function.
+    //*************************************************************************
+    const THash& get_hash() const
+    {
+      return key_hash;
+    }
+
+    //*************************************************************************
+    /// Gets the finaliser.
+    //*************************************************************************
+    const TFinaliser& get_finaliser() const
+    {
+      return finaliser;
+    }
+
+  private:
+
+    THash      key_hash;
+    TFinaliser finaliser;
+  };
 } // namespace etl
 
   #include "private/diagnostic_pop.h"
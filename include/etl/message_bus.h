@@ -31,12 +31,15 @@ SOFTWARE.
 
 #include "platform.h"
 #include "algorithm.h"
+#include "binary.h"
 #include "error_handler.h"
 #include "exception.h"
+#include "integral_limits.h"
 #include "message.h"
 #include "message_router.h"
 #include "message_types.h"
 #include "nullptr.h"
+#include "span.h"
 #include "vector.h"
 
 #include <stdint.h>
@@ -102,6 +105,7 @@ namespace etl
             etl::upper_bound(router_list.begin(), router_list.end(), router.get_message_router_id(), compare_router_id());
 
           router_list.insert(irouter, &router);
+          rebuild_routing_index();
         }
       }
 
@@ -123,6 +127,7 @@ namespace etl
           etl::equal_range(router_list.begin(), router_list.end(), id, compare_router_id());
 
         router_list.erase(range.first, range.second);
+        rebuild_routing_index();
       }
     }
 
@@ -134,6 +139,7 @@ namespace etl
       if (irouter != router_list.end())
       {
         router_list.erase(irouter);
+        rebuild_routing_index();
       }
     }
 
@@ -149,6 +155,85 @@ namespace etl
       receive(etl::imessage_router::ALL_MESSAGE_ROUTERS, shared_msg);
     }
 
+    //*******************************************
+    /// Broadcasts each of the messages, in order.
+    //*******************************************
+    void receive(etl::span<etl::shared_message> shared_msgs)
+    {
+      receive(etl::imessage_router::ALL_MESSAGE_ROUTERS, shared_msgs);
+    }
+
+    //*******************************************
+    /// Sends each of the messages, in order, to the destination.
+    /// The destination routers and the message buses are found once for the
+    /// whole batch, so the subscriptions must not change while it is sent.
+    //*******************************************
+    void receive(etl::message_router_id_t destination_router_id, etl::span<etl::shared_message> shared_msgs)
+    {
+      // Message buses are always at the end of the list.
+      const router_list_t::iterator ibus =
+        etl::lower_bound(router_list.begin(), router_list.end(), etl::imessage_bus::MESSAGE_BUS, compare_router_id());
+
+      ETL_OR_STD::pair<router_list_t::iterator, router_list_t::iterator> range(ibus, ibus);
+
+      if (destination_router_id != etl::imessage_router::ALL_MESSAGE_ROUTERS)
+      {
+        // Find routers with the id.
+        range = etl::equal_range(router_list.begin(), router_list.end(), destination_router_id, compare_router_id());
+      }
+
+      for (etl::span<etl::shared_message>::iterator itr = shared_msgs.begin(); itr != shared_msgs.end(); ++itr)
+      {
+        const etl::shared_message& shared_msg = *itr;
+        const etl::message_id_t    id         = shared_msg.get_message().get_message_id();
+
+        if (destination_router_id == etl::imessage_router::ALL_MESSAGE_ROUTERS)
+        {
+          if (is_indexed(id))
+          {
+            // Only to the routers that accept it.
+            indexed_broadcast(id, shared_msg, ibus);
+          }
+          else
+          {
+            // Broadcast to everyone.
+            for (router_list_t::iterator irouter = router_list.begin(); irouter != router_list.end(); ++irouter)
+            {
+              if ((*irouter)->accepts(id))
+              {
+                (*irouter)->receive(shared_msg);
+              }
+            }
+          }
+        }
+        else
+        {
+          // Call all of the routers with the id.
+          for (router_list_t::iterator irouter = range.first; irouter != range.second; ++irouter)
+          {
+            if ((*irouter)->accepts(id))
+            {
+              (*irouter)->receive(shared_msg);
+            }
+          }
+
+          // Pass it on to any message buses.
+          for (router_list_t::iterator irouter = ibus; irouter != router_list.end(); ++irouter)
+          {
+            (*irouter)->receive(destination_router_id, shared_msg);
+          }
+        }
+
+        if (has_successor())
+        {
+          if (get_successor().accepts(id))
+          {
+            get_successor().receive(destination_router_id, shared_msg);
+          }
+        }
+      }
+    }
+
     //*******************************************
     virtual void receive(etl::message_router_id_t destination_router_id, const etl::imessage& message) ETL_OVERRIDE
     {
@@ -158,19 +243,27 @@ namespace etl
         // Broadcast to all routers.
         case etl::imessage_router::ALL_MESSAGE_ROUTERS:
           {
-            router_list_t::iterator irouter = router_list.begin();
-
-            // Broadcast to everyone.
-            while (irouter != router_list.end())
+            if (is_indexed(message.get_message_id()))
             {
-              etl::imessage_router& router = **irouter;
+              // Only to the routers that accept it.
+              indexed_broadcast(message.get_message_id(), message);
+            }
+            else
+            {
+              router_list_t::iterator irouter = router_list.begin();
 
-              if (router.accepts(message.get_message_id()))
+              // Broadcast to everyone.
+              while (irouter != router_list.end())
               {
-                router.receive(message);
-              }
+                etl::imessage_router& router = **irouter;
 
-              ++irouter;
+                if (router.accepts(message.get_message_id()))
+                {
+                  router.receive(message);
+                }
+
+                ++irouter;
+              }
             }
 
             break;
@@ -231,19 +324,27 @@ namespace etl
           // Broadcast to all routers.
         case etl::imessage_router::ALL_MESSAGE_ROUTERS:
           {
-            router_list_t::iterator irouter = router_list.begin();
-
-            // Broadcast to everyone.
-            while (irouter != router_list.end())
+            if (is_indexed(shared_msg.get_message().get_message_id()))
             {
-              etl::imessage_router& router = **irouter;
+              // Only to the routers that accept it.
+              indexed_broadcast(shared_msg.get_message().get_message_id(), shared_msg);
+            }
+            else
+            {
+              router_list_t::iterator irouter = router_list.begin();
 
-              if (router.accepts(shared_msg.get_message().get_message_id()))
+              // Broadcast to everyone.
+              while (irouter != router_list.end())
               {
-                router.receive(shared_msg);
-              }
+                etl::imessage_router& router = **irouter;
 
-              ++irouter;
+                if (router.accepts(shared_msg.get_message().get_message_id()))
+                {
+                  router.receive(shared_msg);
+                }
+
+                ++irouter;
+              }
             }
 
             break;
@@ -305,6 +406,22 @@ namespace etl
       // Check the list of subscribed routers.
       router_list_t::iterator irouter = router_list.begin();
 
+      if (is_indexed(id))
+      {
+        const uint32_t* row = routing_index + (size_t(id) * routing_index_words());
+
+        for (size_t i = 0U; i < routing_index_words(); ++i)
+        {
+          if (row[i] != 0U)
+          {
+            return true;
+          }
+        }
+
+        // Only the message buses are left to check.
+        irouter = etl::lower_bound(router_list.begin(), router_list.end(), etl::imessage_bus::MESSAGE_BUS, compare_router_id());
+      }
+
       while (irouter != router_list.end())
       {
         etl::imessage_router& router = **irouter;
@@ -339,6 +456,40 @@ namespace etl
     void clear()
     {
       router_list.clear();
+      rebuild_routing_index();
+    }
+
+    //*******************************************
+    /// Rebuilds the routing index from the subscribed routers.
+    /// The index is maintained by subscribe, unsubscribe and clear, and
+    /// assumes that the messages accepted by a router do not change while it
+    /// is subscribed. Call this if they do. Message buses are not indexed and
+    /// are always asked.
+    //*******************************************
+    void rebuild_routing_index()
+    {
+      if (routing_index != ETL_NULLPTR)
+      {
+        const size_t words = routing_index_words();
+
+        etl::fill_n(routing_index, routing_index_ids * words, uint32_t(0U));
+
+        for (size_t i = 0U; i < router_list.size(); ++i)
+        {
+          const etl::imessage_router& router = *router_list[i];
+
+          if (router.get_message_router_id() != etl::imessage_router::MESSAGE_BUS)
+          {
+            for (size_t id = 0U; id < routing_index_ids; ++id)
+            {
+              if (router.accepts(etl::message_id_t(id)))
+              {
+                routing_index[(id * words) + (i / 32U)] |= uint32_t(1U) << (i % 32U);
+              }
+            }
+          }
+        }
+      }
     }
 
     //********************************************
@@ -368,6 +519,8 @@ namespace etl
     imessage_bus(router_list_t& list)
       : imessage_router(etl::imessage_router::MESSAGE_BUS)
       , router_list(list)
+      , routing_index(ETL_NULLPTR)
+      , routing_index_ids(0U)
     {
     }
 
@@ -377,6 +530,34 @@ namespace etl
     imessage_bus(router_list_t& router_list_, etl::imessage_router& successor_)
       : imessage_router(etl::imessage_router::MESSAGE_BUS, successor_)
       , router_list(router_list_)
+      , routing_index(ETL_NULLPTR)
+      , routing_index_ids(0U)
+    {
+    }
+
+    //*******************************************
+    /// Constructor.
+    /// Broadcasts of message ids below routing_index_ids_ are routed through
+    /// the index.
+    //*******************************************
+    imessage_bus(router_list_t& router_list_, uint32_t* routing_index_, size_t routing_index_ids_)
+      : imessage_router(etl::imessage_router::MESSAGE_BUS)
+      , router_list(router_list_)
+      , routing_index(routing_index_)
+      , routing_index_ids(routing_index_ids_)
+    {
+    }
+
+    //*******************************************
+    /// Constructor.
+    /// Broadcasts of message ids below routing_index_ids_ are routed through
+    /// the index.
+    //*******************************************
+    imessage_bus(router_list_t& router_list_, uint32_t* routing_index_, size_t routing_index_ids_, etl::imessage_router& successor_)
+      : imessage_router(etl::imessage_router::MESSAGE_BUS, successor_)
+      , router_list(router_list_)
+      , routing_index(routing_index_)
+      , routing_index_ids(routing_index_ids_)
     {
     }
 
@@ -398,36 +579,136 @@ namespace etl
       }
     };
 
+    //*******************************************
+    /// Is the message id in the routing index?
+    //*******************************************
+    bool is_indexed(etl::message_id_t id) const
+    {
+      return (routing_index != ETL_NULLPTR) && (size_t(id) < routing_index_ids);
+    }
+
+    //*******************************************
+    /// The number of words in each message id's row of the routing index.
+    /// Each router has a bit, in the order of the router list.
+    //*******************************************
+    size_t routing_index_words() const
+    {
+      return (router_list.max_size() + 31U) / 32U;
+    }
+
+    //*******************************************
+    /// Broadcasts to the routers in the routing index that accept the message
+    /// id, then to any message buses, starting at ibus.
+    //*******************************************
+    template <typename TMessage>
+    void indexed_broadcast(etl::message_id_t id, const TMessage& message, router_list_t::iterator ibus)
+    {
+      const size_t    words = routing_index_words();
+      const uint32_t* row   = routing_index + (size_t(id) * words);
+
+      for (size_t word = 0U; word < words; ++word)
+      {
+        uint32_t bits = row[word];
+
+        while (bits != 0U)
+        {
+          router_list[(word * 32U) + etl::count_trailing_zeros(bits)]->receive(message);
+
+          bits &= bits - 1U;
+        }
+      }
+
+      while (ibus != router_list.end())
+      {
+        if ((*ibus)->accepts(id))
+        {
+          (*ibus)->receive(message);
+        }
+
+        ++ibus;
+      }
+    }
+
+    //*******************************************
+    /// Broadcasts to the routers in the routing index that accept the message
+    /// id, then to any message buses.
+    //*******************************************
+    template <typename TMessage>
+    void indexed_broadcast(etl::message_id_t id, const TMessage& message)
+    {
+      // Message buses are always at the end of the list.
+      indexed_broadcast(id, message, etl::lower_bound(router_list.begin(), router_list.end(), etl::imessage_bus::MESSAGE_BUS, compare_router_id()));
+    }
+
     router_list_t& router_list;
+    uint32_t*      routing_index;     ///< A row of router bits for each indexed message id, or null.
+    size_t         routing_index_ids; ///< The number of indexed message ids.
   };
 
+  namespace private_message_bus
+  {
+    //*************************************************************************
+    /// Storage for the routing index.
+    //*************************************************************************
+    template <size_t Size>
+    struct routing_index_storage
+    {
+      uint32_t* get()
+      {
+        return words;
+      }
+
+      uint32_t words[Size];
+    };
+
+    //*************************************************************************
+    /// No routing index.
+    //*************************************************************************
+    template <>
+    struct routing_index_storage<0U>
+    {
+      uint32_t* get()
+      {
+        return ETL_NULLPTR;
+      }
+    };
+  } // namespace private_message_bus
+
   //***************************************************************************
   /// The message bus
+  /// Broadcasts of message ids below INDEXED_MESSAGE_IDS_ only visit the
+  /// routers that accept them, found from a routing index of
+  /// INDEXED_MESSAGE_IDS_ * MAX_ROUTERS_ bits.
   //***************************************************************************
-  template <uint_least8_t MAX_ROUTERS_>
+  template <uint_least8_t MAX_ROUTERS_, size_t INDEXED_MESSAGE_IDS_ = 0U>
   class message_bus : public etl::imessage_bus
   {
   public:
 
+    ETL_STATIC_ASSERT((INDEXED_MESSAGE_IDS_ <= (size_t(etl::integral_limits<etl::message_id_t>::max) + 1U)), "Indexed message ids out of range");
+
     //*******************************************
     /// Constructor.
     //*******************************************
     message_bus()
-      : imessage_bus(router_list)
+      : imessage_bus(router_list, routing_index.get(), INDEXED_MESSAGE_IDS_)
     {
+      rebuild_routing_index();
     }
 
     //*******************************************
     /// Constructor.
     //*******************************************
     message_bus(etl::imessage_router& successor_)
-      : imessage_bus(router_list, successor_)
+      : imessage_bus(router_list, routing_index.get(), INDEXED_MESSAGE_IDS_, successor_)
     {
+      rebuild_routing_index();
     }
 
   private:
 
     etl::vector<etl::imessage_router*, MAX_ROUTERS_> router_list;
+    private_message_bus::routing_index_storage<INDEXED_MESSAGE_IDS_ * ((MAX_ROUTERS_ + 31U) / 32U)> routing_index;
   };
 } // namespace etl
 
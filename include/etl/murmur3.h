@@ -36,6 +36,7 @@ SOFTWARE.
 #include "error_handler.h"
 #include "ihash.h"
 #include "iterator.h"
+#include "type_traits.h"
 
 #include <stdint.h>
 
@@ -89,20 +90,7 @@ namespace etl
       ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
 
       reset();
-      while (begin != end)
-      {
-        block |= static_cast<value_type>(static_cast<value_type>(*begin) << (block_fill_count * 8U));
-        ++begin;
-
-        if (++block_fill_count == FULL_BLOCK)
-        {
-          add_block();
-          block_fill_count = 0;
-          block            = 0;
-        }
-
-        ++char_count;
-      }
+      add_range(begin, end, etl::integral_constant<bool, etl::is_pointer<TIterator>::value>());
     }
 
     //*************************************************************************
@@ -128,20 +116,7 @@ namespace etl
       ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
       ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
 
-      while (begin != end)
-      {
-        block |= static_cast<value_type>(static_cast<value_type>(*begin) << (block_fill_count * 8U));
-        ++begin;
-
-        if (++block_fill_count == FULL_BLOCK)
-        {
-          add_block();
-          block_fill_count = 0;
-          block            = 0;
-        }
-
-        ++char_count;
-      }
+      add_range(begin, end, etl::integral_constant<bool, etl::is_pointer<TIterator>::value>());
     }
 
     //*************************************************************************
@@ -154,16 +129,7 @@ namespace etl
       // We can't add to a finalised hash!
       ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
 
-      block |= static_cast<value_type>(static_cast<value_type>(value_) << (block_fill_count * 8U));
-
-      if (++block_fill_count == FULL_BLOCK)
-      {
-        add_block();
-        block_fill_count = 0;
-        block            = 0;
-      }
-
-      ++char_count;
+      add_byte(value_);
     }
 
     //*************************************************************************
@@ -185,6 +151,82 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Adds a range from a non-contiguous iterator, one byte at a time.
+    //*************************************************************************
+    template <typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::false_type)
+    {
+      while (begin != end)
+      {
+        add_byte(static_cast<uint8_t>(*begin));
+        ++begin;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous range, a whole block at a time where possible.
+    //*************************************************************************
+    template <typename TPointer>
+    void add_range(TPointer begin, const TPointer end, etl::true_type)
+    {
+      const uint8_t* p     = reinterpret_cast<const uint8_t*>(begin);
+      const uint8_t* p_end = reinterpret_cast<const uint8_t*>(end);
+
+      // Complete any partially filled block.
+      while ((block_fill_count != 0U) && (p != p_end))
+      {
+        add_byte(*p);
+        ++p;
+      }
+
+      // Whole blocks.
+      while (static_cast<size_t>(p_end - p) >= FULL_BLOCK)
+      {
+        block = read_block(p);
+        add_block();
+        block = 0;
+
+        p += FULL_BLOCK;
+        char_count += FULL_BLOCK;
+      }
+
+      // The tail.
+      while (p != p_end)
+      {
+        add_byte(*p);
+        ++p;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a single byte to the current block.
+    //*************************************************************************
+    void add_byte(uint8_t value_)
+    {
+      block |= static_cast<value_type>(static_cast<value_type>(value_) << (block_fill_count * 8U));
+
+      if (++block_fill_count == FULL_BLOCK)
+      {
+        add_block();
+        block_fill_count = 0;
+        block            = 0;
+      }
+
+      ++char_count;
+    }
+
+    //*************************************************************************
+    /// Reads a little endian block, independent of the alignment of the data
+    /// and the endianness of the platform.
+    /// Compilers reduce this to a single load where the platform allows.
+    //*************************************************************************
+    static value_type read_block(const uint8_t* p)
+    {
+      return static_cast<value_type>(static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8U) | (static_cast<uint32_t>(p[2]) << 16U)
+                                     | (static_cast<uint32_t>(p[3]) << 24U));
+    }
+
     //*************************************************************************
     /// Adds a filled block to the hash.
     //*************************************************************************
@@ -295,6 +295,70 @@ SOFTWARE.
   #define ETL_USING_LEGACY_BITSET 0
 #endif
 
+//*************************************
+// Indicate if etl::hash uses wyhash for strings and blobs.
+#if defined(ETL_USE_WYHASH_FOR_HASH) && ETL_USING_64BIT_TYPES
+  #define ETL_USING_WYHASH_FOR_HASH 1
+#else
+  #define ETL_USING_WYHASH_FOR_HASH 0
+#endif
+
+//*************************************
+// Indicate if the crc32 instruction is used for the slicing etl::crc32_c types.
+#if defined(ETL_USE_CRC32C_INSTRUCTIONS) && (defined(__SSE4_2__) || defined(__AVX__))
+  #define ETL_USING_CRC32C_INSTRUCTIONS 1
+#else
+  #define ETL_USING_CRC32C_INSTRUCTIONS 0
+#endif
+
+//*************************************
+// Indicate if the base64 decoders use SSSE3 for contiguous input.
+#if defined(ETL_USE_BASE64_SSSE3) && defined(__SSSE3__)
+  #define ETL_USING_BASE64_SSSE3 1
+#else
+  #define ETL_USING_BASE64_SSSE3 0
+#endif
+
+//*************************************
+// Indicate if the multi element bitsets use SSE2, or AVX2 if available,
+// for the bulk operations.
+#if defined(ETL_USE_BITSET_SIMD) && (defined(__SSE2__) || defined(__AVX2__))
+  #define ETL_USING_BITSET_SIMD 1
+#else
+  #define ETL_USING_BITSET_SIMD 0
+#endif
+
+//*************************************
+// Indicate if the blocked bloom filter uses AVX2 for the in-block bit tests.
+#if defined(ETL_USE_BLOOM_FILTER_AVX2) && defined(__AVX2__)
+  #define ETL_USING_BLOOM_FILTER_AVX2 1
+#else
+  #define ETL_USING_BLOOM_FILTER_AVX2 0
+#endif
+
+//*************************************
+// Indicate if the string and string_view substring searches use SSE2.
+#if defined(ETL_USE_STRING_SEARCH_SSE2) && defined(__SSE2__)
+  #define ETL_USING_STRING_SEARCH_SSE2 1
+#else
+  #define ETL_USING_STRING_SEARCH_SSE2 0
+#endif
+
+//*************************************
+// Indicate if the B-tree containers use SSE2 to search nodes of 32 bit keys.
+#if defined(ETL_USE_BTREE_SSE2) && defined(__SSE2__)
+  #define ETL_USING_BTREE_SSE2 1
+#else
+  #define ETL_USING_BTREE_SSE2 0
+#endif
+
+//*************************************
+// The size of a cache line, in bytes.
+// Used to keep data written by different threads on separate cache lines.
+#if !defined(ETL_CACHE_LINE_SIZE)
+  #define ETL_CACHE_LINE_SIZE 64
+#endif
+
 //*************************************
 // Indicate if array_view is mutable.
 #if defined(ETL_ARRAY_VIEW_IS_MUTABLE)
@@ -662,6 +726,13 @@ namespace etl
     static ETL_CONSTANT bool using_texas_instruments_compiler = (ETL_USING_TEXAS_INSTRUMENTS_COMPILER == 1);
     static ETL_CONSTANT bool using_generic_compiler           = (ETL_USING_GENERIC_COMPILER == 1);
     static ETL_CONSTANT bool using_legacy_bitset              = (ETL_USING_LEGACY_BITSET == 1);
+    static ETL_CONSTANT bool using_wyhash_for_hash            = (ETL_USING_WYHASH_FOR_HASH == 1);
+    static ETL_CONSTANT bool using_crc32c_instructions        = (ETL_USING_CRC32C_INSTRUCTIONS == 1);
+    static ETL_CONSTANT bool using_base64_ssse3               = (ETL_USING_BASE64_SSSE3 == 1);
+    static ETL_CONSTANT bool using_bitset_simd                = (ETL_USING_BITSET_SIMD == 1);
+    static ETL_CONSTANT bool using_bloom_filter_avx2          = (ETL_USING_BLOOM_FILTER_AVX2 == 1);
+    static ETL_CONSTANT bool using_btree_sse2                 = (ETL_USING_BTREE_SSE2 == 1);
+    static ETL_CONSTANT bool using_string_search_sse2         = (ETL_USING_STRING_SEARCH_SSE2 == 1);
     static ETL_CONSTANT bool using_exceptions                 = (ETL_USING_EXCEPTIONS == 1);
     static ETL_CONSTANT bool using_libc_wchar_h               = (ETL_USING_LIBC_WCHAR_H == 1);
     static ETL_CONSTANT bool using_std_exception              = (ETL_USING_STD_EXCEPTION == 1);
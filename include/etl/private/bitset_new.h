@@ -51,6 +51,14 @@ SOFTWARE.
 #include <stdint.h>
 #include <string.h>
 
+#if ETL_USING_BITSET_SIMD
+  #if defined(__AVX2__)
+    #include <immintrin.h>
+  #else
+    #include <emmintrin.h>
+  #endif
+#endif
+
 #if ETL_USING_STL
   #include <algorithm>
 #endif
@@ -188,6 +196,251 @@ namespace etl
 
     template <typename TElement>
     ETL_CONSTANT TElement bitset_impl_common<TElement>::All_Clear_Element;
+
+#if ETL_USING_BITSET_SIMD
+    //*************************************************************************
+    /// Bulk operations on the whole vectors of a multi element buffer.
+    /// Each returns the number of bytes processed, leaving the remainder to
+    /// the element loops.
+    //*************************************************************************
+    struct bitset_simd
+    {
+  #if defined(__AVX2__)
+      typedef __m256i vector_type;
+
+      static vector_type load(const unsigned char* p)
+      {
+        return _mm256_loadu_si256(reinterpret_cast<const vector_type*>(p));
+      }
+
+      static void store(unsigned char* p, vector_type v)
+      {
+        _mm256_storeu_si256(reinterpret_cast<vector_type*>(p), v);
+      }
+
+      static vector_type bitwise_and(vector_type a, vector_type b)
+      {
+        return _mm256_and_si256(a, b);
+      }
+
+      static vector_type bitwise_or(vector_type a, vector_type b)
+      {
+        return _mm256_or_si256(a, b);
+      }
+
+      static vector_type bitwise_xor(vector_type a, vector_type b)
+      {
+        return _mm256_xor_si256(a, b);
+      }
+
+      static vector_type all_set()
+      {
+        return _mm256_set1_epi32(-1);
+      }
+
+      static vector_type zero()
+      {
+        return _mm256_setzero_si256();
+      }
+
+      static bool is_zero(vector_type v)
+      {
+        return _mm256_testz_si256(v, v) != 0;
+      }
+
+      static vector_type add_64(vector_type a, vector_type b)
+      {
+        return _mm256_add_epi64(a, b);
+      }
+
+      //***********************************
+      /// The number of bits set in each 64 bit lane.
+      /// Looks up the count for each nibble.
+      //***********************************
+      static vector_type count_bits(vector_type v)
+      {
+        const vector_type lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const vector_type nibble = _mm256_set1_epi8(0x0F);
+
+        const vector_type low  = _mm256_shuffle_epi8(lookup, _mm256_and_si256(v, nibble));
+        const vector_type high = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble));
+
+        return _mm256_sad_epu8(_mm256_add_epi8(low, high), zero());
+      }
+  #else
+      typedef __m128i vector_type;
+
+      static vector_type load(const unsigned char* p)
+      {
+        return _mm_loadu_si128(reinterpret_cast<const vector_type*>(p));
+      }
+
+      static void store(unsigned char* p, vector_type v)
+      {
+        _mm_storeu_si128(reinterpret_cast<vector_type*>(p), v);
+      }
+
+      static vector_type bitwise_and(vector_type a, vector_type b)
+      {
+        return _mm_and_si128(a, b);
+      }
+
+      static vector_type bitwise_or(vector_type a, vector_type b)
+      {
+        return _mm_or_si128(a, b);
+      }
+
+      static vector_type bitwise_xor(vector_type a, vector_type b)
+      {
+        return _mm_xor_si128(a, b);
+      }
+
+      static vector_type all_set()
+      {
+        return _mm_set1_epi32(-1);
+      }
+
+      static vector_type zero()
+      {
+        return _mm_setzero_si128();
+      }
+
+      static bool is_zero(vector_type v)
+      {
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(v, zero())) == 0xFFFF;
+      }
+
+      static vector_type add_64(vector_type a, vector_type b)
+      {
+        return _mm_add_epi64(a, b);
+      }
+
+      //***********************************
+      /// The number of bits set in each 64 bit lane.
+      /// SSE2 has no byte shuffle, so the bytes are counted in parallel.
+      //***********************************
+      static vector_type count_bits(vector_type v)
+      {
+        const vector_type m1 = _mm_set1_epi8(0x55);
+        const vector_type m2 = _mm_set1_epi8(0x33);
+        const vector_type m4 = _mm_set1_epi8(0x0F);
+
+        v = _mm_sub_epi8(v, _mm_and_si128(_mm_srli_epi64(v, 1), m1));
+        v = _mm_add_epi8(_mm_and_si128(v, m2), _mm_and_si128(_mm_srli_epi64(v, 2), m2));
+        v = _mm_and_si128(_mm_add_epi8(v, _mm_srli_epi64(v, 4)), m4);
+
+        return _mm_sad_epu8(v, zero());
+      }
+  #endif
+
+      //***********************************
+      static size_t operator_and(void* lhs, const void* rhs, size_t length)
+      {
+        unsigned char*       plhs = static_cast<unsigned char*>(lhs);
+        const unsigned char* prhs = static_cast<const unsigned char*>(rhs);
+
+        size_t i = 0U;
+
+        for (; (i + sizeof(vector_type)) <= length; i += sizeof(vector_type))
+        {
+          store(plhs + i, bitwise_and(load(plhs + i), load(prhs + i)));
+        }
+
+        return i;
+      }
+
+      //***********************************
+      static size_t operator_or(void* lhs, const void* rhs, size_t length)
+      {
+        unsigned char*       plhs = static_cast<unsigned char*>(lhs);
+        const unsigned char* prhs = static_cast<const unsigned char*>(rhs);
+
+        size_t i = 0U;
+
+        for (; (i + sizeof(vector_type)) <= length; i += sizeof(vector_type))
+        {
+          store(plhs + i, bitwise_or(load(plhs + i), load(prhs + i)));
+        }
+
+        return i;
+      }
+
+      //***********************************
+      static size_t operator_xor(void* lhs, const void* rhs, size_t length)
+      {
+        unsigned char*       plhs = static_cast<unsigned char*>(lhs);
+        const unsigned char* prhs = static_cast<const unsigned char*>(rhs);
+
+        size_t i = 0U;
+
+        for (; (i + sizeof(vector_type)) <= length; i += sizeof(vector_type))
+        {
+          store(plhs + i, bitwise_xor(load(plhs + i), load(prhs + i)));
+        }
+
+        return i;
+      }
+
+      //***********************************
+      static size_t operator_not(void* buffer, size_t length)
+      {
+        unsigned char* p = static_cast<unsigned char*>(buffer);
+
+        size_t i = 0U;
+
+        for (; (i + sizeof(vector_type)) <= length; i += sizeof(vector_type))
+        {
+          store(p + i, bitwise_xor(load(p + i), all_set()));
+        }
+
+        return i;
+      }
+
+      //***********************************
+      /// Adds the number of bits set to 'total'.
+      //***********************************
+      static size_t count(const void* buffer, size_t length, size_t& total)
+      {
+        const unsigned char* p = static_cast<const unsigned char*>(buffer);
+
+        vector_type sums = zero();
+
+        size_t i = 0U;
+
+        for (; (i + sizeof(vector_type)) <= length; i += sizeof(vector_type))
+        {
+          sums = add_64(sums, count_bits(load(p + i)));
+        }
+
+        uint64_t lanes[sizeof(vector_type) / sizeof(uint64_t)];
+        memcpy(lanes, &sums, sizeof(lanes));
+
+        for (size_t lane = 0U; lane < (sizeof(vector_type) / sizeof(uint64_t)); ++lane)
+        {
+          total += static_cast<size_t>(lanes[lane]);
+        }
+
+        return i;
+      }
+
+      //***********************************
+      /// Skips the vectors with no bits set.
+      //***********************************
+      static size_t skip_clear(const void* buffer, size_t length)
+      {
+        const unsigned char* p = static_cast<const unsigned char*>(buffer);
+
+        size_t i = 0U;
+
+        while (((i + sizeof(vector_type)) <= length) && is_zero(load(p + i)))
+        {
+          i += sizeof(vector_type);
+        }
+
+        return i;
+      }
+    };
+#endif
   } // namespace private_bitset
 
   //*************************************************************************
@@ -571,9 +824,13 @@ namespace etl
       // Check that the string type can contain the digits.
       ETL_ASSERT_OR_RETURN_VALUE(result.size() == active_bits, ETL_ERROR(etl::bitset_string_too_small), result);
 
+      // Shift the bits out of the element, writing from the end of the string.
+      element_type value = *pbuffer;
+
       for (size_t i = active_bits; i > 0; --i)
       {
-        result[active_bits - i] = test(pbuffer, i - 1) ? one : zero;
+        result[i - 1] = ((value & 1U) != 0U) ? one : zero;
+        value         = element_type(value >> 1U);
       }
 
       return result;
@@ -590,26 +847,17 @@ namespace etl
     {
       if (position < active_bits)
       {
-        // Where to start.
-        size_t bit = position;
-
-        element_type mask = 1U << position;
+        // Search for set bits, inverting the element to search for clear bits.
+        const element_type invert = state ? All_Clear_Element : All_Set_Element;
+        const element_type value  = element_type((*pbuffer ^ invert) & element_type(All_Set_Element << position));
 
-        // Needs checking?
-        if ((state && (*pbuffer != All_Clear_Element)) || (!state && (*pbuffer != All_Set_Element)))
+        if (value != All_Clear_Element)
         {
-          // For each bit in the element...
-          while (bit < active_bits)
+          const size_t bit = etl::count_trailing_zeros(value);
+
+          if (bit < active_bits)
           {
-            // Equal to the required state?
-            if (((*pbuffer & mask) != 0) == state)
-            {
-              return bit;
-            }
-
-            // Move on to the next bit.
-            mask <<= 1;
-            ++bit;
+            return bit;
           }
         }
       }
@@ -617,6 +865,24 @@ namespace etl
       return npos;
     }
 
+    //*************************************************************************
+    /// Calls the function with the position of each set bit, in ascending
+    /// order.
+    //*************************************************************************
+    template <typename TFunction>
+    static ETL_CONSTEXPR14 TFunction for_each_set_bit(const_pointer pbuffer, size_t /*number_of_elements*/, TFunction function)
+    {
+      element_type value = *pbuffer;
+
+      while (value != All_Clear_Element)
+      {
+        function(size_t(etl::count_trailing_zeros(value)));
+        value = element_type(value & (value - 1U));
+      }
+
+      return function;
+    }
+
     //*************************************************************************
     /// operator assignment
     /// Assigns rhs to lhs
@@ -773,6 +1039,15 @@ namespace etl
     {
       size_t count = 0;
 
+#if ETL_USING_BITSET_SIMD
+      if (!etl::is_constant_evaluated())
+      {
+        const size_t processed = etl::private_bitset::bitset_simd::count(pbuffer, number_of_elements * sizeof(element_type), count) / sizeof(element_type);
+        pbuffer += processed;
+        number_of_elements -= processed;
+      }
+#endif
+
       while (number_of_elements-- != 0)
       {
         count += etl::count_bits(*pbuffer++);
@@ -809,6 +1084,15 @@ namespace etl
     //*************************************************************************
     static ETL_CONSTEXPR14 bool none(const_pointer pbuffer, size_t number_of_elements) ETL_NOEXCEPT
     {
+#if ETL_USING_BITSET_SIMD
+      if (!etl::is_constant_evaluated())
+      {
+        const size_t processed = etl::private_bitset::bitset_simd::skip_clear(pbuffer, number_of_elements * sizeof(element_type)) / sizeof(element_type);
+        pbuffer += processed;
+        number_of_elements -= processed;
+      }
+#endif
+
       while (number_of_elements-- != 0)
       {
         if (*pbuffer++ != 0)
@@ -827,6 +1111,15 @@ namespace etl
     {
       bool any_set = false;
 
+#if ETL_USING_BITSET_SIMD
+      if (!etl::is_constant_evaluated())
+      {
+        const size_t processed = etl::private_bitset::bitset_simd::skip_clear(pbuffer, number_of_elements * sizeof(element_type)) / sizeof(element_type);
+        pbuffer += processed;
+        number_of_elements -= processed;
+      }
+#endif
+
       while (number_of_elements-- != 0)
       {
         if (*pbuffer++ != All_Clear_Element)
@@ -1259,47 +1552,60 @@ namespace etl
       ETL_NOEXCEPT
     {
       // Where to start.
-      size_t index = position >> log2<Bits_Per_Element>::value;
-      size_t bit   = position & (Bits_Per_Element - 1);
+      size_t index = position >> etl::log2<Bits_Per_Element>::value;
+
+      if (index >= number_of_elements)
+      {
+        return npos;
+      }
+
+      // Search for set bits, inverting the elements to search for clear bits.
+      const element_type invert = state ? All_Clear_Element : All_Set_Element;
 
-      element_type mask = 1 << bit;
+      // The first element is masked to the bits at or above the position.
+      element_type value = element_type((pbuffer[index] ^ invert) & element_type(All_Set_Element << (position & (Bits_Per_Element - 1))));
 
-      // For each element in the bitset...
-      while (index < number_of_elements)
+      // Skip the elements with no bits in the required state.
+      while (value == All_Clear_Element)
+      {
+        if (++index == number_of_elements)
+        {
+          return npos;
+        }
+
+        value = element_type(pbuffer[index] ^ invert);
+      }
+
+      position = (index << etl::log2<Bits_Per_Element>::value) + etl::count_trailing_zeros(value);
+
+      // The unused bits of the last element are clear, so may be found when searching for clear bits.
+      return (position < total_bits) ? position : npos;
+    }
+
+    //*************************************************************************
+    /// Calls the function with the position of each set bit, in ascending
+    /// order.
+    //*************************************************************************
+    template <typename TFunction>
+    static ETL_CONSTEXPR14 TFunction for_each_set_bit(const_pointer pbuffer, size_t number_of_elements, TFunction function)
+    {
+      for (size_t index = 0U; index < number_of_elements; ++index)
       {
         element_type value = pbuffer[index];
 
-        // Needs checking?
-        if ((state && (value != All_Clear_Element)) || (!state && (value != All_Set_Element)))
+        if (value != All_Clear_Element)
         {
-          // For each bit in the element...
-          while ((bit < Bits_Per_Element) && (position < total_bits))
+          const size_t first = index << etl::log2<Bits_Per_Element>::value;
+
+          do
           {
-            // Equal to the required state?
-            if (((value & mask) != 0) == state)
-            {
-              return position;
-            }
-
-            // Move on to the next bit.
-            mask <<= 1;
-            ++position;
-            ++bit;
-          }
-        }
-        else
-        {
-          position += (Bits_Per_Element - bit);
+            function(first + etl::count_trailing_zeros(value));
+            value = element_type(value & (value - 1U));
+          } while (value != All_Clear_Element);
         }
-
-        // Start at the beginning for all other elements.
-        bit  = 0;
-        mask = 1;
-
-        ++index;
       }
 
-      return npos;
+      return function;
     }
 
     //*************************************************************************
@@ -1315,9 +1621,20 @@ namespace etl
       // Check that the string type can contain the digits.
       ETL_ASSERT_OR_RETURN_VALUE(result.size() == active_bits, ETL_ERROR(etl::bitset_string_too_small), result);
 
-      for (size_t i = active_bits; i > 0; --i)
+      // Shift the bits out of each element in turn, writing from the end of the string.
+      size_t i = active_bits;
+
+      while (i > 0)
       {
-        result[active_bits - i] = test(pbuffer, i - 1) ? one : zero;
+        element_type value = *pbuffer++;
+
+        const size_t bits = (i < Bits_Per_Element) ? i : Bits_Per_Element;
+
+        for (size_t bit = 0; bit < bits; ++bit)
+        {
+          result[--i] = ((value & 1U) != 0U) ? one : zero;
+          value       = element_type(value >> 1U);
+        }
       }
 
       return result;
@@ -1341,6 +1658,16 @@ namespace etl
     //*************************************************************************
     static ETL_CONSTEXPR14 void operator_and(pointer lhs_pbuffer, const_pointer rhs_pbuffer, size_t number_of_elements) ETL_NOEXCEPT
     {
+#if ETL_USING_BITSET_SIMD
+      if (!etl::is_constant_evaluated())
+      {
+        const size_t processed = etl::private_bitset::bitset_simd::operator_and(lhs_pbuffer, rhs_pbuffer, number_of_elements * sizeof(element_type)) / sizeof(element_type);
+        lhs_pbuffer += processed;
+        rhs_pbuffer += processed;
+        number_of_elements -= processed;
+      }
+#endif
+
       while (number_of_elements-- != 0)
       {
         *lhs_pbuffer &= *rhs_pbuffer;
@@ -1354,6 +1681,16 @@ namespace etl
     //*************************************************************************
     static ETL_CONSTEXPR14 void operator_or(pointer lhs_pbuffer, const_pointer rhs_pbuffer, size_t number_of_elements) ETL_NOEXCEPT
     {
+#if ETL_USING_BITSET_SIMD
+      if (!etl::is_constant_evaluated())
+      {
+        const size_t processed = etl::private_bitset::bitset_simd::operator_or(lhs_pbuffer, rhs_pbuffer, number_of_elements * sizeof(element_type)) / sizeof(element_type);
+        lhs_pbuffer += processed;
+        rhs_pbuffer += processed;
+        number_of_elements -= processed;
+      }
+#endif
+
       while (number_of_elements-- != 0)
       {
         *lhs_pbuffer |= *rhs_pbuffer;
@@ -1367,6 +1704,16 @@ namespace etl
     //*************************************************************************
     static ETL_CONSTEXPR14 void operator_xor(pointer lhs_pbuffer, const_pointer rhs_pbuffer, size_t number_of_elements) ETL_NOEXCEPT
     {
+#if ETL_USING_BITSET_SIMD
+      if (!etl::is_constant_evaluated())
+      {
+        const size_t processed = etl::private_bitset::bitset_simd::operator_xor(lhs_pbuffer, rhs_pbuffer, number_of_elements * sizeof(element_type)) / sizeof(element_type);
+        lhs_pbuffer += processed;
+        rhs_pbuffer += processed;
+        number_of_elements -= processed;
+      }
+#endif
+
       while (number_of_elements-- != 0)
       {
         *lhs_pbuffer ^= *rhs_pbuffer;
@@ -1380,6 +1727,15 @@ namespace etl
     //*************************************************************************
     static ETL_CONSTEXPR14 void operator_not(pointer pbuffer, size_t number_of_elements) ETL_NOEXCEPT
     {
+#if ETL_USING_BITSET_SIMD
+      if (!etl::is_constant_evaluated())
+      {
+        const size_t processed = etl::private_bitset::bitset_simd::operator_not(pbuffer, number_of_elements * sizeof(element_type)) / sizeof(element_type);
+        pbuffer += processed;
+        number_of_elements -= processed;
+      }
+#endif
+
       while (number_of_elements-- != 0)
       {
         *pbuffer = ~*pbuffer;
@@ -2296,6 +2652,18 @@ namespace etl
       return implementation::find_next(buffer, Number_Of_Elements, Active_Bits, state, position);
     }
 
+    //*************************************************************************
+    /// Calls the function with the position of each set bit, in ascending
+    /// order.
+    ///\param function The function to call.
+    ///\returns The function.
+    //*************************************************************************
+    template <typename TFunction>
+    ETL_CONSTEXPR14 TFunction for_each_set_bit(TFunction function) const
+    {
+      return implementation::for_each_set_bit(buffer, Number_Of_Elements, function);
+    }
+
     //*************************************************************************
     /// operator &
     //*************************************************************************
@@ -3295,6 +3663,18 @@ namespace etl
       return implementation::find_next(pbuffer, Number_Of_Elements, Active_Bits, state, position);
     }
 
+    //*************************************************************************
+    /// Calls the function with the position of each set bit, in ascending
+    /// order.
+    ///\param function The function to call.
+    ///\returns The function.
+    //*************************************************************************
+    template <typename TFunction>
+    ETL_CONSTEXPR14 TFunction for_each_set_bit(TFunction function) const
+    {
+      return implementation::for_each_set_bit(pbuffer, Number_Of_Elements, function);
+    }
+
     //*************************************************************************
     /// operator &=
     //*************************************************************************
@@ -0,0 +1,2023 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BTREE_BASE_INCLUDED
+#define ETL_BTREE_BASE_INCLUDED
+
+#include "../platform.h"
+#include "../algorithm.h"
+#include "../alignment.h"
+#include "../binary.h"
+#include "../error_handler.h"
+#include "../exception.h"
+#include "../functional.h"
+#include "../ipool.h"
+#include "../iterator.h"
+#include "../parameter_type.h"
+#include "../placement_new.h"
+#include "../type_traits.h"
+#include "../utility.h"
+
+#include "comparator_is_transparent.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_USING_BTREE_SSE2
+  #include <emmintrin.h>
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup btree
+  /// Exception base for the B-tree containers.
+  //***************************************************************************
+  class btree_exception : public etl::exception
+  {
+  public:
+
+    btree_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup btree
+  /// Full exception.
+  //***************************************************************************
+  class btree_full : public etl::btree_exception
+  {
+  public:
+
+    btree_full(string_type file_name_, numeric_type line_number_)
+      : btree_exception(ETL_ERROR_TEXT("btree:full", ETL_BTREE_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup btree
+  /// Out of bounds exception.
+  //***************************************************************************
+  class btree_out_of_bounds : public etl::btree_exception
+  {
+  public:
+
+    btree_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : btree_exception(ETL_ERROR_TEXT("btree:bounds", ETL_BTREE_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_btree
+  {
+    //*************************************************************************
+    /// Gets the key of a map element.
+    //*************************************************************************
+    template <typename TKey, typename TValue>
+    struct key_of_pair
+    {
+      static const TKey& get(const TValue& value)
+      {
+        return value.first;
+      }
+    };
+
+    //*************************************************************************
+    /// Gets the key of a set element, which is the element.
+    //*************************************************************************
+    template <typename TKey>
+    struct key_of_value
+    {
+      static const TKey& get(const TKey& value)
+      {
+        return value;
+      }
+    };
+
+    //*************************************************************************
+    /// Rounds a node capacity down to an even number in the range [4, 64].
+    //*************************************************************************
+    template <size_t Capacity>
+    struct node_capacity
+    {
+      static ETL_CONSTANT size_t value = (Capacity < 4U) ? 4U : ((Capacity > 64U) ? 64U : (Capacity & ~size_t(1U)));
+    };
+
+    template <size_t Capacity>
+    ETL_CONSTANT size_t node_capacity<Capacity>::value;
+
+    //*************************************************************************
+    /// The node capacities for an element and key type.
+    /// A leaf spans four cache lines of elements. An inner node spans four
+    /// cache lines of keys and child pointers.
+    //*************************************************************************
+    template <typename TValue, typename TKey>
+    struct node_sizes
+    {
+      static ETL_CONSTANT size_t LEAF_CAPACITY  = node_capacity<(4U * ETL_CACHE_LINE_SIZE) / sizeof(TValue)>::value;
+      static ETL_CONSTANT size_t INNER_CAPACITY = node_capacity<(4U * ETL_CACHE_LINE_SIZE) / (sizeof(TKey) + sizeof(void*))>::value;
+      static ETL_CONSTANT size_t MIN_LEAF       = LEAF_CAPACITY / 2U;
+      static ETL_CONSTANT size_t MIN_INNER      = INNER_CAPACITY / 2U;
+    };
+
+    template <typename TValue, typename TKey>
+    ETL_CONSTANT size_t node_sizes<TValue, TKey>::LEAF_CAPACITY;
+
+    template <typename TValue, typename TKey>
+    ETL_CONSTANT size_t node_sizes<TValue, TKey>::INNER_CAPACITY;
+
+    template <typename TValue, typename TKey>
+    ETL_CONSTANT size_t node_sizes<TValue, TKey>::MIN_LEAF;
+
+    template <typename TValue, typename TKey>
+    ETL_CONSTANT size_t node_sizes<TValue, TKey>::MIN_INNER;
+
+    //*************************************************************************
+    /// The maximum number of inner nodes above 'Nodes' nodes, when every
+    /// inner node other than the root has at least 'Min_Children' children.
+    //*************************************************************************
+    template <size_t Nodes, size_t Min_Children>
+    struct inner_node_count
+    {
+      static ETL_CONSTANT size_t parents = (Nodes / Min_Children) + 1U;
+      static ETL_CONSTANT size_t value   = parents + inner_node_count<parents, Min_Children>::value;
+    };
+
+    template <size_t Min_Children>
+    struct inner_node_count<1U, Min_Children>
+    {
+      static ETL_CONSTANT size_t value = 0U;
+    };
+
+    template <size_t Min_Children>
+    struct inner_node_count<0U, Min_Children>
+    {
+      static ETL_CONSTANT size_t value = 0U;
+    };
+
+    template <size_t Nodes, size_t Min_Children>
+    ETL_CONSTANT size_t inner_node_count<Nodes, Min_Children>::parents;
+
+    template <size_t Nodes, size_t Min_Children>
+    ETL_CONSTANT size_t inner_node_count<Nodes, Min_Children>::value;
+
+    template <size_t Min_Children>
+    ETL_CONSTANT size_t inner_node_count<1U, Min_Children>::value;
+
+    template <size_t Min_Children>
+    ETL_CONSTANT size_t inner_node_count<0U, Min_Children>::value;
+
+    //*************************************************************************
+    /// The number of leaf and inner nodes needed for 'Size' elements.
+    /// Every leaf other than the last holds at least MIN_LEAF elements.
+    //*************************************************************************
+    template <typename TValue, typename TKey, size_t Size>
+    struct pool_sizes
+    {
+      typedef node_sizes<TValue, TKey> sizes_t;
+
+      static ETL_CONSTANT size_t LEAF_NODES  = (Size / sizes_t::MIN_LEAF) + 1U;
+      static ETL_CONSTANT size_t INNER_NODES = inner_node_count<LEAF_NODES, sizes_t::MIN_INNER + 1U>::value + 1U;
+    };
+
+    template <typename TValue, typename TKey, size_t Size>
+    ETL_CONSTANT size_t pool_sizes<TValue, TKey, Size>::LEAF_NODES;
+
+    template <typename TValue, typename TKey, size_t Size>
+    ETL_CONSTANT size_t pool_sizes<TValue, TKey, Size>::INNER_NODES;
+
+#if ETL_USING_BTREE_SSE2
+    //*************************************************************************
+    /// Counts the keys less than, or not greater than, 'key', four at a time.
+    /// Unsigned keys are offset to use the signed comparison.
+    //*************************************************************************
+    inline size_t count_sse2(const int32_t* keys, size_t n, int32_t key, int32_t offset, bool or_equal)
+    {
+      const __m128i vkey    = _mm_set1_epi32(key ^ offset);
+      const __m128i voffset = _mm_set1_epi32(offset);
+
+      size_t count = 0U;
+      size_t i     = 0U;
+
+      for (; (i + 4U) <= n; i += 4U)
+      {
+        const __m128i v = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i)), voffset);
+
+        if (or_equal)
+        {
+          count += 4U - etl::count_bits(uint32_t(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(v, vkey)))));
+        }
+        else
+        {
+          count += etl::count_bits(uint32_t(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(v, vkey)))));
+        }
+      }
+
+      for (; i < n; ++i)
+      {
+        const int32_t k = keys[i] ^ offset;
+
+        count += or_equal ? size_t(!((key ^ offset) < k)) : size_t(k < (key ^ offset));
+      }
+
+      return count;
+    }
+#endif
+
+    //*************************************************************************
+    /// Counts the keys that are less than 'key'.
+    /// Branchless, so that the compiler may vectorise it.
+    //*************************************************************************
+    template <typename TKey>
+    size_t count_less(const TKey* keys, size_t n, TKey key)
+    {
+      size_t count = 0U;
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        count += size_t(keys[i] < key);
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Counts the keys that are not greater than 'key'.
+    //*************************************************************************
+    template <typename TKey>
+    size_t count_less_equal(const TKey* keys, size_t n, TKey key)
+    {
+      size_t count = 0U;
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        count += size_t(!(key < keys[i]));
+      }
+
+      return count;
+    }
+
+#if ETL_USING_BTREE_SSE2
+    //*************************************************************************
+    inline size_t count_less(const int32_t* keys, size_t n, int32_t key)
+    {
+      return count_sse2(keys, n, key, 0, false);
+    }
+
+    //*************************************************************************
+    inline size_t count_less_equal(const int32_t* keys, size_t n, int32_t key)
+    {
+      return count_sse2(keys, n, key, 0, true);
+    }
+
+    //*************************************************************************
+    inline size_t count_less(const uint32_t* keys, size_t n, uint32_t key)
+    {
+      return count_sse2(reinterpret_cast<const int32_t*>(keys), n, int32_t(key), INT32_MIN, false);
+    }
+
+    //*************************************************************************
+    inline size_t count_less_equal(const uint32_t* keys, size_t n, uint32_t key)
+    {
+      return count_sse2(reinterpret_cast<const int32_t*>(keys), n, int32_t(key), INT32_MIN, true);
+    }
+#endif
+
+    //*************************************************************************
+    /// Searches the sorted keys of a node.
+    /// The general case is a branchless binary search.
+    //*************************************************************************
+    template <typename TKey, typename TKeyCompare,
+              bool Is_Counted = etl::is_arithmetic<TKey>::value && etl::is_same<TKeyCompare, etl::less<TKey> >::value>
+    struct key_search
+    {
+      //***********************************
+      template <typename TElement, typename K, typename TCompare>
+      static size_t lower(const TElement* elements, size_t n, const K& key, TCompare compare)
+      {
+        return size_t(etl::branchless_lower_bound(elements, elements + n, key, compare) - elements);
+      }
+
+      //***********************************
+      template <typename TElement, typename K, typename TCompare>
+      static size_t upper(const TElement* elements, size_t n, const K& key, TCompare compare)
+      {
+        return size_t(etl::branchless_upper_bound(elements, elements + n, key, compare) - elements);
+      }
+    };
+
+    //*************************************************************************
+    /// Arithmetic keys compared with etl::less.
+    /// Every key in the node is compared and the results counted, which has
+    /// no data dependent branches and uses SIMD if enabled.
+    //*************************************************************************
+    template <typename TKey, typename TKeyCompare>
+    struct key_search<TKey, TKeyCompare, true>
+    {
+      //***********************************
+      template <typename TCompare>
+      static size_t lower(const TKey* keys, size_t n, TKey key, TCompare)
+      {
+        return count_less(keys, n, key);
+      }
+
+      //***********************************
+      template <typename TCompare>
+      static size_t upper(const TKey* keys, size_t n, TKey key, TCompare)
+      {
+        return count_less_equal(keys, n, key);
+      }
+    };
+  } // namespace private_btree
+
+  //***************************************************************************
+  ///\ingroup btree
+  /// The common base of the B-tree containers.
+  /// A B+tree whose nodes are allocated from pools supplied by the derived
+  /// class. The elements are held by value, in key order, in leaves of
+  /// several cache lines that are linked in both directions. Inner nodes hold
+  /// copies of the separating keys in a contiguous array.
+  /// A lookup touches one node per level, the tree being only a few levels
+  /// deep, and iteration walks the leaves in order.
+  /// Insertion and erasure invalidate iterators, as elements move between
+  /// and within leaves.
+  ///\tparam TValue       The element type.
+  ///\tparam TKey         The key type.
+  ///\tparam TKeyCompare  The key comparison type.
+  ///\tparam TKeyOf       Gets the key from an element.
+  //***************************************************************************
+  template <typename TValue, typename TKey, typename TKeyCompare, typename TKeyOf>
+  class ibtree_base
+  {
+  public:
+
+    typedef TValue            value_type;
+    typedef TKey              key_type;
+    typedef TKeyCompare       key_compare;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+#if ETL_USING_CPP11
+    typedef value_type&& rvalue_reference;
+#endif
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+    typedef ptrdiff_t         difference_type;
+
+  protected:
+
+    typedef const key_type& const_key_reference;
+    typedef typename etl::parameter_type<TKey>::type key_parameter_t;
+
+    typedef private_btree::node_sizes<TValue, TKey> sizes_t;
+
+    /// The type of the copies of keys held by inner nodes.
+    typedef typename etl::remove_const<TKey>::type stored_key_type;
+
+    struct inner_node;
+
+    //*************************************************************************
+    /// The part common to leaf and inner nodes.
+    //*************************************************************************
+    struct node_base
+    {
+      inner_node* parent;
+    };
+
+    //*************************************************************************
+    /// A leaf, holding elements.
+    //*************************************************************************
+    struct leaf_node : public node_base
+    {
+      value_type* elements()
+      {
+        return reinterpret_cast<value_type*>(&storage[0]);
+      }
+
+      leaf_node* previous;
+      leaf_node* next;
+      size_t     count;
+      typename etl::aligned_storage<sizeof(value_type), etl::alignment_of<value_type>::value>::type storage[sizes_t::LEAF_CAPACITY];
+    };
+
+    //*************************************************************************
+    /// An inner node, holding separating keys and children.
+    /// There is room for one more key and child than the capacity, so that a
+    /// key can be added before the node is split.
+    //*************************************************************************
+    struct inner_node : public node_base
+    {
+      stored_key_type* keys()
+      {
+        return reinterpret_cast<stored_key_type*>(&storage[0]);
+      }
+
+      size_t     count;
+      node_base* children[sizes_t::INNER_CAPACITY + 2U];
+      typename etl::aligned_storage<sizeof(stored_key_type), etl::alignment_of<stored_key_type>::value>::type storage[sizes_t::INNER_CAPACITY + 1U];
+    };
+
+  public:
+
+    class const_iterator;
+
+    //*************************************************************************
+    /// iterator.
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, value_type>
+    {
+    public:
+
+      friend class ibtree_base;
+      friend class const_iterator;
+
+      iterator()
+        : p_tree(ETL_NULLPTR)
+        , p_leaf(ETL_NULLPTR)
+        , index(0U)
+      {
+      }
+
+      iterator(ibtree_base& tree, leaf_node* leaf, size_t index_)
+        : p_tree(&tree)
+        , p_leaf(leaf)
+        , index(index_)
+      {
+      }
+
+      iterator& operator++()
+      {
+        if (++index == p_leaf->count)
+        {
+          p_leaf = p_leaf->next;
+          index  = 0U;
+        }
+
+        return *this;
+      }
+
+      iterator operator++(int)
+      {
+        iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      iterator& operator--()
+      {
+        if (index == 0U)
+        {
+          p_leaf = (p_leaf == ETL_NULLPTR) ? p_tree->p_last_leaf : p_leaf->previous;
+          index  = p_leaf->count;
+        }
+
+        --index;
+
+        return *this;
+      }
+
+      iterator operator--(int)
+      {
+        iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      reference operator*() const
+      {
+        return p_leaf->elements()[index];
+      }
+
+      pointer operator&() const
+      {
+        return &(p_leaf->elements()[index]);
+      }
+
+      pointer operator->() const
+      {
+        return &(p_leaf->elements()[index]);
+      }
+
+      friend bool operator==(const iterator& lhs, const iterator& rhs)
+      {
+        return (lhs.p_leaf == rhs.p_leaf) && (lhs.index == rhs.index);
+      }
+
+      friend bool operator!=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      ibtree_base* p_tree; ///< The tree, for decrementing from end().
+      leaf_node*   p_leaf; ///< The leaf, or null for end().
+      size_t       index;  ///< The index of the element in the leaf.
+    };
+
+    //*************************************************************************
+    /// const_iterator.
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, const value_type>
+    {
+    public:
+
+      friend class ibtree_base;
+
+      const_iterator()
+        : p_tree(ETL_NULLPTR)
+        , p_leaf(ETL_NULLPTR)
+        , index(0U)
+      {
+      }
+
+      const_iterator(const ibtree_base& tree, leaf_node* leaf, size_t index_)
+        : p_tree(&tree)
+        , p_leaf(leaf)
+        , index(index_)
+      {
+      }
+
+      const_iterator(const typename ibtree_base::iterator& other)
+        : p_tree(other.p_tree)
+        , p_leaf(other.p_leaf)
+        , index(other.index)
+      {
+      }
+
+      const_iterator& operator++()
+      {
+        if (++index == p_leaf->count)
+        {
+          p_leaf = p_leaf->next;
+          index  = 0U;
+        }
+
+        return *this;
+      }
+
+      const_iterator operator++(int)
+      {
+        const_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      const_iterator& operator--()
+      {
+        if (index == 0U)
+        {
+          p_leaf = (p_leaf == ETL_NULLPTR) ? p_tree->p_last_leaf : p_leaf->previous;
+          index  = p_leaf->count;
+        }
+
+        --index;
+
+        return *this;
+      }
+
+      const_iterator operator--(int)
+      {
+        const_iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      const_reference operator*() const
+      {
+        return p_leaf->elements()[index];
+      }
+
+      const_pointer operator&() const
+      {
+        return &(p_leaf->elements()[index]);
+      }
+
+      const_pointer operator->() const
+      {
+        return &(p_leaf->elements()[index]);
+      }
+
+      friend bool operator==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.p_leaf == rhs.p_leaf) && (lhs.index == rhs.index);
+      }
+
+      friend bool operator!=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      const ibtree_base* p_tree; ///< The tree, for decrementing from end().
+      leaf_node*         p_leaf; ///< The leaf, or null for end().
+      size_t             index;  ///< The index of the element in the leaf.
+    };
+
+    friend class iterator;
+    friend class const_iterator;
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*********************************************************************
+    /// Returns an iterator to the beginning of the container.
+    //*********************************************************************
+    iterator begin()
+    {
+      return iterator(*this, p_first_leaf, 0U);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the container.
+    //*********************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(*this, p_first_leaf, 0U);
+    }
+
+    //*********************************************************************
+    /// Returns an iterator to the end of the container.
+    //*********************************************************************
+    iterator end()
+    {
+      return iterator(*this, ETL_NULLPTR, 0U);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the container.
+    //*********************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(*this, ETL_NULLPTR, 0U);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the container.
+    //*********************************************************************
+    const_iterator cbegin() const
+    {
+      return begin();
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the container.
+    //*********************************************************************
+    const_iterator cend() const
+    {
+      return end();
+    }
+
+    //*********************************************************************
+    /// Returns an reverse iterator to the reverse beginning of the container.
+    //*********************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*********************************************************************
+    /// Returns a const reverse iterator to the reverse beginning of the container.
+    //*********************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*********************************************************************
+    /// Returns a reverse iterator to the end + 1 of the container.
+    //*********************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*********************************************************************
+    /// Returns a const reverse iterator to the end + 1 of the container.
+    //*********************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*********************************************************************
+    /// Returns a const reverse iterator to the reverse beginning of the container.
+    //*********************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*********************************************************************
+    /// Returns a const reverse iterator to the end + 1 of the container.
+    //*********************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*********************************************************************
+    /// Erases all elements with the key.
+    ///\param key The key to erase.
+    ///\return The number of elements erased.
+    //*********************************************************************
+    size_t erase(key_parameter_t key)
+    {
+      ETL_OR_STD::pair<iterator, iterator> range = equal_range(key);
+
+      size_t count = size_t(etl::distance(range.first, range.second));
+
+      erase_n(range.first, count);
+
+      return count;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_t erase(K&& key)
+    {
+      ETL_OR_STD::pair<iterator, iterator> range = equal_range(key);
+
+      size_t count = size_t(etl::distance(range.first, range.second));
+
+      erase_n(range.first, count);
+
+      return count;
+    }
+#endif
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param i_element Iterator to the element.
+    ///\return An iterator to the element after the one erased.
+    //*********************************************************************
+    iterator erase(iterator i_element)
+    {
+      return erase(const_iterator(i_element));
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    /// The leaf is rebalanced with its neighbours if it becomes less than
+    /// half full.
+    ///\param i_element Iterator to the element.
+    ///\return An iterator to the element after the one erased.
+    //*********************************************************************
+    iterator erase(const_iterator i_element)
+    {
+      leaf_node*  leaf     = i_element.p_leaf;
+      size_t      index    = i_element.index;
+      value_type* elements = leaf->elements();
+
+      elements[index].~value_type();
+
+      for (size_t i = index + 1U; i < leaf->count; ++i)
+      {
+        ::new (elements + i - 1U) value_type(ETL_MOVE(elements[i]));
+        elements[i].~value_type();
+      }
+
+      --leaf->count;
+      --current_size;
+
+      if (leaf->count < sizes_t::MIN_LEAF)
+      {
+        rebalance_leaf(leaf, index);
+      }
+
+      return make_iterator(leaf, index);
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    ///\param first Iterator to the first element.
+    ///\param last  Iterator to the last element + 1.
+    ///\return An iterator to the element after the last one erased.
+    //*********************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      return erase_n(first, size_t(etl::distance(first, last)));
+    }
+
+    //*************************************************************************
+    /// Clears the container.
+    //*************************************************************************
+    void clear()
+    {
+      if (p_root != ETL_NULLPTR)
+      {
+        destroy_node(p_root, height);
+      }
+
+      p_root       = ETL_NULLPTR;
+      p_first_leaf = ETL_NULLPTR;
+      p_last_leaf  = ETL_NULLPTR;
+      height       = 0U;
+      current_size = 0U;
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    iterator find(key_parameter_t key)
+    {
+      return find_implementation(key);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator find(const K& key)
+    {
+      return find_implementation(key);
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    const_iterator find(key_parameter_t key) const
+    {
+      return const_cast<ibtree_base*>(this)->find_implementation(key);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator find(const K& key) const
+    {
+      return const_cast<ibtree_base*>(this)->find_implementation(key);
+    }
+#endif
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return The number of elements with the key.
+    //*********************************************************************
+    size_t count(key_parameter_t key) const
+    {
+      ETL_OR_STD::pair<const_iterator, const_iterator> range = equal_range(key);
+
+      return size_t(etl::distance(range.first, range.second));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_t count(const K& key) const
+    {
+      ETL_OR_STD::pair<const_iterator, const_iterator> range = equal_range(key);
+
+      return size_t(etl::distance(range.first, range.second));
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    iterator lower_bound(key_parameter_t key)
+    {
+      return lower_bound_implementation(key);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator lower_bound(const K& key)
+    {
+      return lower_bound_implementation(key);
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    const_iterator lower_bound(key_parameter_t key) const
+    {
+      return const_cast<ibtree_base*>(this)->lower_bound_implementation(key);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator lower_bound(const K& key) const
+    {
+      return const_cast<ibtree_base*>(this)->lower_bound_implementation(key);
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    iterator upper_bound(key_parameter_t key)
+    {
+      return upper_bound_implementation(key);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator upper_bound(const K& key)
+    {
+      return upper_bound_implementation(key);
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    const_iterator upper_bound(key_parameter_t key) const
+    {
+      return const_cast<ibtree_base*>(this)->upper_bound_implementation(key);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator upper_bound(const K& key) const
+    {
+      return const_cast<ibtree_base*>(this)->upper_bound_implementation(key);
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(key_parameter_t key)
+    {
+      return ETL_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      return ETL_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
+    {
+      return ETL_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      return ETL_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+    }
+#endif
+
+    //*************************************************************************
+    /// Check if the container contains the key.
+    //*************************************************************************
+    bool contains(key_parameter_t key) const
+    {
+      return find(key) != end();
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    bool contains(const K& k) const
+    {
+      return find(k) != end();
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets the key comparison function.
+    //*************************************************************************
+    key_compare key_comp() const
+    {
+      return compare;
+    }
+
+    //*************************************************************************
+    /// Gets the size of the container.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Checks the 'empty' state of the container.
+    ///\return <b>true</b> if empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks the 'full' state of the container.
+    ///\return <b>true</b> if full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity of the container.
+    ///\return The capacity of the container.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum possible size of the container.
+    ///\return The maximum size of the container.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return MAX_SIZE - current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the number of levels of inner nodes above the leaves.
+    //*************************************************************************
+    size_type depth() const
+    {
+      return height;
+    }
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    ibtree_base(etl::ipool& leaf_pool_, etl::ipool& inner_pool_, size_type max_size_)
+      : p_leaf_pool(&leaf_pool_)
+      , p_inner_pool(&inner_pool_)
+      , p_root(ETL_NULLPTR)
+      , p_first_leaf(ETL_NULLPTR)
+      , p_last_leaf(ETL_NULLPTR)
+      , height(0U)
+      , current_size(0U)
+      , MAX_SIZE(max_size_)
+    {
+    }
+
+    //*********************************************************************
+    /// Makes room for an element with 'key' at 'position' and returns the
+    /// uninitialised slot. 'position' is updated to refer to the slot.
+    /// A full leaf is split first. Splitting the last leaf at its end moves
+    /// only one element, so that elements added in order fill the leaves.
+    /// If asserts or exceptions are enabled, emits btree_full if the
+    /// container is already full.
+    //*********************************************************************
+    void* open_gap(iterator& position, const_key_reference key)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(btree_full));
+
+      leaf_node* leaf;
+      size_t     index;
+
+      if (p_root == ETL_NULLPTR)
+      {
+        leaf         = create_leaf();
+        p_root       = leaf;
+        p_first_leaf = leaf;
+        p_last_leaf  = leaf;
+        index        = 0U;
+      }
+      else if (position.p_leaf == ETL_NULLPTR)
+      {
+        leaf  = p_last_leaf;
+        index = leaf->count;
+      }
+      else
+      {
+        leaf  = position.p_leaf;
+        index = position.index;
+
+        // The start of a leaf is also the end of the previous one.
+        // The separator between them decides which the key belongs to.
+        if ((index == 0U) && (leaf->previous != ETL_NULLPTR) && compare(key, separator_before(leaf)))
+        {
+          leaf  = leaf->previous;
+          index = leaf->count;
+        }
+      }
+
+      if (leaf->count == sizes_t::LEAF_CAPACITY)
+      {
+        split_leaf(leaf, index);
+      }
+
+      value_type* elements = leaf->elements();
+
+      for (size_t i = leaf->count; i != index; --i)
+      {
+        ::new (elements + i) value_type(ETL_MOVE(elements[i - 1U]));
+        elements[i - 1U].~value_type();
+      }
+
+      ++leaf->count;
+      ++current_size;
+
+      position = iterator(*this, leaf, index);
+
+      return elements + index;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Opens a gap for 'value' at 'position' and moves 'value' into it.
+    /// 'position' is updated to refer to the new element.
+    /// 'value' is built before the gap is opened, as the arguments that it is
+    /// built from may refer to elements that opening the gap moves.
+    //*********************************************************************
+    void insert_value(iterator& position, value_type&& value)
+    {
+      ::new (open_gap(position, TKeyOf::get(value))) value_type(etl::move(value));
+    }
+#else
+    //*********************************************************************
+    /// Opens a gap for 'value' at 'position' and copies 'value' into it.
+    /// 'position' is updated to refer to the new element.
+    /// 'value' is built before the gap is opened, as the arguments that it is
+    /// built from may refer to elements that opening the gap moves.
+    //*********************************************************************
+    void insert_value(iterator& position, const value_type& value)
+    {
+      ::new (open_gap(position, TKeyOf::get(value))) value_type(value);
+    }
+#endif
+
+    //*********************************************************************
+    /// Is the element at 'position' equivalent to 'key'?
+    /// 'position' must be the lower bound of 'key'.
+    //*********************************************************************
+    template <typename K>
+    bool is_match(const_iterator position, const K& key) const
+    {
+      return (position != end()) && !compare(key, TKeyOf::get(*position));
+    }
+
+    //*********************************************************************
+    /// Returns 'hint' if it is the lower bound of 'key', otherwise searches.
+    /// Inserting sorted values at end() then costs no search.
+    //*********************************************************************
+    iterator lower_bound_from_hint(const_iterator hint, const_key_reference key)
+    {
+      const_iterator previous = hint;
+
+      const bool after_previous = (hint == begin()) || compare(TKeyOf::get(*--previous), key);
+      const bool not_before     = (hint == end()) || !compare(TKeyOf::get(*hint), key);
+
+      return (after_previous && not_before) ? iterator(*this, hint.p_leaf, hint.index) : lower_bound(key);
+    }
+
+    //*********************************************************************
+    /// Returns 'hint' if it is the upper bound of 'key', otherwise searches.
+    /// Inserting sorted values at end() then costs no search.
+    //*********************************************************************
+    iterator upper_bound_from_hint(const_iterator hint, const_key_reference key)
+    {
+      const_iterator previous = hint;
+
+      const bool not_after_previous = (hint == begin()) || !compare(key, TKeyOf::get(*--previous));
+      const bool before             = (hint == end()) || compare(key, TKeyOf::get(*hint));
+
+      return (not_after_previous && before) ? iterator(*this, hint.p_leaf, hint.index) : upper_bound(key);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Moves the elements of another container into this one.
+    //*************************************************************************
+    void move_container(ibtree_base&& rhs)
+    {
+      if (&rhs != this)
+      {
+        clear();
+
+        iterator itr = rhs.begin();
+
+        while (itr != rhs.end())
+        {
+          iterator position = end();
+          ::new (open_gap(position, TKeyOf::get(*itr))) value_type(etl::move(*itr));
+          ++itr;
+        }
+
+        rhs.clear();
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Appends a copy of every element of another container, which must be
+    /// in order.
+    //*************************************************************************
+    void copy_container(const ibtree_base& rhs)
+    {
+      if (&rhs != this)
+      {
+        clear();
+
+        const_iterator itr = rhs.begin();
+
+        while (itr != rhs.end())
+        {
+          iterator position = end();
+          ::new (open_gap(position, TKeyOf::get(*itr))) value_type(*itr);
+          ++itr;
+        }
+      }
+    }
+
+  private:
+
+    typedef private_btree::key_search<TKey, TKeyCompare> key_search_t;
+
+    //*********************************************************************
+    /// Compares an element with a key, for lower bound searches.
+    //*********************************************************************
+    struct element_less_key
+    {
+      element_less_key(const key_compare& compare_)
+        : compare(compare_)
+      {
+      }
+
+      template <typename K>
+      bool operator()(const value_type& element, const K& key) const
+      {
+        return compare(TKeyOf::get(element), key);
+      }
+
+      const key_compare& compare;
+    };
+
+    //*********************************************************************
+    /// Compares a key with an element, for upper bound searches.
+    //*********************************************************************
+    struct key_less_element
+    {
+      key_less_element(const key_compare& compare_)
+        : compare(compare_)
+      {
+      }
+
+      template <typename K>
+      bool operator()(const K& key, const value_type& element) const
+      {
+        return compare(key, TKeyOf::get(element));
+      }
+
+      const key_compare& compare;
+    };
+
+    //*********************************************************************
+    /// Finds the leaf that the lower bound of 'key' is in, or the leaf
+    /// before it.
+    //*********************************************************************
+    template <typename K>
+    leaf_node* find_leaf_lower(const K& key) const
+    {
+      node_base* node = p_root;
+
+      for (size_t level = height; level != 0U; --level)
+      {
+        inner_node* inner = static_cast<inner_node*>(node);
+        node              = inner->children[key_search_t::lower(inner->keys(), inner->count, key, compare)];
+      }
+
+      return static_cast<leaf_node*>(node);
+    }
+
+    //*********************************************************************
+    /// Finds the leaf that the upper bound of 'key' is in, or the leaf
+    /// before it.
+    //*********************************************************************
+    template <typename K>
+    leaf_node* find_leaf_upper(const K& key) const
+    {
+      node_base* node = p_root;
+
+      for (size_t level = height; level != 0U; --level)
+      {
+        inner_node* inner = static_cast<inner_node*>(node);
+        node              = inner->children[key_search_t::upper(inner->keys(), inner->count, key, compare)];
+      }
+
+      return static_cast<leaf_node*>(node);
+    }
+
+    //*********************************************************************
+    /// The elements of a set leaf are keys and can use the key search.
+    //*********************************************************************
+    template <typename K>
+    size_t leaf_lower(leaf_node* leaf, const K& key, etl::true_type) const
+    {
+      return key_search_t::lower(leaf->elements(), leaf->count, key, compare);
+    }
+
+    //*********************************************************************
+    template <typename K>
+    size_t leaf_lower(leaf_node* leaf, const K& key, etl::false_type) const
+    {
+      return private_btree::key_search<TKey, TKeyCompare, false>::lower(leaf->elements(), leaf->count, key, element_less_key(compare));
+    }
+
+    //*********************************************************************
+    template <typename K>
+    size_t leaf_upper(leaf_node* leaf, const K& key, etl::true_type) const
+    {
+      return key_search_t::upper(leaf->elements(), leaf->count, key, compare);
+    }
+
+    //*********************************************************************
+    template <typename K>
+    size_t leaf_upper(leaf_node* leaf, const K& key, etl::false_type) const
+    {
+      return private_btree::key_search<TKey, TKeyCompare, false>::upper(leaf->elements(), leaf->count, key, key_less_element(compare));
+    }
+
+    //*********************************************************************
+    template <typename K>
+    iterator lower_bound_implementation(const K& key)
+    {
+      if (p_root == ETL_NULLPTR)
+      {
+        return end();
+      }
+
+      leaf_node* leaf = find_leaf_lower(key);
+
+      return make_iterator(leaf, leaf_lower(leaf, key, etl::integral_constant<bool, etl::is_same<TValue, TKey>::value>()));
+    }
+
+    //*********************************************************************
+    template <typename K>
+    iterator upper_bound_implementation(const K& key)
+    {
+      if (p_root == ETL_NULLPTR)
+      {
+        return end();
+      }
+
+      leaf_node* leaf = find_leaf_upper(key);
+
+      return make_iterator(leaf, leaf_upper(leaf, key, etl::integral_constant<bool, etl::is_same<TValue, TKey>::value>()));
+    }
+
+    //*********************************************************************
+    template <typename K>
+    iterator find_implementation(const K& key)
+    {
+      iterator itr = lower_bound_implementation(key);
+
+      return is_match(itr, key) ? itr : end();
+    }
+
+    //*********************************************************************
+    /// Makes an iterator, moving to the next leaf if 'index' is the end of
+    /// the leaf.
+    //*********************************************************************
+    iterator make_iterator(leaf_node* leaf, size_t index)
+    {
+      if ((leaf != ETL_NULLPTR) && (index == leaf->count))
+      {
+        leaf  = leaf->next;
+        index = 0U;
+      }
+
+      return iterator(*this, leaf, index);
+    }
+
+    //*********************************************************************
+    /// Erases 'n' elements from 'first'.
+    //*********************************************************************
+    iterator erase_n(const_iterator first, size_t n)
+    {
+      iterator itr(*this, first.p_leaf, first.index);
+
+      while (n-- != 0U)
+      {
+        itr = erase(const_iterator(itr));
+      }
+
+      return itr;
+    }
+
+    //*********************************************************************
+    /// Gets the index of 'child' in the children of 'parent'.
+    //*********************************************************************
+    static size_t child_index(const inner_node* parent, const node_base* child)
+    {
+      size_t i = 0U;
+
+      while (parent->children[i] != child)
+      {
+        ++i;
+      }
+
+      return i;
+    }
+
+    //*********************************************************************
+    /// Gets the key that separates 'leaf' from the previous leaf.
+    //*********************************************************************
+    static const stored_key_type& separator_before(leaf_node* leaf)
+    {
+      node_base*  node   = leaf;
+      inner_node* parent = node->parent;
+      size_t      i      = child_index(parent, node);
+
+      while (i == 0U)
+      {
+        node   = parent;
+        parent = node->parent;
+        i      = child_index(parent, node);
+      }
+
+      return parent->keys()[i - 1U];
+    }
+
+    //*********************************************************************
+    /// Moves a key to uninitialised storage.
+    //*********************************************************************
+    static void move_key(stored_key_type* destination, stored_key_type& source)
+    {
+      ::new (destination) stored_key_type(ETL_MOVE(source));
+      source.~stored_key_type();
+    }
+
+    //*********************************************************************
+    /// Replaces a key with a copy of another.
+    //*********************************************************************
+    static void replace_key(stored_key_type& destination, const stored_key_type& source)
+    {
+      destination.~stored_key_type();
+      ::new (&destination) stored_key_type(source);
+    }
+
+    //*********************************************************************
+    /// Moves an element to uninitialised storage.
+    //*********************************************************************
+    static void move_element(value_type* destination, value_type& source)
+    {
+      ::new (destination) value_type(ETL_MOVE(source));
+      source.~value_type();
+    }
+
+    //*********************************************************************
+    leaf_node* create_leaf()
+    {
+      leaf_node* leaf = p_leaf_pool->template allocate<leaf_node>();
+      ::new (leaf) leaf_node;
+
+      leaf->parent   = ETL_NULLPTR;
+      leaf->previous = ETL_NULLPTR;
+      leaf->next     = ETL_NULLPTR;
+      leaf->count    = 0U;
+
+      return leaf;
+    }
+
+    //*********************************************************************
+    inner_node* create_inner()
+    {
+      inner_node* inner = p_inner_pool->template allocate<inner_node>();
+      ::new (inner) inner_node;
+
+      inner->parent = ETL_NULLPTR;
+      inner->count  = 0U;
+
+      return inner;
+    }
+
+    //*********************************************************************
+    /// Destroys the elements or keys of a node and its descendants and
+    /// releases them.
+    //*********************************************************************
+    void destroy_node(node_base* node, size_t level)
+    {
+      if (level == 0U)
+      {
+        leaf_node* leaf = static_cast<leaf_node*>(node);
+
+        if ETL_IF_CONSTEXPR (!etl::is_trivially_destructible<value_type>::value)
+        {
+          for (size_t i = 0U; i < leaf->count; ++i)
+          {
+            leaf->elements()[i].~value_type();
+          }
+        }
+
+        p_leaf_pool->release(leaf);
+      }
+      else
+      {
+        inner_node* inner = static_cast<inner_node*>(node);
+
+        for (size_t i = 0U; i <= inner->count; ++i)
+        {
+          destroy_node(inner->children[i], level - 1U);
+        }
+
+        for (size_t i = 0U; i < inner->count; ++i)
+        {
+          inner->keys()[i].~stored_key_type();
+        }
+
+        p_inner_pool->release(inner);
+      }
+    }
+
+    //*********************************************************************
+    /// Splits a full leaf, moving the upper elements to a new leaf.
+    /// 'leaf' and 'index' are updated to the position of the new element,
+    /// which is never the first of the new leaf, so that the separator is
+    /// always the key of an existing element.
+    //*********************************************************************
+    void split_leaf(leaf_node*& leaf, size_t& index)
+    {
+      const size_t capacity  = sizes_t::LEAF_CAPACITY;
+      const bool   appending = (leaf->next == ETL_NULLPTR) && (index == capacity);
+
+      // The number of elements in the left leaf, including the new one.
+      size_t split = appending ? (capacity - 1U) : (capacity / 2U);
+
+      if (index == split)
+      {
+        ++split;
+      }
+
+      const size_t keep = (index < split) ? (split - 1U) : split;
+
+      leaf_node* right = create_leaf();
+
+      right->previous = leaf;
+      right->next     = leaf->next;
+
+      if (leaf->next == ETL_NULLPTR)
+      {
+        p_last_leaf = right;
+      }
+      else
+      {
+        leaf->next->previous = right;
+      }
+
+      leaf->next = right;
+
+      value_type* elements       = leaf->elements();
+      value_type* right_elements = right->elements();
+
+      for (size_t i = keep; i < leaf->count; ++i)
+      {
+        move_element(right_elements + (i - keep), elements[i]);
+      }
+
+      right->count = leaf->count - keep;
+      leaf->count  = keep;
+
+      insert_into_parent(leaf, TKeyOf::get(right_elements[0]), right);
+
+      if (index >= split)
+      {
+        leaf = right;
+        index -= keep;
+      }
+    }
+
+    //*********************************************************************
+    /// Adds 'key' and the new node 'right' after 'left' in their parent.
+    //*********************************************************************
+    void insert_into_parent(node_base* left, const stored_key_type& key, node_base* right)
+    {
+      if (left == p_root)
+      {
+        inner_node* root = create_inner();
+
+        ::new (root->keys()) stored_key_type(key);
+        root->children[0] = left;
+        root->children[1] = right;
+        root->count       = 1U;
+        left->parent      = root;
+        right->parent     = root;
+        p_root            = root;
+        ++height;
+
+        return;
+      }
+
+      inner_node*  parent = left->parent;
+      stored_key_type*    keys   = parent->keys();
+      const size_t index  = child_index(parent, left);
+
+      for (size_t i = parent->count; i != index; --i)
+      {
+        move_key(keys + i, keys[i - 1U]);
+        parent->children[i + 1U] = parent->children[i];
+      }
+
+      ::new (keys + index) stored_key_type(key);
+      parent->children[index + 1U] = right;
+      right->parent                = parent;
+      ++parent->count;
+
+      if (parent->count > sizes_t::INNER_CAPACITY)
+      {
+        split_inner(parent);
+      }
+    }
+
+    //*********************************************************************
+    /// Splits an overfull inner node. The middle key moves up to the parent.
+    //*********************************************************************
+    void split_inner(inner_node* node)
+    {
+      inner_node* right      = create_inner();
+      stored_key_type*   keys       = node->keys();
+      stored_key_type*   right_keys = right->keys();
+
+      const size_t middle = node->count / 2U;
+
+      for (size_t i = middle + 1U; i < node->count; ++i)
+      {
+        move_key(right_keys + (i - middle - 1U), keys[i]);
+      }
+
+      for (size_t i = middle + 1U; i <= node->count; ++i)
+      {
+        right->children[i - middle - 1U] = node->children[i];
+        node->children[i]->parent        = right;
+      }
+
+      right->count = node->count - middle - 1U;
+      node->count  = middle;
+
+      stored_key_type key(ETL_MOVE(keys[middle]));
+      keys[middle].~stored_key_type();
+
+      insert_into_parent(node, key, right);
+    }
+
+    //*********************************************************************
+    /// Removes a leaf from the list of leaves.
+    //*********************************************************************
+    void unlink_leaf(leaf_node* leaf)
+    {
+      if (leaf->previous == ETL_NULLPTR)
+      {
+        p_first_leaf = leaf->next;
+      }
+      else
+      {
+        leaf->previous->next = leaf->next;
+      }
+
+      if (leaf->next == ETL_NULLPTR)
+      {
+        p_last_leaf = leaf->previous;
+      }
+      else
+      {
+        leaf->next->previous = leaf->previous;
+      }
+    }
+
+    //*********************************************************************
+    /// Moves all of the elements of 'source' to the end of 'destination'.
+    //*********************************************************************
+    static void append_elements(leaf_node* destination, leaf_node* source)
+    {
+      value_type* to   = destination->elements() + destination->count;
+      value_type* from = source->elements();
+
+      for (size_t i = 0U; i < source->count; ++i)
+      {
+        move_element(to + i, from[i]);
+      }
+
+      destination->count += source->count;
+      source->count = 0U;
+    }
+
+    //*********************************************************************
+    /// Removes the key at 'index' and the child after it from 'parent'.
+    //*********************************************************************
+    static void remove_from_parent(inner_node* parent, size_t index)
+    {
+      stored_key_type* keys = parent->keys();
+
+      keys[index].~stored_key_type();
+
+      for (size_t i = index + 1U; i < parent->count; ++i)
+      {
+        move_key(keys + i - 1U, keys[i]);
+      }
+
+      for (size_t i = index + 2U; i <= parent->count; ++i)
+      {
+        parent->children[i - 1U] = parent->children[i];
+      }
+
+      --parent->count;
+    }
+
+    //*********************************************************************
+    /// Refills a leaf that is less than half full, by taking an element from
+    /// a neighbour or by merging with it.
+    /// 'leaf' and 'index' are updated to follow the element after the one
+    /// erased.
+    //*********************************************************************
+    void rebalance_leaf(leaf_node*& leaf, size_t& index)
+    {
+      if (leaf == p_root)
+      {
+        if (leaf->count == 0U)
+        {
+          p_leaf_pool->release(leaf);
+          p_root       = ETL_NULLPTR;
+          p_first_leaf = ETL_NULLPTR;
+          p_last_leaf  = ETL_NULLPTR;
+          leaf         = ETL_NULLPTR;
+          index        = 0U;
+        }
+
+        return;
+      }
+
+      inner_node*  parent = leaf->parent;
+      const size_t i      = child_index(parent, leaf);
+
+      leaf_node* left  = (i != 0U) ? static_cast<leaf_node*>(parent->children[i - 1U]) : ETL_NULLPTR;
+      leaf_node* right = (i < parent->count) ? static_cast<leaf_node*>(parent->children[i + 1U]) : ETL_NULLPTR;
+
+      value_type* elements = leaf->elements();
+
+      if ((left != ETL_NULLPTR) && (left->count > sizes_t::MIN_LEAF))
+      {
+        // Take the last element of the left leaf.
+        for (size_t j = leaf->count; j != 0U; --j)
+        {
+          move_element(elements + j, elements[j - 1U]);
+        }
+
+        --left->count;
+        move_element(elements, left->elements()[left->count]);
+        ++leaf->count;
+        replace_key(parent->keys()[i - 1U], TKeyOf::get(elements[0]));
+        ++index;
+      }
+      else if ((right != ETL_NULLPTR) && (right->count > sizes_t::MIN_LEAF))
+      {
+        // Take the first element of the right leaf.
+        value_type* right_elements = right->elements();
+
+        move_element(elements + leaf->count, right_elements[0]);
+        ++leaf->count;
+
+        for (size_t j = 1U; j < right->count; ++j)
+        {
+          move_element(right_elements + j - 1U, right_elements[j]);
+        }
+
+        --right->count;
+        replace_key(parent->keys()[i], TKeyOf::get(right_elements[0]));
+      }
+      else if (left != ETL_NULLPTR)
+      {
+        // Merge into the left leaf.
+        index += left->count;
+        append_elements(left, leaf);
+        unlink_leaf(leaf);
+        p_leaf_pool->release(leaf);
+        remove_from_parent(parent, i - 1U);
+        leaf = left;
+        rebalance_inner(parent);
+      }
+      else
+      {
+        // Merge the right leaf into this one.
+        append_elements(leaf, right);
+        unlink_leaf(right);
+        p_leaf_pool->release(right);
+        remove_from_parent(parent, i);
+        rebalance_inner(parent);
+      }
+    }
+
+    //*********************************************************************
+    /// Refills an inner node that is less than half full, by rotating a key
+    /// through the parent from a neighbour or by merging with it.
+    /// A root with no keys is replaced by its only child.
+    //*********************************************************************
+    void rebalance_inner(inner_node* node)
+    {
+      if (node == p_root)
+      {
+        if (node->count == 0U)
+        {
+          p_root         = node->children[0];
+          p_root->parent = ETL_NULLPTR;
+          --height;
+          p_inner_pool->release(node);
+        }
+
+        return;
+      }
+
+      if (node->count >= sizes_t::MIN_INNER)
+      {
+        return;
+      }
+
+      inner_node*  parent      = node->parent;
+      stored_key_type*    parent_keys = parent->keys();
+      stored_key_type*    keys        = node->keys();
+      const size_t i           = child_index(parent, node);
+
+      inner_node* left  = (i != 0U) ? static_cast<inner_node*>(parent->children[i - 1U]) : ETL_NULLPTR;
+      inner_node* right = (i < parent->count) ? static_cast<inner_node*>(parent->children[i + 1U]) : ETL_NULLPTR;
+
+      if ((left != ETL_NULLPTR) && (left->count > sizes_t::MIN_INNER))
+      {
+        // Rotate the last child of the left node through the parent.
+        for (size_t j = node->count; j != 0U; --j)
+        {
+          move_key(keys + j, keys[j - 1U]);
+        }
+
+        for (size_t j = node->count + 1U; j != 0U; --j)
+        {
+          node->children[j] = node->children[j - 1U];
+        }
+
+        move_key(keys, parent_keys[i - 1U]);
+        move_key(parent_keys + i - 1U, left->keys()[left->count - 1U]);
+        node->children[0]         = left->children[left->count];
+        node->children[0]->parent = node;
+        --left->count;
+        ++node->count;
+      }
+      else if ((right != ETL_NULLPTR) && (right->count > sizes_t::MIN_INNER))
+      {
+        // Rotate the first child of the right node through the parent.
+        stored_key_type* right_keys = right->keys();
+
+        move_key(keys + node->count, parent_keys[i]);
+        move_key(parent_keys + i, right_keys[0]);
+        node->children[node->count + 1U]         = right->children[0];
+        node->children[node->count + 1U]->parent = node;
+        ++node->count;
+
+        for (size_t j = 1U; j < right->count; ++j)
+        {
+          move_key(right_keys + j - 1U, right_keys[j]);
+        }
+
+        for (size_t j = 1U; j <= right->count; ++j)
+        {
+          right->children[j - 1U] = right->children[j];
+        }
+
+        --right->count;
+      }
+      else if (left != ETL_NULLPTR)
+      {
+        merge_inner(left, node, i - 1U);
+      }
+      else
+      {
+        merge_inner(node, right, i);
+      }
+    }
+
+    //*********************************************************************
+    /// Merges 'right' and the separator at 'index' in the parent into
+    /// 'left'.
+    //*********************************************************************
+    void merge_inner(inner_node* left, inner_node* right, size_t index)
+    {
+      inner_node* parent     = left->parent;
+      stored_key_type*   keys       = left->keys();
+      stored_key_type*   right_keys = right->keys();
+
+      const size_t offset = left->count + 1U;
+
+      ::new (keys + left->count) stored_key_type(parent->keys()[index]);
+
+      for (size_t j = 0U; j < right->count; ++j)
+      {
+        move_key(keys + offset + j, right_keys[j]);
+      }
+
+      for (size_t j = 0U; j <= right->count; ++j)
+      {
+        left->children[offset + j]         = right->children[j];
+        left->children[offset + j]->parent = left;
+      }
+
+      left->count = offset + right->count;
+
+      p_inner_pool->release(right);
+      remove_from_parent(parent, index);
+      rebalance_inner(parent);
+    }
+
+    // Disable copy construction.
+    ibtree_base(const ibtree_base&);
+
+    etl::ipool*     p_leaf_pool;  ///< The pool of leaves.
+    etl::ipool*     p_inner_pool; ///< The pool of inner nodes.
+    node_base*      p_root;       ///< The root, or null if empty.
+    leaf_node*      p_first_leaf; ///< The first leaf, or null if empty.
+    leaf_node*      p_last_leaf;  ///< The last leaf, or null if empty.
+    size_type       height;       ///< The number of levels of inner nodes.
+    size_type       current_size; ///< The number of elements.
+    const size_type MAX_SIZE;     ///< The maximum number of elements.
+    key_compare     compare;      ///< The key comparison.
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_BTREE) || defined(ETL_POLYMORPHIC_CONTAINERS)
+
+  public:
+
+    virtual ~ibtree_base() {}
+#else
+
+  protected:
+
+    ~ibtree_base() {}
+#endif
+  };
+} // namespace etl
+
+#endif
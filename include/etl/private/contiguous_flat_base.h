@@ -0,0 +1,859 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CONTIGUOUS_FLAT_BASE_INCLUDED
+#define ETL_CONTIGUOUS_FLAT_BASE_INCLUDED
+
+#include "../platform.h"
+#include "../algorithm.h"
+#include "../error_handler.h"
+#include "../exception.h"
+#include "../functional.h"
+#include "../iterator.h"
+#include "../parameter_type.h"
+#include "../placement_new.h"
+#include "../type_traits.h"
+#include "../utility.h"
+
+#include "comparator_is_transparent.h"
+
+#include <stddef.h>
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup contiguous_flat
+  /// Exception base for the contiguous flat containers.
+  //***************************************************************************
+  class contiguous_flat_exception : public etl::exception
+  {
+  public:
+
+    contiguous_flat_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup contiguous_flat
+  /// Full exception.
+  //***************************************************************************
+  class contiguous_flat_full : public etl::contiguous_flat_exception
+  {
+  public:
+
+    contiguous_flat_full(string_type file_name_, numeric_type line_number_)
+      : contiguous_flat_exception(ETL_ERROR_TEXT("contiguous_flat:full", ETL_CONTIGUOUS_FLAT_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup contiguous_flat
+  /// Out of bounds exception.
+  //***************************************************************************
+  class contiguous_flat_out_of_bounds : public etl::contiguous_flat_exception
+  {
+  public:
+
+    contiguous_flat_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : contiguous_flat_exception(ETL_ERROR_TEXT("contiguous_flat:bounds", ETL_CONTIGUOUS_FLAT_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_contiguous_flat
+  {
+    //*************************************************************************
+    /// Gets the key of a map element.
+    //*************************************************************************
+    template <typename TKey, typename TValue>
+    struct key_of_pair
+    {
+      static const TKey& get(const TValue& value)
+      {
+        return value.first;
+      }
+    };
+
+    //*************************************************************************
+    /// Gets the key of a set element, which is the element.
+    //*************************************************************************
+    template <typename TKey>
+    struct key_of_value
+    {
+      static const TKey& get(const TKey& value)
+      {
+        return value;
+      }
+    };
+  } // namespace private_contiguous_flat
+
+  //***************************************************************************
+  ///\ingroup contiguous_flat
+  /// The common base of the contiguous flat containers.
+  /// The elements are held by value, in key order, in a single array.
+  /// Searches are branchless binary searches over the array and iterators
+  /// are pointers, so lookups and iteration only touch contiguous memory.
+  /// Insertion and erasure are O(N), as the elements after the position are
+  /// moved up or down by one.
+  ///\tparam TValue       The element type.
+  ///\tparam TKey         The key type.
+  ///\tparam TKeyCompare  The key comparison type.
+  ///\tparam TKeyOf       Gets the key from an element.
+  //***************************************************************************
+  template <typename TValue, typename TKey, typename TKeyCompare, typename TKeyOf>
+  class icontiguous_flat_base
+  {
+  public:
+
+    typedef TValue                                   value_type;
+    typedef TKey                                     key_type;
+    typedef TKeyCompare                              key_compare;
+    typedef value_type&                              reference;
+    typedef const value_type&                        const_reference;
+#if ETL_USING_CPP11
+    typedef value_type&&                             rvalue_reference;
+#endif
+    typedef value_type*                              pointer;
+    typedef const value_type*                        const_pointer;
+    typedef size_t                                   size_type;
+    typedef value_type*                              iterator;
+    typedef const value_type*                        const_iterator;
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+    typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+
+  protected:
+
+    typedef const key_type& const_key_reference;
+    typedef typename etl::parameter_type<TKey>::type key_parameter_t;
+
+  public:
+
+    //*********************************************************************
+    /// Returns an iterator to the beginning of the container.
+    //*********************************************************************
+    iterator begin()
+    {
+      return p_buffer;
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the container.
+    //*********************************************************************
+    const_iterator begin() const
+    {
+      return p_buffer;
+    }
+
+    //*********************************************************************
+    /// Returns an iterator to the end of the container.
+    //*********************************************************************
+    iterator end()
+    {
+      return p_buffer + current_size;
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the container.
+    //*********************************************************************
+    const_iterator end() const
+    {
+      return p_buffer + current_size;
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the container.
+    //*********************************************************************
+    const_iterator cbegin() const
+    {
+      return p_buffer;
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the container.
+    //*********************************************************************
+    const_iterator cend() const
+    {
+      return p_buffer + current_size;
+    }
+
+    //*********************************************************************
+    /// Returns an reverse iterator to the reverse beginning of the container.
+    //*********************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*********************************************************************
+    /// Returns a const reverse iterator to the reverse beginning of the container.
+    //*********************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*********************************************************************
+    /// Returns a reverse iterator to the end + 1 of the container.
+    //*********************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*********************************************************************
+    /// Returns a const reverse iterator to the end + 1 of the container.
+    //*********************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*********************************************************************
+    /// Returns a const reverse iterator to the reverse beginning of the container.
+    //*********************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*********************************************************************
+    /// Returns a const reverse iterator to the end + 1 of the container.
+    //*********************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*********************************************************************
+    /// Returns a pointer to the first element of the sorted array.
+    //*********************************************************************
+    pointer data()
+    {
+      return p_buffer;
+    }
+
+    //*********************************************************************
+    /// Returns a const pointer to the first element of the sorted array.
+    //*********************************************************************
+    const_pointer data() const
+    {
+      return p_buffer;
+    }
+
+    //*********************************************************************
+    /// Erases all elements with the key.
+    ///\param key The key to erase.
+    ///\return The number of elements erased.
+    //*********************************************************************
+    size_t erase(key_parameter_t key)
+    {
+      ETL_OR_STD::pair<iterator, iterator> range = equal_range(key);
+
+      size_t count = size_t(range.second - range.first);
+
+      erase(range.first, range.second);
+
+      return count;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_t erase(K&& key)
+    {
+      ETL_OR_STD::pair<iterator, iterator> range = equal_range(key);
+
+      size_t count = size_t(range.second - range.first);
+
+      erase(range.first, range.second);
+
+      return count;
+    }
+#endif
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param i_element Iterator to the element.
+    ///\return An iterator to the element after the one erased.
+    //*********************************************************************
+    iterator erase(iterator i_element)
+    {
+      return erase(const_iterator(i_element), const_iterator(i_element + 1));
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param i_element Iterator to the element.
+    ///\return An iterator to the element after the one erased.
+    //*********************************************************************
+    iterator erase(const_iterator i_element)
+    {
+      return erase(i_element, i_element + 1);
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    /// The elements after the range are moved down to close the gap.
+    ///\param first Iterator to the first element.
+    ///\param last  Iterator to the last element + 1.
+    ///\return An iterator to the element after the last one erased.
+    //*********************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      iterator        destination = p_buffer + (first - p_buffer);
+      iterator        source      = p_buffer + (last - p_buffer);
+      const size_type count       = size_type(last - first);
+
+      if (count != 0U)
+      {
+        iterator itr = end();
+
+        while (source != itr)
+        {
+          destination->~value_type();
+          ::new (destination) value_type(ETL_MOVE(*source));
+          ++destination;
+          ++source;
+        }
+
+        while (destination != itr)
+        {
+          destination->~value_type();
+          ++destination;
+        }
+
+        current_size -= count;
+      }
+
+      return p_buffer + (first - p_buffer);
+    }
+
+    //*************************************************************************
+    /// Clears the container.
+    //*************************************************************************
+    void clear()
+    {
+      if ETL_IF_CONSTEXPR (!etl::is_trivially_destructible<value_type>::value)
+      {
+        iterator itr = begin();
+
+        while (itr != end())
+        {
+          itr->~value_type();
+          ++itr;
+        }
+      }
+
+      current_size = 0U;
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    iterator find(key_parameter_t key)
+    {
+      return p_buffer + (find_implementation(key) - p_buffer);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator find(const K& key)
+    {
+      return p_buffer + (find_implementation(key) - p_buffer);
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    const_iterator find(key_parameter_t key) const
+    {
+      return find_implementation(key);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator find(const K& key) const
+    {
+      return find_implementation(key);
+    }
+#endif
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return The number of elements with the key.
+    //*********************************************************************
+    size_t count(key_parameter_t key) const
+    {
+      ETL_OR_STD::pair<const_iterator, const_iterator> range = equal_range(key);
+
+      return size_t(range.second - range.first);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_t count(const K& key) const
+    {
+      ETL_OR_STD::pair<const_iterator, const_iterator> range = equal_range(key);
+
+      return size_t(range.second - range.first);
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    iterator lower_bound(key_parameter_t key)
+    {
+      return p_buffer + (lower_bound_implementation(key) - p_buffer);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator lower_bound(const K& key)
+    {
+      return p_buffer + (lower_bound_implementation(key) - p_buffer);
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    const_iterator lower_bound(key_parameter_t key) const
+    {
+      return lower_bound_implementation(key);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator lower_bound(const K& key) const
+    {
+      return lower_bound_implementation(key);
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    iterator upper_bound(key_parameter_t key)
+    {
+      return p_buffer + (upper_bound_implementation(key) - p_buffer);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator upper_bound(const K& key)
+    {
+      return p_buffer + (upper_bound_implementation(key) - p_buffer);
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    const_iterator upper_bound(key_parameter_t key) const
+    {
+      return upper_bound_implementation(key);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator upper_bound(const K& key) const
+    {
+      return upper_bound_implementation(key);
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(key_parameter_t key)
+    {
+      return ETL_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      return ETL_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
+    {
+      return ETL_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      return ETL_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+    }
+#endif
+
+    //*************************************************************************
+    /// Check if the container contains the key.
+    //*************************************************************************
+    bool contains(key_parameter_t key) const
+    {
+      return find(key) != end();
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    bool contains(const K& k) const
+    {
+      return find(k) != end();
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets the key comparison function.
+    //*************************************************************************
+    key_compare key_comp() const
+    {
+      return compare;
+    }
+
+    //*************************************************************************
+    /// Gets the size of the container.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Checks the 'empty' state of the container.
+    ///\return <b>true</b> if empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks the 'full' state of the container.
+    ///\return <b>true</b> if full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity of the container.
+    ///\return The capacity of the container.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum possible size of the container.
+    ///\return The maximum size of the container.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return MAX_SIZE - current_size;
+    }
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    icontiguous_flat_base(value_type* p_buffer_, size_type max_size_)
+      : p_buffer(p_buffer_)
+      , current_size(0U)
+      , MAX_SIZE(max_size_)
+    {
+    }
+
+    //*********************************************************************
+    /// Moves the elements from 'position' up by one and returns the
+    /// uninitialised slot at 'position'.
+    /// If asserts or exceptions are enabled, emits contiguous_flat_full if
+    /// the container is already full.
+    //*********************************************************************
+    void* open_gap(iterator position)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(contiguous_flat_full));
+
+      iterator itr = end();
+
+      while (itr != position)
+      {
+        ::new (itr) value_type(ETL_MOVE(*(itr - 1)));
+        --itr;
+        itr->~value_type();
+      }
+
+      ++current_size;
+
+      return position;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Opens a gap at 'position' and moves 'value' into it.
+    /// 'value' is built before the gap is opened, as the arguments that it is
+    /// built from may refer to elements that opening the gap moves.
+    //*********************************************************************
+    void insert_value(iterator position, value_type&& value)
+    {
+      ::new (open_gap(position)) value_type(etl::move(value));
+    }
+#else
+    //*********************************************************************
+    /// Opens a gap at 'position' and copies 'value' into it.
+    /// 'value' is built before the gap is opened, as the arguments that it is
+    /// built from may refer to elements that opening the gap moves.
+    //*********************************************************************
+    void insert_value(iterator position, const value_type& value)
+    {
+      ::new (open_gap(position)) value_type(value);
+    }
+#endif
+
+    //*********************************************************************
+    /// Is the element at 'position' equivalent to 'key'?
+    /// 'position' must be the lower bound of 'key'.
+    //*********************************************************************
+    template <typename K>
+    bool is_match(const_iterator position, const K& key) const
+    {
+      return (position != end()) && !compare(key, TKeyOf::get(*position));
+    }
+
+    //*********************************************************************
+    /// Returns 'hint' if it is the lower bound of 'key', otherwise searches.
+    /// Inserting sorted values at end() then costs no search.
+    //*********************************************************************
+    iterator lower_bound_from_hint(const_iterator hint, const_key_reference key)
+    {
+      const bool after_previous = (hint == begin()) || compare(TKeyOf::get(*(hint - 1)), key);
+      const bool not_before     = (hint == end()) || !compare(TKeyOf::get(*hint), key);
+
+      return (after_previous && not_before) ? p_buffer + (hint - p_buffer) : lower_bound(key);
+    }
+
+    //*********************************************************************
+    /// Returns 'hint' if it is the upper bound of 'key', otherwise searches.
+    /// Inserting sorted values at end() then costs no search.
+    //*********************************************************************
+    iterator upper_bound_from_hint(const_iterator hint, const_key_reference key)
+    {
+      const bool not_after_previous = (hint == begin()) || !compare(key, TKeyOf::get(*(hint - 1)));
+      const bool before             = (hint == end()) || compare(key, TKeyOf::get(*hint));
+
+      return (not_after_previous && before) ? p_buffer + (hint - p_buffer) : upper_bound(key);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Moves the elements of another container into this one.
+    //*************************************************************************
+    void move_container(icontiguous_flat_base&& rhs)
+    {
+      if (&rhs != this)
+      {
+        clear();
+
+        iterator itr = rhs.begin();
+
+        while (itr != rhs.end())
+        {
+          ::new (end()) value_type(etl::move(*itr));
+          ++current_size;
+          ++itr;
+        }
+
+        rhs.clear();
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Appends a copy of every element of another container, which must be
+    /// in order.
+    //*************************************************************************
+    void copy_container(const icontiguous_flat_base& rhs)
+    {
+      if (&rhs != this)
+      {
+        clear();
+
+        const_iterator itr = rhs.begin();
+
+        while (itr != rhs.end())
+        {
+          ::new (end()) value_type(*itr);
+          ++current_size;
+          ++itr;
+        }
+      }
+    }
+
+  private:
+
+    //*********************************************************************
+    /// Compares an element with a key, for lower bound searches.
+    //*********************************************************************
+    struct element_less_key
+    {
+      element_less_key(const key_compare& compare_)
+        : compare(compare_)
+      {
+      }
+
+      template <typename K>
+      bool operator()(const value_type& element, const K& key) const
+      {
+        return compare(TKeyOf::get(element), key);
+      }
+
+      const key_compare& compare;
+    };
+
+    //*********************************************************************
+    /// Compares a key with an element, for upper bound searches.
+    //*********************************************************************
+    struct key_less_element
+    {
+      key_less_element(const key_compare& compare_)
+        : compare(compare_)
+      {
+      }
+
+      template <typename K>
+      bool operator()(const K& key, const value_type& element) const
+      {
+        return compare(key, TKeyOf::get(element));
+      }
+
+      const key_compare& compare;
+    };
+
+    //*********************************************************************
+    template <typename K>
+    const_iterator lower_bound_implementation(const K& key) const
+    {
+      return etl::branchless_lower_bound(cbegin(), cend(), key, element_less_key(compare));
+    }
+
+    //*********************************************************************
+    template <typename K>
+    const_iterator upper_bound_implementation(const K& key) const
+    {
+      return etl::branchless_upper_bound(cbegin(), cend(), key, key_less_element(compare));
+    }
+
+    //*********************************************************************
+    template <typename K>
+    const_iterator find_implementation(const K& key) const
+    {
+      const_iterator itr = lower_bound_implementation(key);
+
+      return is_match(itr, key) ? itr : cend();
+    }
+
+    // Disable copy construction.
+    icontiguous_flat_base(const icontiguous_flat_base&);
+
+    value_type*     p_buffer;     ///< The sorted elements.
+    size_type       current_size; ///< The number of elements.
+    const size_type MAX_SIZE;     ///< The maximum number of elements.
+    key_compare     compare;      ///< The key comparison.
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_CONTIGUOUS_FLAT) || defined(ETL_POLYMORPHIC_CONTAINERS)
+
+  public:
+
+    virtual ~icontiguous_flat_base() {}
+#else
+
+  protected:
+
+    ~icontiguous_flat_base() {}
+#endif
+  };
+} // namespace etl
+
+#endif
@@ -41,6 +41,10 @@ SOFTWARE.
 
 #include "crc_parameters.h"
 
+#if ETL_USING_CRC32C_INSTRUCTIONS
+  #include <nmmintrin.h>
+#endif
+
 #if defined(ETL_COMPILER_KEIL)
   #pragma diag_suppress 1300
 #endif
@@ -613,6 +617,413 @@ namespace etl
           template <typename TAccumulator, size_t Accumulator_Bits, size_t Chunk_Bits, uint8_t Chunk_Mask, TAccumulator Polynomial, bool Reflect>
           ETL_CONSTANT TAccumulator crc_table<TAccumulator, Accumulator_Bits, Chunk_Bits, Chunk_Mask, Polynomial, Reflect, 256U>::table[256U];
 #endif
+          //*****************************************************************************
+          /// CRC Slice Table Entry
+          /// The CRC of byte 'Index' followed by 'Slice' zero bytes.
+          //*****************************************************************************
+          template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slice, size_t Index>
+          class crc_slice_table_entry
+          {
+          private:
+
+            static ETL_CONSTANT TAccumulator Previous = crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice - 1U, Index>::value;
+            static ETL_CONSTANT size_t       Next_Index =
+              Reflect ? size_t(Previous & 0xFFU) : size_t((Previous >> (Accumulator_Bits - 8U)) & 0xFFU);
+            static ETL_CONSTANT TAccumulator Shifted = Reflect ? TAccumulator(Previous >> 8U) : TAccumulator(Previous << 8U);
+
+          public:
+
+            static ETL_CONSTANT TAccumulator value =
+              TAccumulator(Shifted ^ crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Next_Index, 8U>::value);
+          };
+
+          template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slice, size_t Index>
+          ETL_CONSTANT TAccumulator crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, Index>::Previous;
+
+          template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slice, size_t Index>
+          ETL_CONSTANT size_t crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, Index>::Next_Index;
+
+          template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slice, size_t Index>
+          ETL_CONSTANT TAccumulator crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, Index>::Shifted;
+
+          template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slice, size_t Index>
+          ETL_CONSTANT TAccumulator crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, Index>::value;
+
+          //*********************************
+          // Slice 0 is the standard 256 entry table.
+          template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index>
+          class crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 0U, Index>
+          {
+          public:
+
+            static ETL_CONSTANT TAccumulator value = crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, 8U>::value;
+          };
+
+          template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index>
+          ETL_CONSTANT TAccumulator crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 0U, Index>::value;
+
+          //*****************************************************************************
+          /// CRC Slice Table
+          /// One of the 256 entry tables used by the slicing-by-N algorithm.
+          //*****************************************************************************
+          template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slice>
+          struct crc_slice_table
+          {
+            //*************************************************************************
+#if !ETL_USING_CPP11
+            static TAccumulator lookup(uint8_t index)
+            {
+#endif
+              static ETL_CONSTANT TAccumulator table[256U] = {crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 0U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 1U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 2U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 3U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 4U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 5U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 6U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 7U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 8U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 9U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 10U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 11U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 12U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 13U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 14U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 15U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 16U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 17U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 18U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 19U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 20U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 21U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 22U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 23U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 24U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 25U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 26U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 27U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 28U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 29U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 30U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 31U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 32U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 33U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 34U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 35U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 36U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 37U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 38U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 39U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 40U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 41U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 42U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 43U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 44U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 45U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 46U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 47U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 48U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 49U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 50U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 51U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 52U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 53U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 54U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 55U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 56U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 57U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 58U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 59U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 60U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 61U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 62U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 63U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 64U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 65U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 66U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 67U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 68U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 69U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 70U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 71U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 72U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 73U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 74U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 75U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 76U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 77U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 78U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 79U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 80U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 81U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 82U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 83U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 84U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 85U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 86U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 87U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 88U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 89U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 90U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 91U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 92U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 93U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 94U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 95U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 96U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 97U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 98U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 99U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 100U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 101U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 102U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 103U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 104U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 105U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 106U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 107U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 108U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 109U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 110U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 111U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 112U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 113U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 114U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 115U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 116U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 117U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 118U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 119U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 120U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 121U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 122U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 123U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 124U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 125U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 126U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 127U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 128U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 129U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 130U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 131U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 132U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 133U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 134U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 135U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 136U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 137U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 138U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 139U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 140U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 141U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 142U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 143U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 144U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 145U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 146U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 147U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 148U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 149U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 150U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 151U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 152U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 153U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 154U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 155U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 156U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 157U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 158U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 159U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 160U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 161U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 162U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 163U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 164U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 165U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 166U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 167U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 168U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 169U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 170U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 171U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 172U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 173U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 174U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 175U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 176U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 177U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 178U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 179U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 180U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 181U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 182U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 183U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 184U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 185U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 186U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 187U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 188U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 189U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 190U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 191U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 192U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 193U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 194U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 195U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 196U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 197U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 198U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 199U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 200U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 201U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 202U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 203U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 204U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 205U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 206U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 207U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 208U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 209U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 210U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 211U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 212U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 213U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 214U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 215U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 216U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 217U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 218U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 219U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 220U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 221U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 222U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 223U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 224U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 225U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 226U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 227U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 228U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 229U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 230U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 231U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 232U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 233U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 234U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 235U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 236U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 237U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 238U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 239U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 240U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 241U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 242U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 243U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 244U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 245U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 246U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 247U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 248U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 249U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 250U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 251U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 252U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 253U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 254U>::value,
+                                                              crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice, 255U>::value};
+#if ETL_USING_CPP11
+            static ETL_CONSTEXPR14 TAccumulator lookup(uint8_t index)
+            {
+#endif
+              return table[index];
+            }
+          };
+#if ETL_USING_CPP11
+          template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slice>
+          ETL_CONSTANT TAccumulator crc_slice_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice>::table[256U];
+#endif
+
+          //*****************************************************************************
+          /// CRC Slice Block
+          /// Calculates the CRC contribution of bytes J to Slices - 1 of a block.
+          /// The first bytes of the block have the current CRC folded in to them.
+          //*****************************************************************************
+          template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices, size_t J>
+          struct crc_slice_block
+          {
+            static ETL_CONSTANT size_t Accumulator_Bytes = Accumulator_Bits / 8U;
+            static ETL_CONSTANT bool   Has_Crc_Byte      = (J < Accumulator_Bytes);
+            static ETL_CONSTANT size_t Crc_Byte          = Has_Crc_Byte ? J : 0U;
+            static ETL_CONSTANT size_t Crc_Shift         = Reflect ? (Crc_Byte * 8U) : (Accumulator_Bits - 8U - (Crc_Byte * 8U));
+
+            template <typename TPointer>
+            static ETL_CONSTEXPR14 TAccumulator calculate(TAccumulator crc, TPointer p)
+            {
+              uint8_t value = static_cast<uint8_t>(p[J]);
+
+              if (Has_Crc_Byte)
+              {
+                value ^= static_cast<uint8_t>(crc >> Crc_Shift);
+              }
+
+              return TAccumulator(crc_slice_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slices - 1U - J>::lookup(value)
+                                  ^ crc_slice_block<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slices, J + 1U>::calculate(crc, p));
+            }
+          };
+
+          //*********************************
+          // The end of the block.
+          template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices>
+          struct crc_slice_block<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slices, Slices>
+          {
+            template <typename TPointer>
+            static ETL_CONSTEXPR14 TAccumulator calculate(TAccumulator, TPointer)
+            {
+              return TAccumulator(0U);
+            }
+          };
+
+#if ETL_USING_CRC32C_INSTRUCTIONS
+          //*****************************************************************************
+          /// CRC32-C using the SSE4.2 crc32 instruction.
+          /// Takes and returns the reflected CRC register.
+          //*****************************************************************************
+          inline uint32_t crc32_c_instructions(uint32_t crc, const uint8_t* p, const uint8_t* end)
+          {
+  #if defined(__x86_64__) || defined(_M_X64)
+            uint64_t crc64 = crc;
+
+            while ((end - p) >= 8)
+            {
+              const uint64_t word = static_cast<uint64_t>(p[0]) | (static_cast<uint64_t>(p[1]) << 8U) | (static_cast<uint64_t>(p[2]) << 16U)
+                                    | (static_cast<uint64_t>(p[3]) << 24U) | (static_cast<uint64_t>(p[4]) << 32U) | (static_cast<uint64_t>(p[5]) << 40U)
+                                    | (static_cast<uint64_t>(p[6]) << 48U) | (static_cast<uint64_t>(p[7]) << 56U);
+
+              crc64 = _mm_crc32_u64(crc64, word);
+              p += 8;
+            }
+
+            crc = static_cast<uint32_t>(crc64);
+  #else
+            while ((end - p) >= 4)
+            {
+              const uint32_t word = static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8U) | (static_cast<uint32_t>(p[2]) << 16U)
+                                    | (static_cast<uint32_t>(p[3]) << 24U);
+
+              crc = _mm_crc32_u32(crc, word);
+              p += 4;
+            }
+  #endif
+
+            while (p != end)
+            {
+              crc = _mm_crc32_u8(crc, *p);
+              ++p;
+            }
+
+            return crc;
+          }
+#endif
+
           //*****************************************************************************
           // CRC Policies.
           //*****************************************************************************
@@ -687,6 +1098,92 @@ namespace etl
               return crc ^ TCrcParameters::Xor_Out;
             }
           };
+
+          //*********************************
+          // Policy for slicing-by-N tables.
+          template <typename TCrcParameters, size_t Slices>
+          struct crc_slicing_policy
+          {
+            typedef typename TCrcParameters::accumulator_type accumulator_type;
+            typedef accumulator_type                          value_type;
+
+            typedef crc_slice_table<accumulator_type, TCrcParameters::Accumulator_Bits, TCrcParameters::Polynomial, TCrcParameters::Reflect, 0U>
+              table_type;
+            typedef crc_slice_block<accumulator_type, TCrcParameters::Accumulator_Bits, TCrcParameters::Polynomial, TCrcParameters::Reflect, Slices, 0U>
+              block_type;
+
+            //*************************************************************************
+            ETL_CONSTEXPR accumulator_type initial() const
+            {
+              return TCrcParameters::Reflect ? etl::reverse_bits_const<accumulator_type, TCrcParameters::Initial>::value : TCrcParameters::Initial;
+            }
+
+            //*************************************************************************
+            ETL_CONSTEXPR14 accumulator_type add(accumulator_type crc, uint8_t value) const
+            {
+              if ETL_IF_CONSTEXPR (TCrcParameters::Reflect)
+              {
+                value ^= static_cast<uint8_t>(crc);
+                crc = accumulator_type(crc >> 8U);
+              }
+              else
+              {
+                value ^= static_cast<uint8_t>(crc >> (TCrcParameters::Accumulator_Bits - 8U));
+                crc = accumulator_type(crc << 8U);
+              }
+
+              return accumulator_type(crc ^ table_type::lookup(value));
+            }
+
+            //*************************************************************************
+            /// Adds a contiguous block, Slices bytes at a time.
+            //*************************************************************************
+            template <typename TPointer>
+            ETL_CONSTEXPR14 accumulator_type add_block(accumulator_type crc, TPointer begin, const TPointer end) const
+            {
+#if ETL_USING_CRC32C_INSTRUCTIONS
+              if (etl::is_same<TCrcParameters, crc32_c_parameters>::value && !etl::is_constant_evaluated())
+              {
+                return static_cast<accumulator_type>(crc32_c_instructions(static_cast<uint32_t>(crc), reinterpret_cast<const uint8_t*>(begin),
+                                                                          reinterpret_cast<const uint8_t*>(end)));
+              }
+#endif
+
+              while (static_cast<size_t>(end - begin) >= Slices)
+              {
+                crc = block_type::calculate(crc, begin);
+                begin += Slices;
+              }
+
+              while (begin != end)
+              {
+                crc = add(crc, static_cast<uint8_t>(*begin));
+                ++begin;
+              }
+
+              return crc;
+            }
+
+            //*************************************************************************
+            ETL_CONSTEXPR accumulator_type final(accumulator_type crc) const
+            {
+              return crc ^ TCrcParameters::Xor_Out;
+            }
+          };
+
+          //*********************************
+          // Policy for slicing-by-8 tables.
+          template <typename TCrcParameters>
+          struct crc_policy<TCrcParameters, 2048U> : public crc_slicing_policy<TCrcParameters, 8U>
+          {
+          };
+
+          //*********************************
+          // Policy for slicing-by-16 tables.
+          template <typename TCrcParameters>
+          struct crc_policy<TCrcParameters, 4096U> : public crc_slicing_policy<TCrcParameters, 16U>
+          {
+          };
         }
 
         //*****************************************************************************
@@ -695,9 +1192,18 @@ namespace etl
         template <typename TCrcParameters, size_t Table_Size>
         class crc_type : public etl::frame_check_sequence< private_crc::crc_policy<TCrcParameters, Table_Size> >
         {
+        private:
+
+          typedef etl::frame_check_sequence< private_crc::crc_policy<TCrcParameters, Table_Size> > base_t;
+
+          static ETL_CONSTANT bool Is_Slicing = (Table_Size == 2048U) || (Table_Size == 4096U);
+
         public:
 
-          ETL_STATIC_ASSERT((Table_Size == 4U) || (Table_Size == 16U) || (Table_Size == 256U), "Table size must be 4, 16 or 256");
+          ETL_STATIC_ASSERT((Table_Size == 4U) || (Table_Size == 16U) || (Table_Size == 256U) || Is_Slicing,
+                            "Table size must be 4, 16, 256, 2048 (slicing-by-8) or 4096 (slicing-by-16)");
+
+          using base_t::add;
 
           //*************************************************************************
           /// Default constructor.
@@ -718,7 +1224,40 @@ namespace etl
             this->reset();
             this->add(begin, end);
           }
+
+          //*************************************************************************
+          /// Adds a range.
+          /// Contiguous ranges are processed a block at a time by the slicing tables.
+          /// \param begin
+          /// \param end
+          //*************************************************************************
+          template <typename TIterator>
+          ETL_CONSTEXPR14 void add(TIterator begin, const TIterator end)
+          {
+            add_range(begin, end, etl::integral_constant<bool, Is_Slicing && etl::is_pointer<TIterator>::value>());
+          }
+
+        private:
+
+          //*************************************************************************
+          template <typename TIterator>
+          ETL_CONSTEXPR14 void add_range(TIterator begin, const TIterator end, etl::false_type)
+          {
+            base_t::add(begin, end);
+          }
+
+          //*************************************************************************
+          template <typename TPointer>
+          ETL_CONSTEXPR14 void add_range(TPointer begin, const TPointer end, etl::true_type)
+          {
+            ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TPointer>::value_type) == 1, "Type not supported");
+
+            this->frame_check = this->policy.add_block(this->frame_check, begin, end);
+          }
         };
+
+        template <typename TCrcParameters, size_t Table_Size>
+        ETL_CONSTANT bool crc_type<TCrcParameters, Table_Size>::Is_Slicing;
       }
 
 #endif
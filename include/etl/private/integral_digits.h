@@ -0,0 +1,239 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INTEGRAL_DIGITS_INCLUDED
+#define ETL_INTEGRAL_DIGITS_INCLUDED
+
+///\ingroup private
+
+#include "../platform.h"
+#include "../type_traits.h"
+
+#include <stdint.h>
+
+namespace etl
+{
+  namespace private_integral_digits
+  {
+    //***************************************************************************
+    /// The digit characters, "00" to "99" and "0" to "z".
+    //***************************************************************************
+    template <typename TDummy = void>
+    struct digit_tables
+    {
+      static const char pairs[200];
+      static const char lower[36];
+      static const char upper[36];
+    };
+
+    template <typename TDummy>
+    const char digit_tables<TDummy>::pairs[200] = {
+      '0', '0', '0', '1', '0', '2', '0', '3', '0', '4', '0', '5', '0', '6', '0', '7', '0', '8', '0', '9', '1', '0', '1', '1', '1', '2', '1',
+      '3', '1', '4', '1', '5', '1', '6', '1', '7', '1', '8', '1', '9', '2', '0', '2', '1', '2', '2', '2', '3', '2', '4', '2', '5', '2', '6',
+      '2', '7', '2', '8', '2', '9', '3', '0', '3', '1', '3', '2', '3', '3', '3', '4', '3', '5', '3', '6', '3', '7', '3', '8', '3', '9', '4',
+      '0', '4', '1', '4', '2', '4', '3', '4', '4', '4', '5', '4', '6', '4', '7', '4', '8', '4', '9', '5', '0', '5', '1', '5', '2', '5', '3',
+      '5', '4', '5', '5', '5', '6', '5', '7', '5', '8', '5', '9', '6', '0', '6', '1', '6', '2', '6', '3', '6', '4', '6', '5', '6', '6', '6',
+      '7', '6', '8', '6', '9', '7', '0', '7', '1', '7', '2', '7', '3', '7', '4', '7', '5', '7', '6', '7', '7', '7', '8', '7', '9', '8', '0',
+      '8', '1', '8', '2', '8', '3', '8', '4', '8', '5', '8', '6', '8', '7', '8', '8', '8', '9', '9', '0', '9', '1', '9', '2', '9', '3', '9',
+      '4', '9', '5', '9', '6', '9', '7', '9', '8', '9', '9'};
+
+    template <typename TDummy>
+    const char digit_tables<TDummy>::lower[36] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h',
+                                                  'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z'};
+
+    template <typename TDummy>
+    const char digit_tables<TDummy>::upper[36] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H',
+                                                  'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z'};
+
+    //***************************************************************************
+    /// The shift for a power of 2 base, or 0 if it is not a power of 2.
+    //***************************************************************************
+    inline uint32_t base_shift(uint32_t base)
+    {
+      switch (base)
+      {
+        case 2U:  return 1U;
+        case 4U:  return 2U;
+        case 8U:  return 3U;
+        case 16U: return 4U;
+        case 32U: return 5U;
+        default:  return 0U;
+      }
+    }
+
+    //***************************************************************************
+    /// The number of decimal digits in the value.
+    //***************************************************************************
+    template <typename TUnsigned>
+    size_t count_decimal_digits(TUnsigned value)
+    {
+      size_t count = 1U;
+
+      while (value >= 10000U)
+      {
+        value /= 10000U;
+        count += 4U;
+      }
+
+      return count + (value >= 10U) + (value >= 100U) + (value >= 1000U);
+    }
+
+    //***************************************************************************
+    /// The number of digits in the value for any base.
+    //***************************************************************************
+    template <typename TUnsigned>
+    size_t count_digits(TUnsigned value, uint32_t base)
+    {
+      if (base == 10U)
+      {
+        return count_decimal_digits(value);
+      }
+
+      size_t count = 1U;
+
+      const uint32_t shift = base_shift(base);
+
+      if (shift != 0U)
+      {
+        while ((value >>= shift) != 0U)
+        {
+          ++count;
+        }
+      }
+      else
+      {
+        while ((value /= base) != 0U)
+        {
+          ++count;
+        }
+      }
+
+      return count;
+    }
+
+    //***************************************************************************
+    /// Writes the decimal digits of the value, two at a time, backwards from
+    /// 'last'. Returns a pointer to the first digit.
+    //***************************************************************************
+    template <typename TChar>
+    TChar* write_decimal_digits(TChar* last, uint32_t value)
+    {
+      const char* pairs = digit_tables<>::pairs;
+
+      while (value >= 100U)
+      {
+        const uint32_t index = (value % 100U) * 2U;
+        value /= 100U;
+        *--last = TChar(pairs[index + 1U]);
+        *--last = TChar(pairs[index]);
+      }
+
+      if (value >= 10U)
+      {
+        const uint32_t index = value * 2U;
+        *--last = TChar(pairs[index + 1U]);
+        *--last = TChar(pairs[index]);
+      }
+      else
+      {
+        *--last = TChar('0' + value);
+      }
+
+      return last;
+    }
+
+#if ETL_USING_64BIT_TYPES
+    //***************************************************************************
+    /// 64 bit values are divided in 64 bits only until they fit in 32 bits.
+    //***************************************************************************
+    template <typename TChar>
+    TChar* write_decimal_digits(TChar* last, uint64_t value)
+    {
+      const char* pairs = digit_tables<>::pairs;
+
+      while ((value >> 32U) != 0U)
+      {
+        const uint32_t index = static_cast<uint32_t>(value % 100U) * 2U;
+        value /= 100U;
+        *--last = TChar(pairs[index + 1U]);
+        *--last = TChar(pairs[index]);
+      }
+
+      return write_decimal_digits(last, static_cast<uint32_t>(value));
+    }
+#endif
+
+    //***************************************************************************
+    /// Writes the digits of the value backwards from 'last'.
+    /// Returns a pointer to the first digit.
+    //***************************************************************************
+    template <typename TChar, typename TUnsigned>
+    TChar* write_digits(TChar* last, TUnsigned value, uint32_t base, bool upper_case)
+    {
+      if (base == 10U)
+      {
+#if ETL_USING_64BIT_TYPES
+        typedef typename etl::conditional<(sizeof(TUnsigned) > sizeof(uint32_t)), uint64_t, uint32_t>::type workspace_t;
+#else
+        typedef uint32_t workspace_t;
+#endif
+
+        return write_decimal_digits(last, workspace_t(value));
+      }
+
+      const char* digits = upper_case ? digit_tables<>::upper : digit_tables<>::lower;
+
+      const uint32_t shift = base_shift(base);
+
+      if (shift != 0U)
+      {
+        const TUnsigned mask = TUnsigned(base - 1U);
+
+        do
+        {
+          *--last = TChar(digits[value & mask]);
+          value >>= shift;
+        } while (value != 0U);
+      }
+      else
+      {
+        do
+        {
+          *--last = TChar(digits[value % base]);
+          value /= base;
+        } while (value != 0U);
+      }
+
+      return last;
+    }
+  } // namespace private_integral_digits
+} // namespace etl
+
+#endif
@@ -0,0 +1,342 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STRING_SEARCH_INCLUDED
+#define ETL_STRING_SEARCH_INCLUDED
+
+///\ingroup private
+
+#include "../platform.h"
+#include "../binary.h"
+#include "../type_traits.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if ETL_USING_STRING_SEARCH_SSE2
+  #include <emmintrin.h>
+#endif
+
+namespace etl
+{
+  namespace private_string_search
+  {
+    //*************************************************************************
+    /// Can memchr, memcmp and the SIMD searches be used?
+    /// They cannot be called during constant evaluation, so are only used
+    /// when it can be detected.
+    //*************************************************************************
+    ETL_CONSTEXPR inline bool is_run_time() ETL_NOEXCEPT
+    {
+#if ETL_USING_CPP23 || (ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED == 1)
+      return !etl::is_constant_evaluated();
+#else
+      return false;
+#endif
+    }
+
+    //*************************************************************************
+    /// Finds the first 'c' in [first, last).
+    ///\returns A pointer to the character, or 'last' if not found.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 const T* find_character(const T* first, const T* last, T c) ETL_NOEXCEPT
+    {
+      if ((sizeof(T) == 1U) && is_run_time())
+      {
+#include "diagnostic_array_bounds_push.h"
+#include "diagnostic_stringop_overread_push.h"
+        const void* p = memchr(first, static_cast<unsigned char>(c), static_cast<size_t>(last - first));
+#include "diagnostic_pop.h"
+#include "diagnostic_pop.h"
+
+        return (p == ETL_NULLPTR) ? last : static_cast<const T*>(p);
+      }
+
+      while ((first != last) && !(*first == c))
+      {
+        ++first;
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    /// Are the 'length' characters at 'a' and 'b' equal?
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 bool equal(const T* a, const T* b, size_t length) ETL_NOEXCEPT
+    {
+      if ((sizeof(T) == 1U) && is_run_time())
+      {
+        return memcmp(a, b, length) == 0;
+      }
+
+      while (length-- != 0U)
+      {
+        if (!(*a++ == *b++))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+#if ETL_USING_STRING_SEARCH_SSE2
+    //*************************************************************************
+    /// Compares the first and last characters of the substring with 16
+    /// positions at a time, then checks the middle of each candidate.
+    /// Stops when fewer than 16 positions remain before 'final'.
+    ///\returns A pointer to the match, or to the first position not checked.
+    //*************************************************************************
+    template <typename T>
+    const T* find_substring_sse2(const T* first, const T* final, const T* sfirst, size_t length, bool& found) ETL_NOEXCEPT
+    {
+      const __m128i head = _mm_set1_epi8(static_cast<char>(sfirst[0]));
+      const __m128i tail = _mm_set1_epi8(static_cast<char>(sfirst[length - 1U]));
+
+      found = false;
+
+      while ((final - first) >= 16)
+      {
+        const __m128i block_head = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+        const __m128i block_tail = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + length - 1U));
+
+        uint32_t candidates = static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(block_head, head), _mm_cmpeq_epi8(block_tail, tail))));
+
+        while (candidates != 0U)
+        {
+          const T* candidate = first + etl::count_trailing_zeros(candidates);
+
+          if (memcmp(candidate + 1U, sfirst + 1U, length - 2U) == 0)
+          {
+            found = true;
+            return candidate;
+          }
+
+          candidates &= candidates - 1U;
+        }
+
+        first += 16;
+      }
+
+      return first;
+    }
+#endif
+
+    //*************************************************************************
+    /// Finds the first occurrence of [sfirst, slast) in [first, last).
+    /// Candidates are found by the first character and filtered by the last
+    /// before the rest are compared.
+    ///\returns A pointer to the match, or 'last' if not found.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 const T* find_substring(const T* first, const T* last, const T* sfirst, const T* slast) ETL_NOEXCEPT
+    {
+      const size_t length = static_cast<size_t>(slast - sfirst);
+
+      if (length == 0U)
+      {
+        return first;
+      }
+
+      if (static_cast<size_t>(last - first) < length)
+      {
+        return last;
+      }
+
+      if (length == 1U)
+      {
+        return find_character(first, last, *sfirst);
+      }
+
+      // One past the last position that a match could start at.
+      const T* const final = last - (length - 1U);
+
+#if ETL_USING_STRING_SEARCH_SSE2
+      if ((sizeof(T) == 1U) && is_run_time())
+      {
+        bool found = false;
+
+        first = find_substring_sse2(first, final, sfirst, length, found);
+
+        if (found)
+        {
+          return first;
+        }
+      }
+#endif
+
+      const T head = sfirst[0];
+      const T tail = sfirst[length - 1U];
+
+      while (first != final)
+      {
+        first = find_character(first, final, head);
+
+        if (first == final)
+        {
+          break;
+        }
+
+        if ((first[length - 1U] == tail) && equal(first + 1U, sfirst + 1U, length - 2U))
+        {
+          return first;
+        }
+
+        ++first;
+      }
+
+      return last;
+    }
+
+    //*************************************************************************
+    /// A set of characters.
+    /// Those below 256 are held in a bitmap. Any others are compared with
+    /// the characters of the set.
+    //*************************************************************************
+    template <typename T>
+    class character_set
+    {
+    public:
+
+      //***********************************
+      ETL_CONSTEXPR14 character_set(const T* first_, const T* last_) ETL_NOEXCEPT
+        : bits()
+        , first(first_)
+        , last(last_)
+        , has_wide(false)
+      {
+        for (const T* p = first; p != last; ++p)
+        {
+          const uint32_t c = code(*p);
+
+          if (c < 256U)
+          {
+            bits[c >> 5U] |= uint32_t(1U) << (c & 31U);
+          }
+          else
+          {
+            has_wide = true;
+          }
+        }
+      }
+
+      //***********************************
+      ETL_CONSTEXPR14 bool contains(T c) const ETL_NOEXCEPT
+      {
+        const uint32_t u = code(c);
+
+        if (u < 256U)
+        {
+          return (bits[u >> 5U] & (uint32_t(1U) << (u & 31U))) != 0U;
+        }
+
+        if (has_wide)
+        {
+          for (const T* p = first; p != last; ++p)
+          {
+            if (*p == c)
+            {
+              return true;
+            }
+          }
+        }
+
+        return false;
+      }
+
+    private:
+
+      //***********************************
+      static ETL_CONSTEXPR uint32_t code(T c) ETL_NOEXCEPT
+      {
+        return (sizeof(T) == 1U) ? uint32_t(static_cast<unsigned char>(c)) : uint32_t(c);
+      }
+
+      uint32_t bits[8];
+      const T* first;
+      const T* last;
+      bool     has_wide;
+    };
+
+    //*************************************************************************
+    /// Finds the first character in [first, last) that is, or is not, in the
+    /// set [sfirst, slast).
+    ///\returns A pointer to the character, or 'last' if not found.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 const T* find_first_in_set(const T* first, const T* last, const T* sfirst, const T* slast, bool in_set) ETL_NOEXCEPT
+    {
+      if (in_set && ((slast - sfirst) == 1))
+      {
+        return find_character(first, last, *sfirst);
+      }
+
+      const character_set<T> set(sfirst, slast);
+
+      while ((first != last) && (set.contains(*first) != in_set))
+      {
+        ++first;
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    /// Finds the last character in [first, last) that is, or is not, in the
+    /// set [sfirst, slast).
+    ///\returns A pointer to the character, or 'last' if not found.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 const T* find_last_in_set(const T* first, const T* last, const T* sfirst, const T* slast, bool in_set) ETL_NOEXCEPT
+    {
+      const character_set<T> set(sfirst, slast);
+
+      const T* p = last;
+
+      while (p != first)
+      {
+        --p;
+
+        if (set.contains(*p) == in_set)
+        {
+          return p;
+        }
+      }
+
+      return last;
+    }
+  } // namespace private_string_search
+} // namespace etl
+
+#endif
@@ -0,0 +1,371 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TIMER_WHEEL_INCLUDED
+#define ETL_TIMER_WHEEL_INCLUDED
+
+#include "../platform.h"
+#include "../timer.h"
+
+#include <stdint.h>
+
+namespace etl
+{
+  namespace private_timer
+  {
+    //*************************************************************************
+    /// Constants for the timer wheel.
+    //*************************************************************************
+    struct timer_wheel_constants
+    {
+      static ETL_CONSTANT uint_least8_t Slot_Bits       = 5U;
+      static ETL_CONSTANT uint_least8_t Slots_Per_Level = 32U;
+      static ETL_CONSTANT uint32_t      Slot_Mask       = 0x1FUL;
+      static ETL_CONSTANT uint_least8_t Levels          = 7U; // 7 x 5 bits covers the 32 bit tick range.
+      static ETL_CONSTANT uint_least8_t Number_Of_Slots = 224U;
+      static ETL_CONSTANT uint_least8_t No_Slot         = 0xFFU;
+    };
+
+    //*************************************************************************
+    /// A hierarchical timing wheel of intrusively linked timers.
+    /// TTimer must have 'id', 'previous', 'next', 'expiry' and 'slot' members.
+    /// Level 0 has a slot for each of the next 32 ticks; each level above
+    /// has slots 32 times wider. A timer is placed by how far away its
+    /// expiry is and cascades down a level each time the level below wraps,
+    /// so insert and remove are O(1) and each timer is moved at most once
+    /// per level.
+    /// Timers that expire on the same tick are returned in an unspecified order.
+    //*************************************************************************
+    template <typename TTimer>
+    class timer_wheel : public timer_wheel_constants
+    {
+    public:
+
+      //*******************************
+      timer_wheel(TTimer* ptimers_)
+        : ptimers(ptimers_)
+        , now(0U)
+        , active_count(0U)
+      {
+        reset();
+      }
+
+      //*******************************
+      bool empty() const
+      {
+        return active_count == 0U;
+      }
+
+      //*******************************
+      /// Inserts the timer to expire 'delay' ticks from now.
+      /// A delay of zero expires on the next call to expire().
+      //*******************************
+      void insert(etl::timer::id::type id_, uint32_t delay)
+      {
+        TTimer& timer = ptimers[id_];
+
+        timer.expiry = now + delay;
+        link(timer, slot_for(delay, timer.expiry));
+        ++active_count;
+      }
+
+      //*******************************
+      void remove(etl::timer::id::type id_)
+      {
+        unlink(ptimers[id_]);
+        --active_count;
+      }
+
+      //*******************************
+      /// Advances time by up to 'count' ticks, stopping at the first timer to expire.
+      /// Returns the id of the expired timer, which has been removed from the wheel,
+      /// or etl::timer::id::NO_TIMER if 'count' ticks elapsed without an expiry.
+      /// 'count' is reduced by the number of ticks consumed, so repeated calls
+      /// return expired timers in time order.
+      /// A timer inserted while handling an expiry is timed from that expiry.
+      //*******************************
+      etl::timer::id::type expire(uint32_t& count)
+      {
+        while (true)
+        {
+          const uint_least8_t current = static_cast<uint_least8_t>(now & Slot_Mask);
+
+          if (heads[current] != etl::timer::id::NO_TIMER)
+          {
+            etl::timer::id::type id = heads[current];
+            remove(id);
+
+            return id;
+          }
+
+          if (count == 0U)
+          {
+            return etl::timer::id::NO_TIMER;
+          }
+
+          const uint32_t step = empty() ? count : ticks_to_next_slot();
+
+          if (step > count)
+          {
+            now += count;
+            count = 0U;
+
+            return etl::timer::id::NO_TIMER;
+          }
+
+          now += step;
+          count -= step;
+
+          if ((now & Slot_Mask) == 0U)
+          {
+            cascade();
+          }
+        }
+      }
+
+      //*******************************
+      /// The number of ticks until the next timer expires.
+      /// Returns etl::timer::interval::No_Active_Interval if there is no active timer.
+      //*******************************
+      uint32_t time_to_next() const
+      {
+        uint32_t delta = static_cast<uint32_t>(etl::timer::interval::No_Active_Interval);
+
+        if (empty())
+        {
+          return delta;
+        }
+
+        for (uint_least8_t level = 0U; level < Levels; ++level)
+        {
+          const uint_least8_t shift   = static_cast<uint_least8_t>(level * Slot_Bits);
+          const uint_least8_t current = static_cast<uint_least8_t>((now >> shift) & Slot_Mask);
+
+          if (occupied[level] != 0U)
+          {
+            // Slots are in time order starting after the current one,
+            // so only the first occupied slot on each level can hold the earliest timer.
+            // The current slot on level 0 is already due.
+            uint_least8_t offset = (level == 0U) ? 0U : 1U;
+
+            while ((occupied[level] & (uint32_t(1U) << ((current + offset) & Slot_Mask))) == 0U)
+            {
+              ++offset;
+            }
+
+            etl::timer::id::type id = heads[(level * Slots_Per_Level) + ((current + offset) & Slot_Mask)];
+
+            while (id != etl::timer::id::NO_TIMER)
+            {
+              const uint32_t remaining = ptimers[id].expiry - now;
+
+              delta = (remaining < delta) ? remaining : delta;
+              id    = ptimers[id].next;
+            }
+          }
+        }
+
+        return delta;
+      }
+
+      //*******************************
+      void clear()
+      {
+        for (uint_least8_t i = 0U; i < Number_Of_Slots; ++i)
+        {
+          etl::timer::id::type id = heads[i];
+
+          while (id != etl::timer::id::NO_TIMER)
+          {
+            TTimer& timer = ptimers[id];
+            id            = timer.next;
+
+            timer.previous = etl::timer::id::NO_TIMER;
+            timer.next     = etl::timer::id::NO_TIMER;
+            timer.slot     = No_Slot;
+          }
+        }
+
+        reset();
+      }
+
+    private:
+
+      //*******************************
+      // Empties all of the slots.
+      //*******************************
+      void reset()
+      {
+        for (uint_least8_t i = 0U; i < Number_Of_Slots; ++i)
+        {
+          heads[i] = etl::timer::id::NO_TIMER;
+        }
+
+        for (uint_least8_t level = 0U; level < Levels; ++level)
+        {
+          occupied[level] = 0U;
+        }
+
+        active_count = 0U;
+      }
+
+      //*******************************
+      // Selects the slot for a timer 'delay' ticks away.
+      //*******************************
+      uint_least8_t slot_for(uint32_t delay, uint32_t expiry) const
+      {
+        uint_least8_t level = 0U;
+        uint32_t      range = delay >> Slot_Bits;
+
+        while (range != 0U)
+        {
+          range >>= Slot_Bits;
+          ++level;
+        }
+
+        return static_cast<uint_least8_t>((level * Slots_Per_Level) + ((expiry >> (level * Slot_Bits)) & Slot_Mask));
+      }
+
+      //*******************************
+      // The number of ticks until 'now' next reaches an occupied slot on any level.
+      // Slots in between are empty, so can be skipped.
+      //*******************************
+      uint32_t ticks_to_next_slot() const
+      {
+        uint32_t ticks = static_cast<uint32_t>(etl::timer::interval::No_Active_Interval);
+
+        for (uint_least8_t level = 0U; level < Levels; ++level)
+        {
+          if (occupied[level] != 0U)
+          {
+            const uint_least8_t shift   = static_cast<uint_least8_t>(level * Slot_Bits);
+            const uint32_t      current = now >> shift;
+
+            uint32_t offset = 1U;
+
+            while ((occupied[level] & (uint32_t(1U) << ((current + offset) & Slot_Mask))) == 0U)
+            {
+              ++offset;
+            }
+
+            // Modulo 2^32, so the top level wraps correctly.
+            const uint32_t distance = ((current + offset) << shift) - now;
+
+            ticks = (distance < ticks) ? distance : ticks;
+          }
+        }
+
+        return ticks;
+      }
+
+      //*******************************
+      // Moves the timers in the slots that 'now' has just reached down a level.
+      // Called each time level 0 wraps.
+      //*******************************
+      void cascade()
+      {
+        for (uint_least8_t level = 1U; level < Levels; ++level)
+        {
+          const uint_least8_t shift = static_cast<uint_least8_t>(level * Slot_Bits);
+
+          // Only cascade this level if all of the levels below have wrapped.
+          if ((now & ((uint32_t(1U) << shift) - 1U)) != 0U)
+          {
+            break;
+          }
+
+          const uint_least8_t slot = static_cast<uint_least8_t>((level * Slots_Per_Level) + ((now >> shift) & Slot_Mask));
+
+          while (heads[slot] != etl::timer::id::NO_TIMER)
+          {
+            TTimer& timer = ptimers[heads[slot]];
+
+            unlink(timer);
+            link(timer, slot_for(timer.expiry - now, timer.expiry));
+          }
+        }
+      }
+
+      //*******************************
+      void link(TTimer& timer, uint_least8_t slot)
+      {
+        etl::timer::id::type& head = heads[slot];
+
+        timer.slot     = slot;
+        timer.previous = etl::timer::id::NO_TIMER;
+        timer.next     = head;
+
+        if (head != etl::timer::id::NO_TIMER)
+        {
+          ptimers[head].previous = timer.id;
+        }
+
+        head = timer.id;
+
+        occupied[slot / Slots_Per_Level] |= (uint32_t(1U) << (slot & Slot_Mask));
+      }
+
+      //*******************************
+      void unlink(TTimer& timer)
+      {
+        const uint_least8_t slot = timer.slot;
+
+        if (timer.previous == etl::timer::id::NO_TIMER)
+        {
+          heads[slot] = timer.next;
+        }
+        else
+        {
+          ptimers[timer.previous].next = timer.next;
+        }
+
+        if (timer.next != etl::timer::id::NO_TIMER)
+        {
+          ptimers[timer.next].previous = timer.previous;
+        }
+
+        if (heads[slot] == etl::timer::id::NO_TIMER)
+        {
+          occupied[slot / Slots_Per_Level] &= ~(uint32_t(1U) << (slot & Slot_Mask));
+        }
+
+        timer.previous = etl::timer::id::NO_TIMER;
+        timer.next     = etl::timer::id::NO_TIMER;
+        timer.slot     = No_Slot;
+      }
+
+      TTimer* const        ptimers;
+      uint32_t             now;
+      uint_least8_t        active_count;
+      uint32_t             occupied[Levels];
+      etl::timer::id::type heads[Number_Of_Slots];
+    };
+  } // namespace private_timer
+} // namespace etl
+
+#endif
@@ -38,11 +38,14 @@ SOFTWARE.
 #include "../algorithm.h"
 #include "../basic_format_spec.h"
 #include "../container.h"
+#include "../integral_limits.h"
 #include "../iterator.h"
 #include "../limits.h"
 #include "../math.h"
 #include "../negative.h"
 #include "../type_traits.h"
+#include "floating_point_digits.h"
+#include "integral_digits.h"
 
 #include <math.h>
 
@@ -132,14 +135,46 @@ namespace etl
       etl::private_to_string::add_alignment(str, start, format);
     }
 
+    //***************************************************************************
+    /// Writes the sign, base prefix and digits backwards from 'last'.
+    //***************************************************************************
+    template <typename TChar, typename TUnsigned>
+    void write_integral(TChar* last, TUnsigned magnitude, uint32_t base, bool upper_case, size_t prefix_length, bool add_sign)
+    {
+      TChar* first = etl::private_integral_digits::write_digits(last, magnitude, base, upper_case);
+
+      if (prefix_length == 2U)
+      {
+        if (base == 2U)
+        {
+          *--first = upper_case ? TChar('B') : TChar('b');
+        }
+        else
+        {
+          *--first = upper_case ? TChar('X') : TChar('x');
+        }
+      }
+
+      if (prefix_length != 0U)
+      {
+        *--first = TChar('0');
+      }
+
+      if (add_sign)
+      {
+        *--first = TChar('-');
+      }
+    }
+
     //***************************************************************************
     /// Helper function for integrals.
     //***************************************************************************
     template <typename T, typename TIString>
     void add_integral(T value, TIString& str, const etl::basic_format_spec<TIString>& format, bool append, const bool negative)
     {
-      typedef typename TIString::value_type type;
-      typedef typename TIString::iterator   iterator;
+      typedef typename TIString::value_type        type;
+      typedef typename TIString::iterator          iterator;
+      typedef typename etl::make_unsigned<T>::type utype;
 
       if (!append)
       {
@@ -148,67 +183,56 @@ namespace etl
 
       iterator start = str.end();
 
-      if (value == 0)
+      const uint32_t base       = format.get_base();
+      const bool     upper_case = format.is_upper_case();
+      const utype    magnitude  = etl::absolute_unsigned(value);
+
+      // If number is negative, add '-' (a negative zero might occur for
+      // fractional numbers > -1.0)
+      const bool add_sign = (base == 10U) && negative;
+
+      size_t prefix_length = 0U;
+
+      if (format.is_show_base() && (value != 0))
       {
-        // If number is negative, append '-' (a negative zero might occur for
-        // fractional numbers > -1.0)
-        if ((format.get_base() == 10U) && negative)
+        switch (base)
         {
-          str.push_back(type('-'));
+          case 2U:
+          case 16U:
+            {
+              prefix_length = 2U;
+              break;
+            }
+
+          case 8U:
+            {
+              prefix_length = 1U;
+              break;
+            }
+
+          default:
+            {
+              break;
+            }
         }
+      }
+
+      const size_t length = (add_sign ? 1U : 0U) + prefix_length + etl::private_integral_digits::count_digits(magnitude, base);
 
-        str.push_back(type('0'));
+      if (length <= str.available())
+      {
+        // Write directly into the end of the string.
+        str.uninitialized_resize(str.size() + length);
+        write_integral(str.data() + str.size(), magnitude, base, upper_case, prefix_length, add_sign);
       }
       else
       {
-        // Extract the digits, in reverse order.
-        while (value != 0)
-        {
-          T remainder = etl::absolute(value % T(format.get_base()));
-          str.push_back((remainder > 9) ? (format.is_upper_case() ? type('A' + (remainder - 10)) : type('a' + (remainder - 10)))
-                                        : type('0' + remainder));
-          value = value / T(format.get_base());
-        }
-
-        // If number is negative, append '-'
-        if ((format.get_base() == 10U) && negative)
-        {
-          str.push_back(type('-'));
-        }
-
-        if (format.is_show_base())
-        {
-          switch (format.get_base())
-          {
-            case 2U:
-              {
-                str.push_back(format.is_upper_case() ? type('B') : type('b'));
-                str.push_back(type('0'));
-                break;
-              }
-
-            case 8U:
-              {
-                str.push_back(type('0'));
-                break;
-              }
-
-            case 16U:
-              {
-                str.push_back(format.is_upper_case() ? type('X') : type('x'));
-                str.push_back(type('0'));
-                break;
-              }
-
-            default:
-              {
-                break;
-              }
-          }
-        }
+        // Let the string decide how to truncate.
+        type buffer[etl::integral_limits<utype>::bits + 3U];
+        type* last = buffer + (sizeof(buffer) / sizeof(type));
 
-        // Reverse the string we appended.
-        etl::reverse(start, str.end());
+        write_integral(last, magnitude, base, upper_case, prefix_length, add_sign);
+        str.append(last - length, length);
       }
 
       etl::private_to_string::add_alignment(str, start, format);
@@ -275,6 +299,71 @@ namespace etl
     }
 #endif
 
+#if ETL_USING_64BIT_TYPES
+    //***************************************************************************
+    /// Helper function for floating point.
+    /// The value is rounded exactly to the precision. long double is formatted
+    /// as double.
+    //***************************************************************************
+    template <typename T, typename TIString>
+    void add_floating_point(const T value, TIString& str, const etl::basic_format_spec<TIString>& format, const bool append)
+    {
+      typedef typename TIString::iterator   iterator;
+      typedef typename TIString::value_type type;
+
+      typedef typename etl::conditional<etl::is_same<T, float>::value, float, double>::type engine_type;
+
+      if (!append)
+      {
+        str.clear();
+      }
+
+      iterator start = str.end();
+
+      if (isnan(value) || isinf(value))
+      {
+        etl::private_to_string::add_nan_inf(isnan(value), isinf(value), str);
+      }
+      else
+      {
+        const size_t places   = format.get_precision();
+        const bool   negative = etl::is_negative(value);
+
+        const etl::private_floating_point_digits::decimal_digits d = etl::private_floating_point_digits::to_fixed(engine_type(value), static_cast<int>(places));
+
+        const size_t length = (negative ? 1U : 0U) + etl::private_floating_point_digits::fixed_length(d, places, false);
+
+        if (length <= str.available())
+        {
+          // Write directly into the end of the string.
+          str.uninitialized_resize(str.size() + length);
+
+          type* p = str.data() + str.size() - length;
+
+          if (negative)
+          {
+            *p++ = type('-');
+          }
+
+          etl::private_floating_point_digits::write_fixed(p, d, places, false);
+        }
+        else
+        {
+          // Let the string decide how to truncate.
+          etl::back_insert_iterator<TIString> it(str);
+
+          if (negative)
+          {
+            etl::private_floating_point_digits::put(it, '-');
+          }
+
+          etl::private_floating_point_digits::write_fixed(it, d, places, false);
+        }
+      }
+
+      etl::private_to_string::add_alignment(str, start, format);
+    }
+#else
     //***************************************************************************
     /// Helper function for floating point.
     //***************************************************************************
@@ -300,12 +389,10 @@ namespace etl
         // Make sure we format the two halves correctly.
         uint32_t max_precision = etl::numeric_limits<T>::digits10;
 
-#if ETL_NOT_USING_64BIT_TYPES
         if (max_precision > 9)
         {
           max_precision = 9;
         }
-#endif
 
         etl::basic_format_spec<TIString> integral_format = format;
         integral_format.decimal().width(0).precision(format.get_precision() > max_precision ? max_precision : format.get_precision());
@@ -339,6 +426,7 @@ namespace etl
 
       etl::private_to_string::add_alignment(str, start, format);
     }
+#endif
 
     //***************************************************************************
     /// Helper function for denominated integers.
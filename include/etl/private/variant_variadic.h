@@ -297,11 +297,6 @@ namespace etl
   template <typename T, typename... VTypes>
   ETL_CONSTEXPR14 const T&& get(const etl::variant<VTypes...>&& v);
 
-  #if ETL_NOT_USING_CPP17
-    #include "variant_select_do_operator.h"
-    #include "variant_select_do_visitor.h"
-  #endif
-
   constexpr bool operator>(etl::monostate, etl::monostate) ETL_NOEXCEPT
   {
     return false;
@@ -889,11 +884,7 @@ namespace etl
     template <typename TVisitor>
     etl::enable_if_t<etl::is_visitor<TVisitor>::value, void> accept(TVisitor& v)
     {
-  #if ETL_USING_CPP17 && !defined(ETL_VARIANT_FORCE_CPP11)
       do_visitor(v, etl::make_index_sequence<sizeof...(TTypes)>{});
-  #else
-      do_visitor<sizeof...(TTypes)>(v);
-  #endif
     }
 
     //***************************************************************************
@@ -902,11 +893,7 @@ namespace etl
     template <typename TVisitor>
     etl::enable_if_t<etl::is_visitor<TVisitor>::value, void> accept(TVisitor& v) const
     {
-  #if ETL_USING_CPP17 && !defined(ETL_VARIANT_FORCE_CPP11)
       do_visitor(v, etl::make_index_sequence<sizeof...(TTypes)>{});
-  #else
-      do_visitor<sizeof...(TTypes)>(v);
-  #endif
     }
 
     //***************************************************************************
@@ -915,11 +902,7 @@ namespace etl
     template <typename TVisitor>
     etl::enable_if_t<!etl::is_visitor<TVisitor>::value, void> accept(TVisitor& v)
     {
-  #if ETL_USING_CPP17 && !defined(ETL_VARIANT_FORCE_CPP11)
       do_operator(v, etl::make_index_sequence<sizeof...(TTypes)>{});
-  #else
-      do_operator<sizeof...(TTypes)>(v);
-  #endif
     }
 
     //***************************************************************************
@@ -928,11 +911,7 @@ namespace etl
     template <typename TVisitor>
     etl::enable_if_t<!etl::is_visitor<TVisitor>::value, void> accept(TVisitor& v) const
     {
-  #if ETL_USING_CPP17 && !defined(ETL_VARIANT_FORCE_CPP11)
       do_operator(v, etl::make_index_sequence<sizeof...(TTypes)>{});
-  #else
-      do_operator<sizeof...(TTypes)>(v);
-  #endif
     }
 
     //***************************************************************************
@@ -946,11 +925,7 @@ namespace etl
     void
       accept_visitor(TVisitor& v)
     {
-  #if ETL_USING_CPP17 && !defined(ETL_VARIANT_FORCE_CPP11)
       do_visitor(v, etl::make_index_sequence<sizeof...(TTypes)>{});
-  #else
-      do_visitor<sizeof...(TTypes)>(v);
-  #endif
     }
 
     //***************************************************************************
@@ -964,11 +939,7 @@ namespace etl
     void
       accept_visitor(TVisitor& v) const
     {
-  #if ETL_USING_CPP17 && !defined(ETL_VARIANT_FORCE_CPP11)
       do_visitor(v, etl::make_index_sequence<sizeof...(TTypes)>{});
-  #else
-      do_visitor<sizeof...(TTypes)>(v);
-  #endif
     }
 
     //***************************************************************************
@@ -982,11 +953,7 @@ namespace etl
     void
       accept_functor(TVisitor& v)
     {
-  #if ETL_USING_CPP17 && !defined(ETL_VARIANT_FORCE_CPP11)
       do_operator(v, etl::make_index_sequence<sizeof...(TTypes)>{});
-  #else
-      do_operator<sizeof...(TTypes)>(v);
-  #endif
     }
 
     //***************************************************************************
@@ -1000,11 +967,7 @@ namespace etl
     void
       accept_functor(TVisitor& v) const
     {
-  #if ETL_USING_CPP17 && !defined(ETL_VARIANT_FORCE_CPP11)
       do_operator(v, etl::make_index_sequence<sizeof...(TTypes)>{});
-  #else
-      do_operator<sizeof...(TTypes)>(v);
-  #endif
     }
 
   private:
@@ -1056,186 +1019,115 @@ namespace etl
       ::new (pstorage) type();
     }
 
-  #if ETL_USING_CPP17 && !defined(ETL_VARIANT_FORCE_CPP11)
     //***************************************************************************
-    /// Call the relevant visitor by attempting each one.
+    /// Call the visitor for the current type, through a table of functions
+    /// indexed by the type index.
     //***************************************************************************
     template <typename TVisitor, size_t... I>
     void do_visitor(TVisitor& visitor, etl::index_sequence<I...>)
     {
-      (attempt_visitor<I>(visitor) || ...);
+      typedef void (*function_pointer)(variant&, TVisitor&);
+
+      static ETL_CONSTEXPR function_pointer jump_table[] = {&variant::call_visitor<I, TVisitor>...};
+
+      if (index() < sizeof...(TTypes))
+      {
+        jump_table[index()](*this, visitor);
+      }
     }
 
     //***************************************************************************
-    /// Call the relevant visitor by attempting each one.
+    /// Call the visitor for the current type, through a table of functions
+    /// indexed by the type index.
     //***************************************************************************
     template <typename TVisitor, size_t... I>
     void do_visitor(TVisitor& visitor, etl::index_sequence<I...>) const
     {
-      (attempt_visitor<I>(visitor) || ...);
-    }
-  #else
-    //***************************************************************************
-    /// Call the relevant visitor.
-    //***************************************************************************
-    template <size_t NTypes, typename TVisitor>
-    void do_visitor(TVisitor& visitor)
-    {
-      etl::private_variant::select_do_visitor<NTypes>::do_visitor(*this, visitor);
-    }
+      typedef void (*function_pointer)(const variant&, TVisitor&);
 
-    //***************************************************************************
-    /// Call the relevant visitor.
-    //***************************************************************************
-    template <size_t NTypes, typename TVisitor>
-    void do_visitor(TVisitor& visitor) const
-    {
-      etl::private_variant::select_do_visitor<NTypes>::do_visitor(*this, visitor);
-    }
-  #endif
+      static ETL_CONSTEXPR function_pointer jump_table[] = {&variant::call_visitor<I, TVisitor>...};
 
-    //***************************************************************************
-    /// Attempt to call a visitor.
-    //***************************************************************************
-    template <size_t Index, typename TVisitor>
-    bool attempt_visitor(TVisitor& visitor)
-    {
-      if (Index == index())
+      if (index() < sizeof...(TTypes))
       {
-        // Workaround for MSVC (2023/05/13)
-        // It doesn't compile 'visitor.visit(etl::get<Index>(*this))' correctly
-        // for C++17 & C++20. Changed all of the instances for consistency.
-        auto& v = etl::get<Index>(*this);
-        visitor.visit(v);
-        return true;
-      }
-      else
-      {
-        return false;
+        jump_table[index()](*this, visitor);
       }
     }
 
     //***************************************************************************
-    /// Attempt to call a visitor.
+    /// Call a visitor with the type at Index.
     //***************************************************************************
     template <size_t Index, typename TVisitor>
-    bool attempt_visitor(TVisitor& visitor) const
+    static void call_visitor(variant& the_variant, TVisitor& visitor)
     {
-      if (Index == index())
-      {
-        // Workaround for MSVC (2023/05/13)
-        // It doesn't compile 'visitor.visit(etl::get<Index>(*this))' correctly
-        // for C++17 & C++20. Changed all of the instances for consistency.
-        auto& v = etl::get<Index>(*this);
-        visitor.visit(v);
-        return true;
-      }
-      else
-      {
-        return false;
-      }
+      // Workaround for MSVC (2023/05/13)
+      // It doesn't compile 'visitor.visit(etl::get<Index>(*this))' correctly
+      // for C++17 & C++20. Changed all of the instances for consistency.
+      auto& v = etl::get<Index>(the_variant);
+      visitor.visit(v);
     }
 
-  #if ETL_USING_CPP17 && !defined(ETL_VARIANT_FORCE_CPP11)
     //***************************************************************************
-    /// Call the relevant visitor by attempting each one.
+    /// Call a visitor with the type at Index.
     //***************************************************************************
-    template <typename TVisitor, size_t... I>
-    void do_operator(TVisitor& visitor, etl::index_sequence<I...>)
+    template <size_t Index, typename TVisitor>
+    static void call_visitor(const variant& the_variant, TVisitor& visitor)
     {
-      (attempt_operator<I>(visitor) || ...);
+      auto& v = etl::get<Index>(the_variant);
+      visitor.visit(v);
     }
 
     //***************************************************************************
-    /// Call the relevant visitor by attempting each one.
+    /// Call the functor for the current type, through a table of functions
+    /// indexed by the type index.
     //***************************************************************************
     template <typename TVisitor, size_t... I>
-    void do_operator(TVisitor& visitor, etl::index_sequence<I...>) const
-    {
-      (attempt_operator<I>(visitor) || ...);
-    }
-  #else
-    //***************************************************************************
-    /// Call the relevant operator.
-    //***************************************************************************
-    template <size_t NTypes, typename TVisitor>
-    void do_operator(TVisitor& visitor)
+    void do_operator(TVisitor& visitor, etl::index_sequence<I...>)
     {
-    #if defined(ETL_VARIANT_CPP11_MAX_8_TYPES)
-      ETL_STATIC_ASSERT(sizeof...(TTypes) <= 8U, "ETL_VARIANT_CPP11_MAX_8_TYPES - Only a maximum of 8 types are allowed in this variant");
-    #endif
+      typedef void (*function_pointer)(variant&, TVisitor&);
 
-    #if defined(ETL_VARIANT_CPP11_MAX_16_TYPES)
-      ETL_STATIC_ASSERT(sizeof...(TTypes) <= 16U, "ETL_VARIANT_CPP11_MAX_16_TYPES - Only a maximum of 16 types are allowed in this variant");
-    #endif
+      static ETL_CONSTEXPR function_pointer jump_table[] = {&variant::call_operator<I, TVisitor>...};
 
-    #if defined(ETL_VARIANT_CPP11_MAX_24_TYPES)
-      ETL_STATIC_ASSERT(sizeof...(TTypes) <= 24U, "ETL_VARIANT_CPP11_MAX_24_TYPES - Only a maximum of 24 types are allowed in this variant");
-    #endif
-
-      ETL_STATIC_ASSERT(sizeof...(TTypes) <= 32U, "A maximum of 32 types are allowed in this variant");
-
-      etl::private_variant::select_do_operator<NTypes>::do_operator(*this, visitor);
+      if (index() < sizeof...(TTypes))
+      {
+        jump_table[index()](*this, visitor);
+      }
     }
 
     //***************************************************************************
-    /// Call the relevant operator.
+    /// Call the functor for the current type, through a table of functions
+    /// indexed by the type index.
     //***************************************************************************
-    template <size_t NTypes, typename TVisitor>
-    void do_operator(TVisitor& visitor) const
+    template <typename TVisitor, size_t... I>
+    void do_operator(TVisitor& visitor, etl::index_sequence<I...>) const
     {
-    #if defined(ETL_VARIANT_CPP11_MAX_8_TYPES)
-      ETL_STATIC_ASSERT(sizeof...(TTypes) <= 8U, "ETL_VARIANT_CPP11_MAX_8_TYPES - Only a maximum of 8 types are allowed in this variant");
-    #endif
-
-    #if defined(ETL_VARIANT_CPP11_MAX_16_TYPES)
-      ETL_STATIC_ASSERT(sizeof...(TTypes) <= 16U, "ETL_VARIANT_CPP11_MAX_16_TYPES - Only a maximum of 16 types are allowed in this variant");
-    #endif
-
-    #if defined(ETL_VARIANT_CPP11_MAX_24_TYPES)
-      ETL_STATIC_ASSERT(sizeof...(TTypes) <= 24U, "ETL_VARIANT_CPP11_MAX_24_TYPES - Only a maximum of 24 types are allowed in this variant");
-    #endif
+      typedef void (*function_pointer)(const variant&, TVisitor&);
 
-      ETL_STATIC_ASSERT(sizeof...(TTypes) <= 32U, "A maximum of 32 types are allowed in this variant");
+      static ETL_CONSTEXPR function_pointer jump_table[] = {&variant::call_operator<I, TVisitor>...};
 
-      etl::private_variant::select_do_operator<NTypes>::do_operator(*this, visitor);
+      if (index() < sizeof...(TTypes))
+      {
+        jump_table[index()](*this, visitor);
+      }
     }
-  #endif
 
     //***************************************************************************
-    /// Attempt to call a visitor.
+    /// Call a functor with the type at Index.
     //***************************************************************************
     template <size_t Index, typename TVisitor>
-    bool attempt_operator(TVisitor& visitor)
+    static void call_operator(variant& the_variant, TVisitor& visitor)
     {
-      if (Index == index())
-      {
-        auto& v = etl::get<Index>(*this);
-        visitor(v);
-        return true;
-      }
-      else
-      {
-        return false;
-      }
+      auto& v = etl::get<Index>(the_variant);
+      visitor(v);
     }
 
     //***************************************************************************
-    /// Attempt to call a visitor.
+    /// Call a functor with the type at Index.
     //***************************************************************************
     template <size_t Index, typename TVisitor>
-    bool attempt_operator(TVisitor& visitor) const
+    static void call_operator(const variant& the_variant, TVisitor& visitor)
     {
-      if (Index == index())
-      {
-        auto& v = etl::get<Index>(*this);
-        visitor(v);
-        return true;
-      }
-      else
-      {
-        return false;
-      }
+      auto& v = etl::get<Index>(the_variant);
+      visitor(v);
     }
 
     //***************************************************************************
@@ -1531,9 +1423,6 @@ namespace etl
   //***************************************************************************
   namespace private_variant
   {
-    template <typename TRet, typename TCallable, typename TVariant, size_t tIndex, typename TNext, typename... TVariants>
-    static ETL_CONSTEXPR14 TRet do_visit_single(TCallable&& f, TVariant&& v, TNext&&, TVariants&&... vs);
-
     //***************************************************************************
     /// Dummy-struct used to indicate that the return type should be
     /// auto-deduced from the callable object and the alternatives in the
@@ -1627,87 +1516,125 @@ namespace etl
     using visit_result_t = typename visit_result<Ts...>::type;
 
     //***************************************************************************
-    /// Makes a call to TCallable using tIndex alternative to the variant.
-    /// Instantiated as function pointer in the `do_visit` function.
+    /// The product of the sizes.
     //***************************************************************************
-    template <typename TRet, typename TCallable, typename TVariant, size_t tIndex>
-    constexpr TRet do_visit_single(TCallable&& f, TVariant&& v)
+    template <size_t... TSizes>
+    struct visit_size_product : etl::integral_constant<size_t, 1U>
     {
-      return static_cast<TCallable&&>(f)(etl::get<tIndex>(static_cast<TVariant&&>(v)));
-    }
+    };
+
+    template <size_t TSize, size_t... TSizes>
+    struct visit_size_product<TSize, TSizes...> : etl::integral_constant<size_t, TSize * visit_size_product<TSizes...>::value>
+    {
+    };
 
     //***************************************************************************
-    /// Helper to instantiate the function pointers needed for the "jump table".
-    /// Embeds the 'TVarRest' (remaining variants) into its type to come around
-    /// the "double expansion" otherwise needed in "do_visit".
+    /// The distance in the flattened jump table between the alternatives of
+    /// the variant at Position. The last variant varies fastest.
     //***************************************************************************
-    template <typename TRet, typename TCallable, typename TCurVariant, typename... TVarRest>
-    struct do_visit_helper
+    template <size_t Position, size_t TSize, size_t... TSizes>
+    struct visit_stride : visit_stride<Position - 1U, TSizes...>
     {
-      using function_pointer = add_pointer_t<TRet(TCallable&&, TCurVariant&&, TVarRest&&...)>;
+    };
 
-      template <size_t tIndex>
-      static constexpr function_pointer fptr() ETL_NOEXCEPT
-      {
-        return &do_visit_single<TRet, TCallable, TCurVariant, tIndex, TVarRest...>;
-      }
+    template <size_t TSize, size_t... TSizes>
+    struct visit_stride<0U, TSize, TSizes...> : visit_size_product<TSizes...>
+    {
     };
 
     //***************************************************************************
-    /// Dispatch current variant into recursive calls to dispatch the rest.
+    /// The alternative of the variant at Position for an entry in the
+    /// flattened jump table.
     //***************************************************************************
-    template <typename TRet, typename TCallable, typename TVariant, size_t... tIndices, typename... TVarRest>
-    static ETL_CONSTEXPR14 TRet do_visit(TCallable&& f, TVariant&& v, index_sequence<tIndices...>, TVarRest&&... variants)
+    template <size_t Entry, size_t Position, size_t TSize, size_t... TSizes>
+    struct visit_alternative : visit_alternative<Entry, Position - 1U, TSizes...>
     {
-      ETL_ASSERT(!v.valueless_by_exception(), ETL_ERROR(bad_variant_access));
-
-      using helper_t = do_visit_helper<TRet, TCallable, TVariant, TVarRest...>;
-      using func_ptr = typename helper_t::function_pointer;
+    };
 
-      constexpr func_ptr jmp_table[]{helper_t::template fptr<tIndices>()...};
+    template <size_t Entry, size_t TSize, size_t... TSizes>
+    struct visit_alternative<Entry, 0U, TSize, TSizes...> : etl::integral_constant<size_t, (Entry / visit_size_product<TSizes...>::value) % TSize>
+    {
+    };
 
-      return jmp_table[v.index()](static_cast<TCallable&&>(f), static_cast<TVariant&&>(v), static_cast<TVarRest&&>(variants)...);
+    //***************************************************************************
+    /// Sums the offsets of the variants into the jump table.
+    //***************************************************************************
+    inline ETL_CONSTEXPR size_t visit_sum() ETL_NOEXCEPT
+    {
+      return 0U;
     }
 
-    template <typename TRet, typename TCallable, typename TVariant, typename... TVs>
-    static ETL_CONSTEXPR14 TRet visit(TCallable&& f, TVariant&& v, TVs&&... vs)
+    template <typename... TRest>
+    ETL_CONSTEXPR size_t visit_sum(size_t value, TRest... rest) ETL_NOEXCEPT
     {
-      constexpr size_t variants = etl::variant_size<typename remove_reference<TVariant>::type>::value;
-      return private_variant::do_visit<TRet>(static_cast<TCallable&&>(f), static_cast<TVariant&&>(v), make_index_sequence<variants>{},
-                                             static_cast<TVs&&>(vs)...);
+      return value + visit_sum(rest...);
     }
 
     //***************************************************************************
-    /// Allows constexpr operation in c++14, otherwise acts like a lambda to
-    /// bind a variant "get" to an argument for "TCallable".
+    /// Are any of the variants valueless?
     //***************************************************************************
-    template <typename TRet, typename TCallable, typename TVariant, size_t tIndex>
-    class constexpr_visit_closure
+    inline ETL_CONSTEXPR bool visit_any_valueless() ETL_NOEXCEPT
     {
-      add_pointer_t<TCallable> callable_;
-      add_pointer_t<TVariant>  variant_;
+      return false;
+    }
+
+    template <typename TVariant, typename... TRest>
+    ETL_CONSTEXPR bool visit_any_valueless(const TVariant& v, const TRest&... rest) ETL_NOEXCEPT
+    {
+      return v.valueless_by_exception() || visit_any_valueless(rest...);
+    }
+
+    //***************************************************************************
+    /// A single jump table for all of the variants, with an entry for every
+    /// combination of alternatives. The entry is found from the type indexes.
+    //***************************************************************************
+    template <typename TRet, typename TCallable, typename TSizes, typename TPositions, typename TEntries, typename... TVariants>
+    struct visit_table;
 
-    public:
+    template <typename TRet, typename TCallable, size_t... TSizes, size_t... TPositions, size_t... TEntries, typename... TVariants>
+    struct visit_table<TRet, TCallable, etl::index_sequence<TSizes...>, etl::index_sequence<TPositions...>, etl::index_sequence<TEntries...>, TVariants...>
+    {
+      typedef TRet (*function_pointer)(TCallable&&, TVariants&&...);
 
-      constexpr constexpr_visit_closure(TCallable&& c, TVariant&& v)
-        : callable_(&c)
-        , variant_(&v)
+      //*************************************************************************
+      /// Calls TCallable with the alternatives for the entry.
+      //*************************************************************************
+      template <size_t Entry>
+      static ETL_CONSTEXPR14 TRet call(TCallable&& f, TVariants&&... vs)
       {
+        return static_cast<TCallable&&>(f)(etl::get<visit_alternative<Entry, TPositions, TSizes...>::value>(static_cast<TVariants&&>(vs))...);
       }
 
-      template <typename... Ts>
-      ETL_CONSTEXPR14 TRet operator()(Ts&&... args) const
+      //*************************************************************************
+      static ETL_CONSTEXPR14 TRet visit(TCallable&& f, TVariants&&... vs)
       {
-        return static_cast<TCallable&&>(*callable_)(get<tIndex>(static_cast<TVariant&&>(*variant_)), static_cast<Ts&&>(args)...);
+        ETL_ASSERT(!visit_any_valueless(vs...), ETL_ERROR(bad_variant_access));
+
+        return jmp_table[visit_sum((vs.index() * visit_stride<TPositions, TSizes...>::value)...)](static_cast<TCallable&&>(f),
+                                                                                                 static_cast<TVariants&&>(vs)...);
       }
+
+      static constexpr function_pointer jmp_table[] = {&call<TEntries>...};
     };
 
-    template <typename TRet, typename TCallable, typename TVariant, size_t tIndex, typename TNext, typename... TVariants>
-    static ETL_CONSTEXPR14 TRet do_visit_single(TCallable&& f, TVariant&& v, TNext&& next, TVariants&&... vs)
+    template <typename TRet, typename TCallable, size_t... TSizes, size_t... TPositions, size_t... TEntries, typename... TVariants>
+    constexpr typename visit_table<TRet, TCallable, etl::index_sequence<TSizes...>, etl::index_sequence<TPositions...>, etl::index_sequence<TEntries...>,
+                                   TVariants...>::function_pointer
+      visit_table<TRet, TCallable, etl::index_sequence<TSizes...>, etl::index_sequence<TPositions...>, etl::index_sequence<TEntries...>,
+                  TVariants...>::jmp_table[];
+
+    //***************************************************************************
+    /// Dispatches through one jump table, however many variants there are.
+    //***************************************************************************
+    template <typename TRet, typename TCallable, typename... TVariants>
+    static ETL_CONSTEXPR14 TRet visit(TCallable&& f, TVariants&&... vs)
     {
-      return private_variant::visit<TRet>(
-        constexpr_visit_closure<TRet, TCallable, TVariant, tIndex>(static_cast<TCallable&&>(f), static_cast<TVariant&&>(v)),
-        static_cast<TNext&&>(next), static_cast<TVariants&&>(vs)...);
+      using table_t =
+        visit_table<TRet, TCallable, etl::index_sequence<etl::variant_size<etl::remove_reference_t<TVariants> >::value...>,
+                    etl::make_index_sequence<sizeof...(TVariants)>,
+                    etl::make_index_sequence<visit_size_product<etl::variant_size<etl::remove_reference_t<TVariants> >::value...>::value>, TVariants...>;
+
+      return table_t::visit(static_cast<TCallable&&>(f), static_cast<TVariants&&>(vs)...);
     }
 
   } // namespace private_variant
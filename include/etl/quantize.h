@@ -32,7 +32,9 @@ SOFTWARE.
 #define ETL_QUANTIZE_INCLUDED
 
 #include "platform.h"
+#include "algorithm.h"
 #include "functional.h"
+#include "span.h"
 #include "type_traits.h"
 
 ////#include <math.h>
@@ -40,8 +42,27 @@ SOFTWARE.
 
 namespace etl
 {
+  //***************************************************************************
+  /// Tag to select the sorted threshold mode of etl::quantize.
+  //***************************************************************************
+  struct sorted_thresholds_t
+  {
+    ETL_CONSTEXPR14 explicit sorted_thresholds_t() {}
+  };
+
+#if ETL_USING_CPP17
+  inline ETL_CONSTEXPR sorted_thresholds_t sorted_thresholds{};
+#else
+  static const sorted_thresholds_t sorted_thresholds;
+#endif
+
   //***************************************************************************
   /// Quantize .
+  /// By default the thresholds are searched linearly for the first that the
+  /// value compares less than.
+  /// If constructed with etl::sorted_thresholds, the thresholds must be
+  /// sorted by the comparator and are searched with a branchless binary
+  /// search, which gives the same result in O(logN).
   //***************************************************************************
   template <typename TInput, typename TCompare = etl::less<TInput> >
   class quantize : public etl::unary_function<TInput, TInput>
@@ -56,6 +77,20 @@ namespace etl
       , p_quantizations(p_quantizations_)
       , n_levels(n_quantizations_ - 1U)
       , compare(compare_)
+      , is_sorted(false)
+    {
+    }
+
+    //*****************************************************************
+    // Constructor for sorted thresholds.
+    //*****************************************************************
+    quantize(etl::sorted_thresholds_t, const TInput* p_thresholds_, const TInput* p_quantizations_, size_t n_quantizations_,
+             TCompare compare_ = TCompare())
+      : p_thresholds(p_thresholds_)
+      , p_quantizations(p_quantizations_)
+      , n_levels(n_quantizations_ - 1U)
+      , compare(compare_)
+      , is_sorted(true)
     {
     }
 
@@ -64,6 +99,11 @@ namespace etl
     //*****************************************************************
     TInput operator()(TInput value) const
     {
+      if (is_sorted)
+      {
+        return p_quantizations[etl::branchless_upper_bound(p_thresholds, p_thresholds + n_levels, value, compare) - p_thresholds];
+      }
+
       for (size_t i = 0UL; i < n_levels; ++i)
       {
         if (compare(value, p_thresholds[i]))
@@ -75,12 +115,73 @@ namespace etl
       return p_quantizations[n_levels];
     }
 
+    //*****************************************************************
+    // operator ()
+    // Quantizes a block of values.
+    // Stops at the end of the shorter of the two spans.
+    // For sorted thresholds the searches for four values are interleaved,
+    // so that each one's loads overlap with the others'.
+    //*****************************************************************
+    void operator()(etl::span<const TInput> input, etl::span<TInput> output) const
+    {
+      const size_t n = (input.size() < output.size()) ? input.size() : output.size();
+
+      const TInput* p_input  = input.data();
+      TInput*       p_output = output.data();
+
+      size_t i = 0UL;
+
+      if (is_sorted && (n_levels != 0UL))
+      {
+        for (; (i + 4UL) <= n; i += 4UL)
+        {
+          quantize_4(p_input + i, p_output + i);
+        }
+      }
+
+      for (; i < n; ++i)
+      {
+        p_output[i] = operator()(p_input[i]);
+      }
+    }
+
   private:
 
+    //*****************************************************************
+    // Four branchless binary searches run in step.
+    //*****************************************************************
+    void quantize_4(const TInput* p_input, TInput* p_output) const
+    {
+      const TInput* first0 = p_thresholds;
+      const TInput* first1 = p_thresholds;
+      const TInput* first2 = p_thresholds;
+      const TInput* first3 = p_thresholds;
+
+      size_t count = n_levels;
+
+      while (count > 1UL)
+      {
+        const size_t half = count / 2UL;
+
+        first0 += compare(p_input[0], first0[half]) ? 0UL : half;
+        first1 += compare(p_input[1], first1[half]) ? 0UL : half;
+        first2 += compare(p_input[2], first2[half]) ? 0UL : half;
+        first3 += compare(p_input[3], first3[half]) ? 0UL : half;
+
+        count -= half;
+      }
+
+      p_output[0] = p_quantizations[size_t(first0 - p_thresholds) + (compare(p_input[0], *first0) ? 0UL : 1UL)];
+      p_output[1] = p_quantizations[size_t(first1 - p_thresholds) + (compare(p_input[1], *first1) ? 0UL : 1UL)];
+      p_output[2] = p_quantizations[size_t(first2 - p_thresholds) + (compare(p_input[2], *first2) ? 0UL : 1UL)];
+      p_output[3] = p_quantizations[size_t(first3 - p_thresholds) + (compare(p_input[3], *first3) ? 0UL : 1UL)];
+    }
+
     const TInput* const p_thresholds;
     const TInput* const p_quantizations;
     const size_t        n_levels;
     const TCompare      compare;
+    const bool          is_sorted;
   };
 } // namespace etl
 
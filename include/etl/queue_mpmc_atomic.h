@@ -0,0 +1,829 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MPMC_QUEUE_ATOMIC_INCLUDED
+#define ETL_MPMC_QUEUE_ATOMIC_INCLUDED
+
+#include "platform.h"
+#include "alignment.h"
+#include "atomic.h"
+#include "integral_limits.h"
+#include "memory_model.h"
+#include "parameter_type.h"
+#include "placement_new.h"
+#include "span.h"
+#include "utility.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base for the lock free MPMC queue.
+  /// Positions count up modulo 'Period', a multiple of the capacity that is
+  /// at least three times larger, so that the ordering of a slot's sequence
+  /// number and a position can always be decided.
+  /// The period is at most the maximum of size_type, so 255 positions for
+  /// MEMORY_MODEL_SMALL. A thread that is preempted while the positions wrap a
+  /// whole period may claim a slot that is still in use from an earlier lap.
+  /// Claims check the slots again, and wait until they are ready, so in this
+  /// case a push or pop may block until another thread pushes or pops.
+  //***************************************************************************
+  template <size_t Memory_Model = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_mpmc_atomic_base
+  {
+  public:
+
+    /// The type used for determining the size of queue.
+    typedef typename etl::size_type_lookup<Memory_Model>::type size_type;
+
+    //*************************************************************************
+    /// Is the queue empty?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0;
+    }
+
+    //*************************************************************************
+    /// Is the queue full?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// How many items in the queue?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type size() const
+    {
+      // Read first, so that the write position cannot appear to be behind it.
+      size_type read_index  = read_position.load(etl::memory_order_acquire);
+      size_type write_index = write_position.load(etl::memory_order_acquire);
+
+      size_type count = (write_index >= read_index) ? size_type(write_index - read_index)
+                                                    : size_type(Period - (read_index - write_index));
+
+      return (count > MAX_SIZE) ? MAX_SIZE : count;
+    }
+
+    //*************************************************************************
+    /// How much free space available in the queue.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type available() const
+    {
+      return MAX_SIZE - size();
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+  protected:
+
+    queue_mpmc_atomic_base(size_type max_size_, size_type period_)
+      : MAX_SIZE(max_size_)
+      , Period(period_)
+      , write_position(0)
+      , read_position(0)
+    {
+    }
+
+    //*************************************************************************
+    /// Advances a position by 'n', modulo the period.
+    /// 'n' must not be greater than the capacity.
+    //*************************************************************************
+    size_type advance(size_type position, size_type n) const
+    {
+      return (position < size_type(Period - n)) ? size_type(position + n) : size_type(position - (Period - n));
+    }
+
+    //*************************************************************************
+    /// Compares a slot's sequence number with a position.
+    ///\return 0 if they are equal, negative if the sequence is behind the
+    /// position and positive if it is ahead of it.
+    //*************************************************************************
+    int compare(size_type sequence, size_type position) const
+    {
+      if (sequence == position)
+      {
+        return 0;
+      }
+
+      size_type ahead = (sequence > position) ? size_type(sequence - position) : size_type(Period - (position - sequence));
+
+      return (ahead <= (Period / 2)) ? 1 : -1;
+    }
+
+    const size_type MAX_SIZE; ///< The maximum number of items in the queue.
+    const size_type Period;   ///< The modulus of the positions.
+
+  private:
+
+    char padding_0[ETL_CACHE_LINE_SIZE];
+
+  protected:
+
+    etl::atomic<size_type> write_position; ///< The next position to be claimed by a producer.
+
+  private:
+
+    char padding_1[ETL_CACHE_LINE_SIZE];
+
+  protected:
+
+    etl::atomic<size_type> read_position; ///< The next position to be claimed by a consumer.
+
+  private:
+
+    char padding_2[ETL_CACHE_LINE_SIZE];
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+  #if defined(ETL_POLYMORPHIC_MPMC_QUEUE_ATOMIC) || defined(ETL_POLYMORPHIC_CONTAINERS)
+
+  public:
+
+    virtual ~queue_mpmc_atomic_base() {}
+  #else
+
+  protected:
+
+    ~queue_mpmc_atomic_base() {}
+  #endif
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc
+  ///\brief This is the base for all queue_mpmc_atomics that contain a particular type.
+  ///\details Normally a reference to this type will be taken from a derived
+  /// queue_mpmc_atomic. \code
+  /// etl::queue_mpmc_atomic<int, 10> myQueue;
+  /// etl::iqueue_mpmc_atomic<int>& iQueue = myQueue;
+  ///\endcode
+  /// This queue supports concurrent access by any number of producers and
+  /// consumers, without locks.
+  /// Each slot carries a sequence number that tells producers and consumers
+  /// whether it is free or holds a value for the current lap.
+  /// \tparam T The type of value that the queue_mpmc_atomic holds.
+  //***************************************************************************
+  template <typename T, const size_t Memory_Model = etl::memory_model::MEMORY_MODEL_LARGE>
+  class iqueue_mpmc_atomic : public queue_mpmc_atomic_base<Memory_Model>
+  {
+  private:
+
+    typedef etl::queue_mpmc_atomic_base<Memory_Model> base_t;
+
+  public:
+
+    typedef T        value_type;      ///< The type stored in the queue.
+    typedef T&       reference;       ///< A reference to the type used in the queue.
+    typedef const T& const_reference; ///< A const reference to the type used in the queue.
+  #if ETL_USING_CPP11
+    typedef T&& rvalue_reference; ///< An rvalue reference to the type used in the queue.
+  #endif
+    typedef typename base_t::size_type size_type; ///< The type used for determining the size of the queue.
+
+    using base_t::advance;
+    using base_t::compare;
+    using base_t::MAX_SIZE;
+    using base_t::read_position;
+    using base_t::write_position;
+
+    //*************************************************************************
+    /// Push a value to the queue.
+    //*************************************************************************
+    bool push(const_reference value)
+    {
+      size_type position;
+      slot*     p_slot = claim_write(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (p_slot->value()) T(value);
+
+        publish_write(*p_slot, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+  #if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_ATOMIC_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    /// Push a value to the queue.
+    //*************************************************************************
+    bool push(rvalue_reference value)
+    {
+      size_type position;
+      slot*     p_slot = claim_write(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (p_slot->value()) T(etl::move(value));
+
+        publish_write(*p_slot, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+  #endif
+
+    //*************************************************************************
+    /// Push a block of values to the queue.
+    /// Pushes as many as will fit, claiming their slots with a single
+    /// compare-exchange.
+    ///\return The number of values pushed.
+    //*************************************************************************
+    size_type push(etl::span<const T> values)
+    {
+      size_type position;
+      size_type count = claim_write(position, values.size());
+
+      const T* p_value = values.data();
+
+      for (size_type i = 0; i < count; ++i)
+      {
+        slot& s = slot_at(position);
+
+        ::new (s.value()) T(*p_value++);
+
+        publish_write(s, position);
+        position = advance(position, 1);
+      }
+
+      return count;
+    }
+
+  #if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_ATOMIC_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename... Args>
+    bool emplace(Args&&... args)
+    {
+      size_type position;
+      slot*     p_slot = claim_write(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (p_slot->value()) T(etl::forward<Args>(args)...);
+
+        publish_write(*p_slot, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+  #else
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    bool emplace()
+    {
+      size_type position;
+      slot*     p_slot = claim_write(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (p_slot->value()) T();
+
+        publish_write(*p_slot, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1>
+    bool emplace(const T1& value1)
+    {
+      size_type position;
+      slot*     p_slot = claim_write(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (p_slot->value()) T(value1);
+
+        publish_write(*p_slot, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    bool emplace(const T1& value1, const T2& value2)
+    {
+      size_type position;
+      slot*     p_slot = claim_write(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (p_slot->value()) T(value1, value2);
+
+        publish_write(*p_slot, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3)
+    {
+      size_type position;
+      slot*     p_slot = claim_write(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (p_slot->value()) T(value1, value2, value3);
+
+        publish_write(*p_slot, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      size_type position;
+      slot*     p_slot = claim_write(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (p_slot->value()) T(value1, value2, value3, value4);
+
+        publish_write(*p_slot, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+  #endif
+
+    //*************************************************************************
+    /// Pop a value from the queue.
+    //*************************************************************************
+    bool pop(reference value)
+    {
+      size_type position;
+      slot*     p_slot = claim_read(position);
+
+      if (p_slot == ETL_NULLPTR)
+      {
+        // Queue is empty
+        return false;
+      }
+
+  #if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_ATOMIC_FORCE_CPP03_IMPLEMENTATION)
+      value = etl::move(*p_slot->value());
+  #else
+      value = *p_slot->value();
+  #endif
+
+      p_slot->value()->~T();
+
+      publish_read(*p_slot, position);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Pop a value from the queue and discard.
+    //*************************************************************************
+    bool pop()
+    {
+      size_type position;
+      slot*     p_slot = claim_read(position);
+
+      if (p_slot == ETL_NULLPTR)
+      {
+        // Queue is empty
+        return false;
+      }
+
+      p_slot->value()->~T();
+
+      publish_read(*p_slot, position);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Pop a block of values from the queue.
+    /// Pops as many as are available, up to the size of the span, claiming
+    /// their slots with a single compare-exchange.
+    ///\return The number of values popped.
+    //*************************************************************************
+    size_type pop(etl::span<T> values)
+    {
+      size_type position;
+      size_type count = claim_read(position, values.size());
+
+      T* p_value = values.data();
+
+      for (size_type i = 0; i < count; ++i)
+      {
+        slot& s = slot_at(position);
+
+  #if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_ATOMIC_FORCE_CPP03_IMPLEMENTATION)
+        *p_value++ = etl::move(*s.value());
+  #else
+        *p_value++ = *s.value();
+  #endif
+        s.value()->~T();
+
+        publish_read(s, position);
+        position = advance(position, 1);
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Peek a value at the front of the queue.
+    /// Only valid while no other thread may pop from the queue.
+    //*************************************************************************
+    reference front()
+    {
+      return *slot_at(read_position.load(etl::memory_order_acquire)).value();
+    }
+
+    //*************************************************************************
+    /// Peek a value at the front of the queue.
+    /// Only valid while no other thread may pop from the queue.
+    //*************************************************************************
+    const_reference front() const
+    {
+      return *slot_at(read_position.load(etl::memory_order_acquire)).value();
+    }
+
+    //*************************************************************************
+    /// Clear the queue.
+    /// Pops until the queue is seen to be empty.
+    //*************************************************************************
+    void clear()
+    {
+      while (pop())
+      {
+        // Do nothing.
+      }
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// A storage slot and its sequence number.
+    /// The sequence equals the slot's position when the slot is free for a
+    /// producer, and the position plus one when it holds a value.
+    //*************************************************************************
+    struct slot
+    {
+      T* value()
+      {
+        return reinterpret_cast<T*>(&storage);
+      }
+
+      const T* value() const
+      {
+        return reinterpret_cast<const T*>(&storage);
+      }
+
+      etl::atomic<size_type>                                                    sequence;
+      typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type storage;
+    };
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    iqueue_mpmc_atomic(slot* p_buffer_, size_type max_size_, size_type period_)
+      : base_t(max_size_, period_)
+      , p_buffer(p_buffer_)
+    {
+    }
+
+    //*************************************************************************
+    /// Marks every slot as free for the first lap.
+    /// Called from derived classes once the buffer has been constructed.
+    //*************************************************************************
+    void initialise()
+    {
+      for (size_type i = 0; i < MAX_SIZE; ++i)
+      {
+        p_buffer[i].sequence.store(i, etl::memory_order_relaxed);
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Gets the slot for a position.
+    //*************************************************************************
+    slot& slot_at(size_type position)
+    {
+      return p_buffer[position % MAX_SIZE];
+    }
+
+    //*************************************************************************
+    /// Gets the slot for a position.
+    //*************************************************************************
+    const slot& slot_at(size_type position) const
+    {
+      return p_buffer[position % MAX_SIZE];
+    }
+
+    //*************************************************************************
+    /// Claims the next slot for a producer.
+    ///\return The slot, or ETL_NULLPTR if the queue is full.
+    //*************************************************************************
+    slot* claim_write(size_type& position)
+    {
+      return (claim_write(position, 1U) == 1U) ? &slot_at(position) : ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Claims up to 'wanted' consecutive slots for a producer.
+    ///\return The number of slots claimed, starting at 'position'.
+    //*************************************************************************
+    size_type claim_write(size_type& position, size_t wanted)
+    {
+      return claim(write_position, position, wanted, 0U);
+    }
+
+    //*************************************************************************
+    /// Claims the next slot for a consumer.
+    ///\return The slot, or ETL_NULLPTR if the queue is empty.
+    //*************************************************************************
+    slot* claim_read(size_type& position)
+    {
+      return (claim_read(position, 1U) == 1U) ? &slot_at(position) : ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Claims up to 'wanted' consecutive slots for a consumer.
+    ///\return The number of slots claimed, starting at 'position'.
+    //*************************************************************************
+    size_type claim_read(size_type& position, size_t wanted)
+    {
+      return claim(read_position, position, wanted, 1U);
+    }
+
+    //*************************************************************************
+    /// Claims up to 'wanted' consecutive slots from 'shared_position'.
+    /// A slot at position 'p' is ready when its sequence is 'p + offset'.
+    ///\return The number of slots claimed, starting at 'position'.
+    //*************************************************************************
+    size_type claim(etl::atomic<size_type>& shared_position, size_type& position, size_t wanted, size_type offset)
+    {
+      position = shared_position.load(etl::memory_order_relaxed);
+
+      if (wanted == 0U)
+      {
+        return 0;
+      }
+
+      if (wanted > MAX_SIZE)
+      {
+        wanted = MAX_SIZE;
+      }
+
+      while (true)
+      {
+        size_type count = 0;
+        size_type next  = position;
+        int       order = 0;
+
+        // Count the ready slots.
+        while ((count < wanted) && (order == 0))
+        {
+          order = compare(slot_at(next).sequence.load(etl::memory_order_acquire), advance(next, offset));
+
+          if (order == 0)
+          {
+            ++count;
+            next = advance(next, 1);
+          }
+        }
+
+        if (count == 0)
+        {
+          if (order < 0)
+          {
+            // The first slot has not been released from the previous lap.
+            return 0;
+          }
+
+          // Another thread has claimed the slot.
+          position = shared_position.load(etl::memory_order_relaxed);
+        }
+        else if (shared_position.compare_exchange_weak(position, next, etl::memory_order_relaxed))
+        {
+          wait_until_ready(position, count, offset);
+
+          return count;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Waits until 'count' claimed slots from 'position' are ready.
+    /// They were ready when counted, but if the positions wrapped a whole
+    /// period before the claim, a slot may still be behind, from an earlier lap.
+    /// Only the claiming thread can take it further, so it is never ahead.
+    //*************************************************************************
+    void wait_until_ready(size_type position, size_type count, size_type offset)
+    {
+      while (count-- != 0)
+      {
+        const slot& s = slot_at(position);
+
+        while (compare(s.sequence.load(etl::memory_order_acquire), advance(position, offset)) != 0)
+        {
+          // Wait for the thread that is using the slot.
+        }
+
+        position = advance(position, 1);
+      }
+    }
+
+    //*************************************************************************
+    /// Makes a slot written at 'position' visible to consumers.
+    //*************************************************************************
+    void publish_write(slot& s, size_type position)
+    {
+      s.sequence.store(advance(position, 1), etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Frees a slot read at 'position' for the producers of the next lap.
+    //*************************************************************************
+    void publish_read(slot& s, size_type position)
+    {
+      s.sequence.store(advance(position, MAX_SIZE), etl::memory_order_release);
+    }
+
+    // Disable copy construction and assignment.
+    iqueue_mpmc_atomic(const iqueue_mpmc_atomic&) ETL_DELETE;
+    iqueue_mpmc_atomic& operator=(const iqueue_mpmc_atomic&) ETL_DELETE;
+
+  #if ETL_USING_CPP11
+    iqueue_mpmc_atomic(iqueue_mpmc_atomic&&)            = delete;
+    iqueue_mpmc_atomic& operator=(iqueue_mpmc_atomic&&) = delete;
+  #endif
+
+    slot* p_buffer; ///< The internal buffer.
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc
+  /// A fixed capacity lock free mpmc queue.
+  /// This queue supports concurrent access by any number of producers and
+  /// consumers.
+  /// \tparam T            The type this queue should support.
+  /// \tparam Size         The maximum capacity of the queue.
+  /// \tparam Memory_Model The memory model for the queue. Determines the type
+  /// of the internal counter variables.
+  //***************************************************************************
+  template <typename T, size_t Size, const size_t Memory_Model = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_mpmc_atomic : public etl::iqueue_mpmc_atomic<T, Memory_Model>
+  {
+  private:
+
+    typedef etl::iqueue_mpmc_atomic<T, Memory_Model> base_t;
+
+  public:
+
+    typedef typename base_t::size_type size_type;
+
+    ETL_STATIC_ASSERT((Size > 0), "Size must be greater than zero");
+    ETL_STATIC_ASSERT((Size <= (etl::integral_limits<size_type>::max / 3)), "Size too large for memory model");
+
+    static ETL_CONSTANT size_type MAX_SIZE = size_type(Size);
+
+  private:
+
+    static ETL_CONSTANT size_type Period = size_type((etl::integral_limits<size_type>::max / Size) * Size);
+
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    queue_mpmc_atomic()
+      : base_t(&buffer[0], MAX_SIZE, Period)
+    {
+      base_t::initialise();
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~queue_mpmc_atomic()
+    {
+      base_t::clear();
+    }
+
+  private:
+
+    queue_mpmc_atomic(const queue_mpmc_atomic&) ETL_DELETE;
+    queue_mpmc_atomic& operator=(const queue_mpmc_atomic&) ETL_DELETE;
+
+  #if ETL_USING_CPP11
+    queue_mpmc_atomic(queue_mpmc_atomic&&)            = delete;
+    queue_mpmc_atomic& operator=(queue_mpmc_atomic&&) = delete;
+  #endif
+
+    /// The slots used in the queue_mpmc_atomic.
+    typename base_t::slot buffer[MAX_SIZE];
+  };
+
+  template <typename T, size_t Size, const size_t Memory_Model>
+  ETL_CONSTANT typename queue_mpmc_atomic<T, Size, Memory_Model>::size_type queue_mpmc_atomic<T, Size, Memory_Model>::MAX_SIZE;
+
+  template <typename T, size_t Size, const size_t Memory_Model>
+  ETL_CONSTANT typename queue_mpmc_atomic<T, Size, Memory_Model>::size_type queue_mpmc_atomic<T, Size, Memory_Model>::Period;
+} // namespace etl
+
+#endif
+
+#endif
@@ -30,6 +30,7 @@ SOFTWARE.
 #define ETL_STATE_CHART_INCLUDED
 
 #include "platform.h"
+#include "algorithm.h"
 #include "array.h"
 #include "array_view.h"
 #include "nullptr.h"
@@ -140,6 +141,91 @@ namespace etl
     };
   } // namespace state_chart_traits
 
+  namespace private_state_chart
+  {
+    //*************************************************************************
+    /// Orders transitions by state, then by event, with the 'from any state'
+    /// transitions after all of the others.
+    //*************************************************************************
+    struct transition_compare
+    {
+      template <typename TTransition>
+      bool operator()(const TTransition& lhs, const TTransition& rhs) const
+      {
+        if (lhs.from_any_state != rhs.from_any_state)
+        {
+          return rhs.from_any_state;
+        }
+
+        if (lhs.current_state_id != rhs.current_state_id)
+        {
+          return lhs.current_state_id < rhs.current_state_id;
+        }
+
+        return lhs.event_id < rhs.event_id;
+      }
+    };
+
+    //*************************************************************************
+    /// Is the transition table in the order that allows it to be binary
+    /// searched?
+    //*************************************************************************
+    template <typename TTransition>
+    bool is_indexed(const TTransition* begin, const TTransition* end)
+    {
+      return etl::is_sorted(begin, end, transition_compare());
+    }
+
+    //*************************************************************************
+    /// Finds the first transition at or after 't' for the event in the state,
+    /// in an indexed table. The candidates are found in table order, so
+    /// guards are tried in the same order as a linear search.
+    //*************************************************************************
+    template <typename TTransition>
+    const TTransition* find_indexed_transition(const TTransition* t, const TTransition* end, state_chart_traits::event_id_t event_id,
+                                               state_chart_traits::state_id_t state_id)
+    {
+      // Transitions from this state.
+      t = etl::lower_bound(t, end, TTransition(state_id, event_id, state_id), transition_compare());
+
+      if ((t != end) && !t->from_any_state && (t->current_state_id == state_id) && (t->event_id == event_id))
+      {
+        return t;
+      }
+
+      // Transitions from any state.
+      t = etl::lower_bound(t, end, TTransition(event_id, state_id), transition_compare());
+
+      if ((t != end) && t->from_any_state && (t->event_id == event_id))
+      {
+        return t;
+      }
+
+      return end;
+    }
+
+    //*************************************************************************
+    /// Finds the state in the state table.
+    /// A state at the index of its id is found directly, otherwise the table
+    /// is searched.
+    //*************************************************************************
+    template <typename TState>
+    const TState* find_state(const TState* begin, const TState* end, state_chart_traits::state_id_t state_id)
+    {
+      if ((size_t(state_id) < size_t(end - begin)) && (begin[state_id].state_id == state_id))
+      {
+        return begin + state_id;
+      }
+
+      while ((begin != end) && (begin->state_id != state_id))
+      {
+        ++begin;
+      }
+
+      return begin;
+    }
+  } // namespace private_state_chart
+
   //***************************************************************************
   /// For non-void parameter types
   //***************************************************************************
@@ -234,6 +320,7 @@ namespace etl
     ETL_CONSTEXPR state_chart_ct()
       : istate_chart<void>(Initial_State)
       , started(false)
+      , indexed(false)
     {
     }
 
@@ -274,6 +361,7 @@ namespace etl
           }
         }
 
+        indexed = private_state_chart::is_indexed(Transition_Table_Begin, Transition_Table_Begin + Transition_Table_Size);
         started = true;
       }
     }
@@ -283,6 +371,9 @@ namespace etl
     /// The state machine will action the <b>first</b> item in the transition
     /// table that satisfies the conditions for executing the action. \param
     /// event_id The id of the event to process.
+    /// If the transition table is ordered by state, then by event, with the
+    /// 'from any state' transitions at the end, then the transitions are
+    /// found by binary search, otherwise by a linear search.
     //*************************************************************************
     virtual void process_event(event_id_t event_id) ETL_OVERRIDE
     {
@@ -295,7 +386,7 @@ namespace etl
         while (t != (Transition_Table_Begin + Transition_Table_Size))
         {
           // Scan the transition table from the latest position.
-          t = etl::find_if(t, (Transition_Table_Begin + Transition_Table_Size), is_transition(event_id, this->current_state_id));
+          t = find_transition(t, event_id);
 
           // Found an entry?
           if (t != (Transition_Table_Begin + Transition_Table_Size))
@@ -355,40 +446,40 @@ namespace etl
     //*************************************************************************
     const state* find_state(state_id_t state_id)
     {
-      return etl::find_if(State_Table_Begin, State_Table_Begin + State_Table_Size, is_state(state_id));
+      return private_state_chart::find_state(State_Table_Begin, State_Table_Begin + State_Table_Size, state_id);
     }
 
     //*************************************************************************
-    struct is_transition
+    /// Finds the first transition at or after 't' for the event in the
+    /// current state.
+    //*************************************************************************
+    const transition* find_transition(const transition* t, event_id_t event_id) const
     {
-      is_transition(event_id_t event_id_, state_id_t state_id_)
-        : event_id(event_id_)
-        , state_id(state_id_)
+      if (indexed)
       {
+        return private_state_chart::find_indexed_transition(t, Transition_Table_Begin + Transition_Table_Size, event_id, this->current_state_id);
       }
-
-      bool operator()(const transition& t) const
+      else
       {
-        return (t.event_id == event_id) && (t.from_any_state || (t.current_state_id == state_id));
+        return etl::find_if(t, Transition_Table_Begin + Transition_Table_Size, is_transition(event_id, this->current_state_id));
       }
-
-      const event_id_t event_id;
-      const state_id_t state_id;
-    };
+    }
 
     //*************************************************************************
-    struct is_state
+    struct is_transition
     {
-      is_state(state_id_t state_id_)
-        : state_id(state_id_)
+      is_transition(event_id_t event_id_, state_id_t state_id_)
+        : event_id(event_id_)
+        , state_id(state_id_)
       {
       }
 
-      bool operator()(const state& s) const
+      bool operator()(const transition& t) const
       {
-        return (s.state_id == state_id);
+        return (t.event_id == event_id) && (t.from_any_state || (t.current_state_id == state_id));
       }
 
+      const event_id_t event_id;
       const state_id_t state_id;
     };
 
@@ -397,6 +488,7 @@ namespace etl
     state_chart_ct& operator=(const state_chart_ct&) ETL_DELETE;
 
     bool started; ///< Set if the state chart has been started.
+    bool indexed; ///< Set if the transition table can be binary searched.
   };
 
   //***************************************************************************
@@ -424,6 +516,7 @@ namespace etl
     ETL_CONSTEXPR state_chart_ctp()
       : istate_chart<TParameter>(Initial_State)
       , started(false)
+      , indexed(false)
     {
     }
 
@@ -464,6 +557,7 @@ namespace etl
           }
         }
 
+        indexed = private_state_chart::is_indexed(Transition_Table_Begin, Transition_Table_Begin + Transition_Table_Size);
         started = true;
       }
     }
@@ -473,6 +567,9 @@ namespace etl
     /// The state machine will action the <b>first</b> item in the transition
     /// table that satisfies the conditions for executing the action. \param
     /// event_id The id of the event to process.
+    /// If the transition table is ordered by state, then by event, with the
+    /// 'from any state' transitions at the end, then the transitions are
+    /// found by binary search, otherwise by a linear search.
     //*************************************************************************
     virtual void process_event(event_id_t event_id, parameter_t data) ETL_OVERRIDE
     {
@@ -485,7 +582,7 @@ namespace etl
         while (t != (Transition_Table_Begin + Transition_Table_Size))
         {
           // Scan the transition table from the latest position.
-          t = etl::find_if(t, (Transition_Table_Begin + Transition_Table_Size), is_transition(event_id, this->current_state_id));
+          t = find_transition(t, event_id);
 
           // Found an entry?
           if (t != (Transition_Table_Begin + Transition_Table_Size))
@@ -549,40 +646,40 @@ namespace etl
     //*************************************************************************
     const state* find_state(state_id_t state_id)
     {
-      return etl::find_if(State_Table_Begin, State_Table_Begin + State_Table_Size, is_state(state_id));
+      return private_state_chart::find_state(State_Table_Begin, State_Table_Begin + State_Table_Size, state_id);
     }
 
     //*************************************************************************
-    struct is_transition
+    /// Finds the first transition at or after 't' for the event in the
+    /// current state.
+    //*************************************************************************
+    const transition* find_transition(const transition* t, event_id_t event_id) const
     {
-      is_transition(event_id_t event_id_, state_id_t state_id_)
-        : event_id(event_id_)
-        , state_id(state_id_)
+      if (indexed)
       {
+        return private_state_chart::find_indexed_transition(t, Transition_Table_Begin + Transition_Table_Size, event_id, this->current_state_id);
       }
-
-      bool operator()(const transition& t) const
+      else
       {
-        return (t.event_id == event_id) && (t.from_any_state || (t.current_state_id == state_id));
+        return etl::find_if(t, Transition_Table_Begin + Transition_Table_Size, is_transition(event_id, this->current_state_id));
       }
-
-      const event_id_t event_id;
-      const state_id_t state_id;
-    };
+    }
 
     //*************************************************************************
-    struct is_state
+    struct is_transition
     {
-      is_state(state_id_t state_id_)
-        : state_id(state_id_)
+      is_transition(event_id_t event_id_, state_id_t state_id_)
+        : event_id(event_id_)
+        , state_id(state_id_)
       {
       }
 
-      bool operator()(const state& s) const
+      bool operator()(const transition& t) const
       {
-        return (s.state_id == state_id);
+        return (t.event_id == event_id) && (t.from_any_state || (t.current_state_id == state_id));
       }
 
+      const event_id_t event_id;
       const state_id_t state_id;
     };
 
@@ -591,6 +688,7 @@ namespace etl
     state_chart_ctp& operator=(const state_chart_ctp&) ETL_DELETE;
 
     bool started; ///< Set if the state chart has been started.
+    bool indexed; ///< Set if the transition table can be binary searched.
   };
 
   //***************************************************************************
@@ -624,9 +722,10 @@ namespace etl
       , object(object_)
       , transition_table_begin(transition_table_begin_)
       , state_table_begin(state_table_begin_)
-      , transition_table_size(transition_table_end_ - transition_table_begin_)
-      , state_table_size(state_table_end_ - state_table_begin_)
+      , transition_table_size(static_cast<size_t>(transition_table_end_ - transition_table_begin_))
+      , state_table_size(static_cast<size_t>(state_table_end_ - state_table_begin_))
       , started(false)
+      , indexed(false)
     {
     }
 
@@ -638,7 +737,8 @@ namespace etl
     void set_transition_table(const transition* transition_table_begin_, const transition* transition_table_end_)
     {
       transition_table_begin = transition_table_begin_;
-      transition_table_size  = transition_table_end_ - transition_table_begin_;
+      transition_table_size  = static_cast<size_t>(transition_table_end_ - transition_table_begin_);
+      indexed                = private_state_chart::is_indexed(transition_table_begin, transition_table_end());
     }
 
     //*************************************************************************
@@ -649,7 +749,7 @@ namespace etl
     void set_state_table(const state* state_table_begin_, const state* state_table_end_)
     {
       state_table_begin = state_table_begin_;
-      state_table_size  = state_table_end_ - state_table_begin_;
+      state_table_size  = static_cast<size_t>(state_table_end_ - state_table_begin_);
     }
 
     //*************************************************************************
@@ -689,6 +789,7 @@ namespace etl
           }
         }
 
+        indexed = private_state_chart::is_indexed(transition_table_begin, transition_table_end());
         started = true;
       }
     }
@@ -698,6 +799,9 @@ namespace etl
     /// The state machine will action the <b>first</b> item in the transition
     /// table that satisfies the conditions for executing the action. \param
     /// event_id The id of the event to process.
+    /// If the transition table is ordered by state, then by event, with the
+    /// 'from any state' transitions at the end, then the transitions are
+    /// found by binary search, otherwise by a linear search.
     //*************************************************************************
     void process_event(event_id_t event_id, parameter_t data) ETL_OVERRIDE
     {
@@ -710,7 +814,7 @@ namespace etl
         while (t != transition_table_end())
         {
           // Scan the transition table from the latest position.
-          t = etl::find_if(t, transition_table_end(), is_transition(event_id, this->current_state_id));
+          t = find_transition(t, event_id);
 
           // Found an entry?
           if (t != transition_table_end())
@@ -780,7 +884,7 @@ namespace etl
       }
       else
       {
-        return etl::find_if(state_table_begin, state_table_end(), is_state(state_id));
+        return private_state_chart::find_state(state_table_begin, state_table_end(), state_id);
       }
     }
 
@@ -797,36 +901,36 @@ namespace etl
     }
 
     //*************************************************************************
-    struct is_transition
+    /// Finds the first transition at or after 't' for the event in the
+    /// current state.
+    //*************************************************************************
+    const transition* find_transition(const transition* t, event_id_t event_id) const
     {
-      is_transition(event_id_t event_id_, state_id_t state_id_)
-        : event_id(event_id_)
-        , state_id(state_id_)
+      if (indexed)
       {
+        return private_state_chart::find_indexed_transition(t, transition_table_end(), event_id, this->current_state_id);
       }
-
-      bool operator()(const transition& t) const
+      else
       {
-        return (t.event_id == event_id) && (t.from_any_state || (t.current_state_id == state_id));
+        return etl::find_if(t, transition_table_end(), is_transition(event_id, this->current_state_id));
       }
-
-      const event_id_t event_id;
-      const state_id_t state_id;
-    };
+    }
 
     //*************************************************************************
-    struct is_state
+    struct is_transition
     {
-      is_state(state_id_t state_id_)
-        : state_id(state_id_)
+      is_transition(event_id_t event_id_, state_id_t state_id_)
+        : event_id(event_id_)
+        , state_id(state_id_)
       {
       }
 
-      bool operator()(const state& s) const
+      bool operator()(const transition& t) const
       {
-        return (s.state_id == state_id);
+        return (t.event_id == event_id) && (t.from_any_state || (t.current_state_id == state_id));
       }
 
+      const event_id_t event_id;
       const state_id_t state_id;
     };
 
@@ -837,9 +941,10 @@ namespace etl
     TObject&          object;                 ///< The object that supplies guard and action member functions.
     const transition* transition_table_begin; ///< The start of the table of transitions.
     const state*      state_table_begin;      ///< The start of the table of states.
-    uint_least8_t     transition_table_size;  ///< The size of the table of transitions.
-    uint_least8_t     state_table_size;       ///< The size of the table of states.
+    size_t            transition_table_size;  ///< The size of the table of transitions.
+    size_t            state_table_size;       ///< The size of the table of states.
     bool              started;                ///< Set if the state chart has been started.
+    bool              indexed;                ///< Set if the transition table can be binary searched.
   };
 
   //***************************************************************************
@@ -873,9 +978,10 @@ namespace etl
       , object(object_)
       , transition_table_begin(transition_table_begin_)
       , state_table_begin(state_table_begin_)
-      , transition_table_size(transition_table_end_ - transition_table_begin_)
-      , state_table_size(state_table_end_ - state_table_begin_)
+      , transition_table_size(static_cast<size_t>(transition_table_end_ - transition_table_begin_))
+      , state_table_size(static_cast<size_t>(state_table_end_ - state_table_begin_))
       , started(false)
+      , indexed(false)
     {
     }
 
@@ -887,7 +993,8 @@ namespace etl
     void set_transition_table(const transition* transition_table_begin_, const transition* transition_table_end_)
     {
       transition_table_begin = transition_table_begin_;
-      transition_table_size  = transition_table_end_ - transition_table_begin_;
+      transition_table_size  = static_cast<size_t>(transition_table_end_ - transition_table_begin_);
+      indexed                = private_state_chart::is_indexed(transition_table_begin, transition_table_end());
     }
 
     //*************************************************************************
@@ -898,7 +1005,7 @@ namespace etl
     void set_state_table(const state* state_table_begin_, const state* state_table_end_)
     {
       state_table_begin = state_table_begin_;
-      state_table_size  = state_table_end_ - state_table_begin_;
+      state_table_size  = static_cast<size_t>(state_table_end_ - state_table_begin_);
     }
 
     //*************************************************************************
@@ -938,6 +1045,7 @@ namespace etl
           }
         }
 
+        indexed = private_state_chart::is_indexed(transition_table_begin, transition_table_end());
         started = true;
       }
     }
@@ -947,6 +1055,9 @@ namespace etl
     /// The state machine will action the <b>first</b> item in the transition
     /// table that satisfies the conditions for executing the action. \param
     /// event_id The id of the event to process.
+    /// If the transition table is ordered by state, then by event, with the
+    /// 'from any state' transitions at the end, then the transitions are
+    /// found by binary search, otherwise by a linear search.
     //*************************************************************************
     void process_event(event_id_t event_id) ETL_OVERRIDE
     {
@@ -959,7 +1070,7 @@ namespace etl
         while (t != transition_table_end())
         {
           // Scan the transition table from the latest position.
-          t = etl::find_if(t, transition_table_end(), is_transition(event_id, this->current_state_id));
+          t = find_transition(t, event_id);
 
           // Found an entry?
           if (t != transition_table_end())
@@ -1025,7 +1136,7 @@ namespace etl
       }
       else
       {
-        return etl::find_if(state_table_begin, state_table_end(), is_state(state_id));
+        return private_state_chart::find_state(state_table_begin, state_table_end(), state_id);
       }
     }
 
@@ -1042,36 +1153,36 @@ namespace etl
     }
 
     //*************************************************************************
-    struct is_transition
+    /// Finds the first transition at or after 't' for the event in the
+    /// current state.
+    //*************************************************************************
+    const transition* find_transition(const transition* t, event_id_t event_id) const
     {
-      is_transition(event_id_t event_id_, state_id_t state_id_)
-        : event_id(event_id_)
-        , state_id(state_id_)
+      if (indexed)
       {
+        return private_state_chart::find_indexed_transition(t, transition_table_end(), event_id, this->current_state_id);
       }
-
-      bool operator()(const transition& t) const
+      else
       {
-        return (t.event_id == event_id) && (t.from_any_state || (t.current_state_id == state_id));
+        return etl::find_if(t, transition_table_end(), is_transition(event_id, this->current_state_id));
       }
-
-      const event_id_t event_id;
-      const state_id_t state_id;
-    };
+    }
 
     //*************************************************************************
-    struct is_state
+    struct is_transition
     {
-      is_state(state_id_t state_id_)
-        : state_id(state_id_)
+      is_transition(event_id_t event_id_, state_id_t state_id_)
+        : event_id(event_id_)
+        , state_id(state_id_)
       {
       }
 
-      bool operator()(const state& s) const
+      bool operator()(const transition& t) const
       {
-        return (s.state_id == state_id);
+        return (t.event_id == event_id) && (t.from_any_state || (t.current_state_id == state_id));
       }
 
+      const event_id_t event_id;
       const state_id_t state_id;
     };
 
@@ -1082,9 +1193,10 @@ namespace etl
     TObject&          object;                 ///< The object that supplies guard and action member functions.
     const transition* transition_table_begin; ///< The start of the table of transitions.
     const state*      state_table_begin;      ///< The start of the table of states.
-    uint_least8_t     transition_table_size;  ///< The size of the table of transitions.
-    uint_least8_t     state_table_size;       ///< The size of the table of states.
+    size_t            transition_table_size;  ///< The size of the table of transitions.
+    size_t            state_table_size;       ///< The size of the table of states.
     bool              started;                ///< Set if the state chart has been started.
+    bool              indexed;                ///< Set if the transition table can be binary searched.
   };
 } // namespace etl
 
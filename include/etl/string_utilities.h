@@ -41,6 +41,7 @@ SOFTWARE.
 #include <ctype.h>
 #include <stdint.h>
 
+#include "private/string_search.h"
 #include "private/minmax_push.h"
 
 namespace etl
@@ -499,26 +500,18 @@ namespace etl
   template <typename TIterator, typename TPointer>
   TIterator find_first_of(TIterator first, TIterator last, TPointer delimiters)
   {
-    TIterator itr(first);
-
-    while (itr != last)
-    {
-      TPointer pd = delimiters;
+    typedef typename etl::remove_cv<typename etl::remove_pointer<TPointer>::type>::type char_type;
 
-      while (*pd != 0)
-      {
-        if (*itr == *pd)
-        {
-          return itr;
-        }
+    const etl::private_string_search::character_set<char_type> set(delimiters, delimiters + etl::strlen(delimiters));
 
-        ++pd;
-      }
+    TIterator itr(first);
 
+    while ((itr != last) && !set.contains(*itr))
+    {
       ++itr;
     }
 
-    return last;
+    return itr;
   }
 
   //*********************************************************************
@@ -545,34 +538,18 @@ namespace etl
   template <typename TIterator, typename TPointer>
   TIterator find_first_not_of(TIterator first, TIterator last, TPointer delimiters)
   {
-    TIterator itr(first);
+    typedef typename etl::remove_cv<typename etl::remove_pointer<TPointer>::type>::type char_type;
 
-    while (itr != last)
-    {
-      TPointer pd = delimiters;
-
-      bool found = false;
+    const etl::private_string_search::character_set<char_type> set(delimiters, delimiters + etl::strlen(delimiters));
 
-      while (*pd != 0)
-      {
-        if (*itr == *pd)
-        {
-          found = true;
-          break;
-        }
-
-        ++pd;
-      }
-
-      if (!found)
-      {
-        return itr;
-      }
+    TIterator itr(first);
 
+    while ((itr != last) && set.contains(*itr))
+    {
       ++itr;
     }
 
-    return last;
+    return itr;
   }
 
   //*********************************************************************
@@ -604,22 +581,19 @@ namespace etl
       return last;
     }
 
+    typedef typename etl::remove_cv<typename etl::remove_pointer<TPointer>::type>::type char_type;
+
+    const etl::private_string_search::character_set<char_type> set(delimiters, delimiters + etl::strlen(delimiters));
+
     TIterator itr(last);
     TIterator end(first);
 
     do {
       --itr;
 
-      TPointer pd = delimiters;
-
-      while (*pd != 0)
+      if (set.contains(*itr))
       {
-        if (*itr == *pd)
-        {
-          return itr;
-        }
-
-        ++pd;
+        return itr;
       }
     } while (itr != end);
 
@@ -655,28 +629,17 @@ namespace etl
       return last;
     }
 
+    typedef typename etl::remove_cv<typename etl::remove_pointer<TPointer>::type>::type char_type;
+
+    const etl::private_string_search::character_set<char_type> set(delimiters, delimiters + etl::strlen(delimiters));
+
     TIterator itr(last);
     TIterator end(first);
 
     do {
       --itr;
 
-      TPointer pd = delimiters;
-
-      bool found = false;
-
-      while (*pd != 0)
-      {
-        if (*itr == *pd)
-        {
-          found = true;
-          break;
-        }
-
-        ++pd;
-      }
-
-      if (!found)
+      if (!set.contains(*itr))
       {
         return itr;
       }
@@ -41,6 +41,7 @@ SOFTWARE.
 #include "integral_limits.h"
 #include "iterator.h"
 #include "memory.h"
+#include "private/string_search.h"
 #include "private/minmax_push.h"
 
 #if ETL_USING_STL && ETL_USING_CPP17
@@ -547,26 +548,33 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 size_type find(etl::basic_string_view<T, TTraits> view, size_type position = 0) const ETL_NOEXCEPT
     {
-      if ((size() < view.size()))
+      if ((size() < view.size()) || (position > size()))
       {
         return npos;
       }
 
-      const_iterator iposition = etl::search(begin() + position, end(), view.begin(), view.end());
+      const_pointer p = etl::private_string_search::find_substring(mbegin + position, mend, view.begin(), view.end());
 
-      if (iposition == end())
+      if ((p == mend) && !view.empty())
       {
         return npos;
       }
       else
       {
-        return static_cast<size_type>(etl::distance(begin(), iposition));
+        return static_cast<size_type>(p - mbegin);
       }
     }
 
     ETL_CONSTEXPR14 size_type find(T c, size_type position = 0) const ETL_NOEXCEPT
     {
-      return find(etl::basic_string_view<T, TTraits>(&c, 1), position);
+      if (position >= size())
+      {
+        return npos;
+      }
+
+      const_pointer p = etl::private_string_search::find_character(mbegin + position, mend, c);
+
+      return (p == mend) ? npos : static_cast<size_type>(p - mbegin);
     }
 
     ETL_CONSTEXPR14 size_type find(const T* text, size_type position, size_type count) const ETL_NOEXCEPT
@@ -623,25 +631,14 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 size_type find_first_of(etl::basic_string_view<T, TTraits> view, size_type position = 0) const ETL_NOEXCEPT
     {
-      const size_t lengthtext = size();
-
-      if (position < lengthtext)
+      if ((position >= size()) || view.empty())
       {
-        for (size_t i = position; i < lengthtext; ++i)
-        {
-          const size_t lengthview = view.size();
-
-          for (size_t j = 0UL; j < lengthview; ++j)
-          {
-            if (mbegin[i] == view[j])
-            {
-              return i;
-            }
-          }
-        }
+        return npos;
       }
 
-      return npos;
+      const_pointer p = etl::private_string_search::find_first_in_set(mbegin + position, mend, view.begin(), view.end(), true);
+
+      return (p == mend) ? npos : static_cast<size_type>(p - mbegin);
     }
 
     ETL_CONSTEXPR14 size_type find_first_of(T c, size_type position = 0) const ETL_NOEXCEPT
@@ -669,27 +666,10 @@ namespace etl
         return npos;
       }
 
-      position = etl::min(position, size() - 1);
-
-      const_reverse_iterator it = rbegin() + static_cast<ptrdiff_t>(size() - position - 1);
-
-      while (it != rend())
-      {
-        const size_t viewlength = view.size();
-
-        for (size_t j = 0UL; j < viewlength; ++j)
-        {
-          if (mbegin[position] == view[j])
-          {
-            return position;
-          }
-        }
-
-        ++it;
-        --position;
-      }
+      const_pointer last = mbegin + etl::min(position, size() - 1) + 1;
+      const_pointer p    = etl::private_string_search::find_last_in_set(mbegin, last, view.begin(), view.end(), true);
 
-      return npos;
+      return (p == last) ? npos : static_cast<size_type>(p - mbegin);
     }
 
     ETL_CONSTEXPR14 size_type find_last_of(T c, size_type position = npos) const ETL_NOEXCEPT
@@ -712,33 +692,14 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 size_type find_first_not_of(etl::basic_string_view<T, TTraits> view, size_type position = 0) const ETL_NOEXCEPT
     {
-      const size_t lengthtext = size();
-
-      if (position < lengthtext)
+      if (position >= size())
       {
-        for (size_t i = position; i < lengthtext; ++i)
-        {
-          bool found = false;
-
-          const size_t viewlength = view.size();
-
-          for (size_t j = 0UL; j < viewlength; ++j)
-          {
-            if (mbegin[i] == view[j])
-            {
-              found = true;
-              break;
-            }
-          }
-
-          if (!found)
-          {
-            return i;
-          }
-        }
+        return npos;
       }
 
-      return npos;
+      const_pointer p = etl::private_string_search::find_first_in_set(mbegin + position, mend, view.begin(), view.end(), false);
+
+      return (p == mend) ? npos : static_cast<size_type>(p - mbegin);
     }
 
     ETL_CONSTEXPR14 size_type find_first_not_of(T c, size_type position = 0) const ETL_NOEXCEPT
@@ -766,35 +727,10 @@ namespace etl
         return npos;
       }
 
-      position = etl::min(position, size() - 1);
-
-      const_reverse_iterator it = rbegin() + static_cast<ptrdiff_t>(size() - position - 1);
-
-      while (it != rend())
-      {
-        bool found = false;
-
-        const size_t viewlength = view.size();
-
-        for (size_t j = 0UL; j < viewlength; ++j)
-        {
-          if (mbegin[position] == view[j])
-          {
-            found = true;
-            break;
-          }
-        }
-
-        if (!found)
-        {
-          return position;
-        }
-
-        ++it;
-        --position;
-      }
+      const_pointer last = mbegin + etl::min(position, size() - 1) + 1;
+      const_pointer p    = etl::private_string_search::find_last_in_set(mbegin, last, view.begin(), view.end(), false);
 
-      return npos;
+      return (p == last) ? npos : static_cast<size_type>(p - mbegin);
     }
 
     ETL_CONSTEXPR14 size_type find_last_not_of(T c, size_type position = npos) const ETL_NOEXCEPT
@@ -952,8 +888,8 @@ namespace etl
   {
     size_t operator()(const etl::string_view& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
-                                                     reinterpret_cast<const uint8_t*>(text.data() + text.size()));
+      return etl::private_hash::buffer_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
+                                                    reinterpret_cast<const uint8_t*>(text.data() + text.size()));
     }
   };
 
@@ -962,8 +898,8 @@ namespace etl
   {
     size_t operator()(const etl::wstring_view& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
-                                                     reinterpret_cast<const uint8_t*>(text.data() + text.size()));
+      return etl::private_hash::buffer_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
+                                                    reinterpret_cast<const uint8_t*>(text.data() + text.size()));
     }
   };
 
@@ -972,8 +908,8 @@ namespace etl
   {
     size_t operator()(const etl::u16string_view& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
-                                                     reinterpret_cast<const uint8_t*>(text.data() + text.size()));
+      return etl::private_hash::buffer_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
+                                                    reinterpret_cast<const uint8_t*>(text.data() + text.size()));
     }
   };
 
@@ -982,8 +918,8 @@ namespace etl
   {
     size_t operator()(const etl::u32string_view& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
-                                                     reinterpret_cast<const uint8_t*>(text.data() + text.size()));
+      return etl::private_hash::buffer_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
+                                                    reinterpret_cast<const uint8_t*>(text.data() + text.size()));
     }
   };
 #endif
@@ -46,6 +46,10 @@ SOFTWARE.
 #include "string_view.h"
 #include "type_traits.h"
 
+#if ETL_USING_64BIT_TYPES
+  #include "private/floating_point_digits.h"
+#endif
+
 #include <math.h>
 
 namespace etl
@@ -333,6 +337,50 @@ namespace etl
       return (radix == etl::radix::binary) || (radix == etl::radix::octal) || (radix == etl::radix::decimal) || (radix == etl::radix::hexadecimal);
     }
 
+#if ETL_USING_64BIT_TYPES
+    //***************************************************************************
+    /// Loads 8 characters into a word, the first in the low byte.
+    /// Written out so that compilers can merge it into a single load for char.
+    //***************************************************************************
+    template <typename TChar>
+    ETL_NODISCARD ETL_CONSTEXPR14 uint64_t load_eight_chars(const TChar* p)
+    {
+      return uint64_t(static_cast<unsigned char>(p[0])) | (uint64_t(static_cast<unsigned char>(p[1])) << 8U) |
+             (uint64_t(static_cast<unsigned char>(p[2])) << 16U) | (uint64_t(static_cast<unsigned char>(p[3])) << 24U) |
+             (uint64_t(static_cast<unsigned char>(p[4])) << 32U) | (uint64_t(static_cast<unsigned char>(p[5])) << 40U) |
+             (uint64_t(static_cast<unsigned char>(p[6])) << 48U) | (uint64_t(static_cast<unsigned char>(p[7])) << 56U);
+    }
+
+    //***************************************************************************
+    /// Checks that all 8 characters in the word are decimal digits.
+    //***************************************************************************
+    ETL_NODISCARD
+    inline
+      ETL_CONSTEXPR14 bool is_eight_digits(uint64_t word)
+    {
+      return ((word & 0xF0F0F0F0F0F0F0F0ULL) | (((word + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4U)) == 0x3333333333333333ULL;
+    }
+
+    //***************************************************************************
+    /// Converts 8 decimal digits in a word to their value, combining pairs,
+    /// then quads, then the two halves.
+    //***************************************************************************
+    ETL_NODISCARD
+    inline
+      ETL_CONSTEXPR14 uint32_t parse_eight_digits(uint64_t word)
+    {
+      const uint64_t mask  = 0x000000FF000000FFULL;
+      const uint64_t mul_1 = 100ULL + (1000000ULL << 32U);
+      const uint64_t mul_2 = 1ULL + (10000ULL << 32U);
+
+      word -= 0x3030303030303030ULL;
+      word = (word * 10U) + (word >> 8U);
+      word = (((word & mask) * mul_1) + (((word >> 16U) & mask) * mul_2)) >> 32U;
+
+      return static_cast<uint32_t>(word);
+    }
+#endif
+
     //***************************************************************************
     /// Accumulate integrals
     //***************************************************************************
@@ -392,6 +440,27 @@ namespace etl
         return is_success;
       }
 
+#if ETL_USING_64BIT_TYPES
+      //*********************************
+      /// Adds 8 decimal digits at once.
+      //*********************************
+      ETL_NODISCARD ETL_CONSTEXPR14 bool add_eight_digits(uint32_t digits)
+      {
+        const TValue scale = 100000000U;
+
+        // No overflow?
+        if ((digits <= maximum) && (integral_value <= ((maximum - digits) / scale)))
+        {
+          integral_value = (integral_value * scale) + digits;
+          return true;
+        }
+
+        conversion_status = to_arithmetic_status::Overflow;
+
+        return false;
+      }
+#endif
+
       //*********************************
       ETL_NODISCARD ETL_CONSTEXPR14 bool has_value() const
       {
@@ -418,6 +487,227 @@ namespace etl
       to_arithmetic_status   conversion_status;
     };
 
+#if ETL_USING_64BIT_TYPES
+    //***************************************************************************
+    /// Accumulate floating point, as a decimal significand and exponent.
+    /// Only the first 19 significant digits are kept.
+    //***************************************************************************
+    struct floating_point_accumulator
+    {
+      //*********************************
+      ETL_CONSTEXPR14 floating_point_accumulator()
+        : significand(0U)
+        , significant_digits(0)
+        , exponent_adjust(0)
+        , is_truncated(false)
+        , is_negative_mantissa(false)
+        , is_negative_exponent(false)
+        , expecting_sign(true)
+        , exponent_value(0)
+        , state(Parsing_Integral)
+        , conversion_status(to_arithmetic_status::Valid)
+      {
+      }
+
+      //*********************************
+      ETL_NODISCARD ETL_CONSTEXPR14 bool add(char c)
+      {
+        bool is_success = true;
+
+        switch (state)
+        {
+          //***************************
+          case Parsing_Integral:
+            {
+              if (expecting_sign && ((c == char_constant::Positive_Char) || (c == char_constant::Negative_Char)))
+              {
+                is_negative_mantissa = (c == char_constant::Negative_Char);
+                expecting_sign       = false;
+              }
+              // Radix point?
+              else if ((c == char_constant::Radix_Point1_Char) || (c == char_constant::Radix_Point2_Char))
+              {
+                expecting_sign = false;
+                state          = Parsing_Fractional;
+              }
+              // Exponential?
+              else if (c == char_constant::Exponential_Char)
+              {
+                expecting_sign = true;
+                state          = Parsing_Exponential;
+              }
+              else if (is_valid(c, etl::radix::decimal))
+              {
+                add_digit(digit_value(c, etl::radix::decimal), false);
+                expecting_sign = false;
+              }
+              else
+              {
+                conversion_status = to_arithmetic_status::Invalid_Format;
+                is_success        = false;
+              }
+              break;
+            }
+
+          //***************************
+          case Parsing_Fractional:
+            {
+              // Radix point?
+              if ((c == char_constant::Radix_Point1_Char) || (c == char_constant::Radix_Point2_Char))
+              {
+                conversion_status = to_arithmetic_status::Invalid_Format;
+                is_success        = false;
+              }
+              // Exponential?
+              else if (c == char_constant::Exponential_Char)
+              {
+                expecting_sign = true;
+                state          = Parsing_Exponential;
+              }
+              else if (is_valid(c, etl::radix::decimal))
+              {
+                add_digit(digit_value(c, etl::radix::decimal), true);
+              }
+              else
+              {
+                conversion_status = to_arithmetic_status::Invalid_Format;
+                is_success        = false;
+              }
+              break;
+            }
+
+          //***************************
+          case Parsing_Exponential:
+            {
+              if (expecting_sign && ((c == char_constant::Positive_Char) || (c == char_constant::Negative_Char)))
+              {
+                is_negative_exponent = (c == char_constant::Negative_Char);
+                expecting_sign       = false;
+              }
+              // Radix point?
+              else if ((c == char_constant::Radix_Point1_Char) || (c == char_constant::Radix_Point2_Char) || (c == char_constant::Exponential_Char))
+              {
+                conversion_status = to_arithmetic_status::Invalid_Format;
+                is_success        = false;
+              }
+              else if (is_valid(c, etl::radix::decimal))
+              {
+                const char digit = digit_value(c, etl::radix::decimal);
+
+                // Saturate, as anything this large is already zero or infinite.
+                if (exponent_value < Max_Exponent)
+                {
+                  exponent_value = (exponent_value * etl::radix::decimal) + digit;
+                }
+
+                expecting_sign = false;
+              }
+              else
+              {
+                conversion_status = to_arithmetic_status::Invalid_Format;
+                is_success        = false;
+              }
+              break;
+            }
+
+          //***************************
+          default:
+            {
+              is_success = false;
+              break;
+            }
+        }
+
+        return is_success;
+      }
+
+      //*********************************
+      ETL_NODISCARD ETL_CONSTEXPR14 bool has_value() const
+      {
+        return (conversion_status == to_arithmetic_status::Valid);
+      }
+
+      //*********************************
+      /// The first 19 significant digits and their exponent.
+      //*********************************
+      ETL_NODISCARD ETL_CONSTEXPR14 etl::private_floating_point_digits::decimal value() const
+      {
+        etl::private_floating_point_digits::decimal result = {significand, exponent() + exponent_adjust};
+
+        return result;
+      }
+
+      //*********************************
+      /// True if non-zero digits were dropped from value().
+      //*********************************
+      ETL_NODISCARD ETL_CONSTEXPR14 bool is_exact() const
+      {
+        return !is_truncated;
+      }
+
+      //*********************************
+      ETL_NODISCARD ETL_CONSTEXPR14 bool is_negative() const
+      {
+        return is_negative_mantissa;
+      }
+
+      //*********************************
+      ETL_NODISCARD ETL_CONSTEXPR14 to_arithmetic_status status() const
+      {
+        return conversion_status;
+      }
+
+      //*********************************
+      ETL_NODISCARD ETL_CONSTEXPR14 int exponent() const
+      {
+        return is_negative_exponent ? -exponent_value : exponent_value;
+      }
+
+    private:
+
+      //*********************************
+      ETL_CONSTEXPR14 void add_digit(char digit, bool is_fractional)
+      {
+        if (significant_digits < Max_Significant_Digits)
+        {
+          // Leading zeros are not significant.
+          if ((significant_digits != 0) || (digit != 0))
+          {
+            significand = (significand * 10U) + static_cast<uint64_t>(digit);
+            ++significant_digits;
+          }
+
+          exponent_adjust -= is_fractional ? 1 : 0;
+        }
+        else
+        {
+          is_truncated = is_truncated || (digit != 0);
+          exponent_adjust += is_fractional ? 0 : 1;
+        }
+      }
+
+      enum
+      {
+        Parsing_Integral,
+        Parsing_Fractional,
+        Parsing_Exponential
+      };
+
+      static ETL_CONSTANT int Max_Significant_Digits = 19;
+      static ETL_CONSTANT int Max_Exponent           = 100000;
+
+      uint64_t             significand;
+      int                  significant_digits;
+      int                  exponent_adjust;
+      bool                 is_truncated;
+      bool                 is_negative_mantissa;
+      bool                 is_negative_exponent;
+      bool                 expecting_sign;
+      int                  exponent_value;
+      int                  state;
+      to_arithmetic_status conversion_status;
+    };
+#else
     //***************************************************************************
     /// Accumulate floating point
     //***************************************************************************
@@ -591,6 +881,7 @@ namespace etl
       int                  state;
       to_arithmetic_status conversion_status;
     };
+#endif
 
     //***************************************************************************
     // Define an unsigned accumulator type that is at least as large as TValue.
@@ -639,7 +930,25 @@ namespace etl
 
       integral_accumulator<TAccumulatorType> accumulator(radix, maximum);
 
-      while ((itr != itr_end) && accumulator.add(convert(*itr)))
+#if ETL_USING_64BIT_TYPES
+      // Decimal digits are added 8 at a time, while there are 8 to add.
+      if (radix == etl::radix::decimal)
+      {
+        while ((itr_end - itr) >= 8)
+        {
+          const uint64_t word = load_eight_chars(itr);
+
+          if (!is_eight_digits(word) || !accumulator.add_eight_digits(parse_eight_digits(word)))
+          {
+            break;
+          }
+
+          itr += 8;
+        }
+      }
+#endif
+
+      while (accumulator.has_value() && (itr != itr_end) && accumulator.add(convert(*itr)))
       {
         // Keep looping until done or an error occurs.
         ++itr;
@@ -842,6 +1151,54 @@ namespace etl
 
       if (result.has_value())
       {
+#if ETL_USING_64BIT_TYPES
+        using namespace etl::private_floating_point_digits;
+
+        // Long double is converted as double.
+        typedef typename etl::conditional<etl::is_same<TValue, float>::value, float, double>::type engine_type;
+
+        engine_type value;
+
+        if (accumulator.is_exact())
+        {
+          value = to_binary<engine_type>(accumulator.value());
+        }
+        else
+        {
+          // The digits are needed to round correctly. Find them again, without
+          // the sign or exponent.
+          itr = view.begin();
+
+          if ((*itr == char_constant::Positive_Char) || (*itr == char_constant::Negative_Char))
+          {
+            ++itr;
+          }
+
+          typename etl::basic_string_view<TChar>::const_iterator itr_exponent = itr;
+
+          while ((itr_exponent != itr_end) && (convert(*itr_exponent) != char_constant::Exponential_Char))
+          {
+            ++itr_exponent;
+          }
+
+          value = to_binary<engine_type>(accumulator.value(), itr, itr_exponent, accumulator.exponent());
+        }
+
+        if (accumulator.is_negative())
+        {
+          value = -value;
+        }
+
+        // Check that the result is a valid floating point number.
+        if (etl::is_infinity(value))
+        {
+          result = unexpected_type(to_arithmetic_status::Overflow);
+        }
+        else
+        {
+          result = static_cast<TValue>(value);
+        }
+#else
         TValue value    = static_cast<TValue>(accumulator.value());
         int    exponent = accumulator.exponent();
 
@@ -860,6 +1217,7 @@ namespace etl
         {
           result = value;
         }
+#endif
       }
     }
 
@@ -0,0 +1,1817 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_UNORDERED_FLAT_MAP_INCLUDED
+#define ETL_UNORDERED_FLAT_MAP_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "binary.h"
+#include "debug_count.h"
+#include "endianness.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "functional.h"
+#include "hash.h"
+#include "initializer_list.h"
+#include "iterator.h"
+#include "memory.h"
+#include "nth_type.h"
+#include "nullptr.h"
+#include "placement_new.h"
+#include "power.h"
+#include "type_traits.h"
+#include "utility.h"
+
+#include "private/comparator_is_transparent.h"
+
+#include <limits.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+//*****************************************************************************
+///\defgroup unordered_flat_map unordered_flat_map
+/// An open addressing unordered_map with the capacity defined at compile time.
+/// Elements are stored in a contiguous array of slots, indexed by a parallel
+/// array of control bytes. A lookup scans the control bytes with linear
+/// probing, matching a group of them at a time against the key's 7 bit hash
+/// tag, and only compares the keys in the slots that match.
+/// Erasing an element shifts the rest of its probe sequence back, so
+/// erasure invalidates iterators to other elements.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the unordered_flat_map.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  class unordered_flat_map_exception : public etl::exception
+  {
+  public:
+
+    unordered_flat_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the unordered_flat_map.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  class unordered_flat_map_full : public etl::unordered_flat_map_exception
+  {
+  public:
+
+    unordered_flat_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::unordered_flat_map_exception(ETL_ERROR_TEXT("unordered_flat_map:full", ETL_UNORDERED_FLAT_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of range exception for the unordered_flat_map.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  class unordered_flat_map_out_of_range : public etl::unordered_flat_map_exception
+  {
+  public:
+
+    unordered_flat_map_out_of_range(string_type file_name_, numeric_type line_number_)
+      : etl::unordered_flat_map_exception(ETL_ERROR_TEXT("unordered_flat_map:range", ETL_UNORDERED_FLAT_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Iterator exception for the unordered_flat_map.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  class unordered_flat_map_iterator : public etl::unordered_flat_map_exception
+  {
+  public:
+
+    unordered_flat_map_iterator(string_type file_name_, numeric_type line_number_)
+      : etl::unordered_flat_map_exception(ETL_ERROR_TEXT("unordered_flat_map:iterator", ETL_UNORDERED_FLAT_MAP_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_unordered_flat_map
+  {
+    //*************************************************************************
+    /// Matches a group of control bytes at once, packed into an integer.
+    /// Byte 'n' of the group is held in bits 8n to 8n+7, whatever the
+    /// endianness of the target.
+    //*************************************************************************
+    struct control_group
+    {
+#if ETL_USING_64BIT_TYPES
+      typedef uint64_t word_t;
+#else
+      typedef uint32_t word_t;
+#endif
+
+      enum
+      {
+        Width = sizeof(word_t)
+      };
+
+      //***********************************************************************
+      /// Loads the group of control bytes starting at 'p'.
+      //***********************************************************************
+      static word_t load(const uint8_t* p)
+      {
+        word_t word;
+        memcpy(&word, p, sizeof(word));
+
+        if (etl::endianness::value() == etl::endian::big)
+        {
+          word = etl::reverse_bytes(word);
+        }
+
+        return word;
+      }
+
+      //***********************************************************************
+      /// Gets a mask with the top bit set in the bytes that may equal 'tag'.
+      /// A byte just above one that does match may also be set, so the keys
+      /// must still be compared.
+      //***********************************************************************
+      static word_t match(word_t word, uint8_t tag)
+      {
+        const word_t x = word ^ (low_bits() * tag);
+
+        return (x - low_bits()) & ~x & high_bits();
+      }
+
+      //***********************************************************************
+      /// Gets a mask with the top bit set in the bytes that are empty.
+      //***********************************************************************
+      static word_t match_empty(word_t word)
+      {
+        return word & high_bits();
+      }
+
+      //***********************************************************************
+      /// Gets the position of the first byte set in the mask.
+      //***********************************************************************
+      static size_t first(word_t mask)
+      {
+        // Sets all of the bits below the first set one, then sums their bytes.
+        const word_t below = ((mask & (word_t(0U) - mask)) >> 7U) - 1U;
+
+        return static_cast<size_t>(((below & low_bits()) * low_bits()) >> ((Width - 1U) * 8U));
+      }
+
+    private:
+
+      /// 0x0101...01
+      static word_t low_bits()
+      {
+        return word_t(~word_t(0U)) / 0xFFU;
+      }
+
+      /// 0x8080...80
+      static word_t high_bits()
+      {
+        return low_bits() * 0x80U;
+      }
+    };
+  } // namespace private_unordered_flat_map
+
+  //***************************************************************************
+  /// The base class for specifically sized unordered_flat_map.
+  /// Can be used as a reference type for all unordered_flat_map containing a
+  /// specific type.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class iunordered_flat_map
+  {
+  public:
+
+    typedef ETL_OR_STD::pair<const TKey, T> value_type;
+
+    typedef TKey              key_type;
+    typedef T                 mapped_type;
+    typedef THash             hasher;
+    typedef TKeyEqual         key_equal;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+#if ETL_USING_CPP11
+    typedef value_type&& rvalue_reference;
+#endif
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+
+    /// Defines the parameter types
+    typedef const key_type& const_key_reference;
+#if ETL_USING_CPP11
+    typedef key_type&& rvalue_key_reference;
+#endif
+    typedef mapped_type&       mapped_reference;
+    typedef const mapped_type& const_mapped_reference;
+
+    /// The type of the per-slot control byte.
+    typedef uint8_t control_t;
+
+  protected:
+
+    typedef private_unordered_flat_map::control_group control_group;
+
+    //*********************************************************************
+    /// Control byte values.
+    /// A full slot holds the top 7 bits of the key's hash (0x00 to 0x7F).
+    //*********************************************************************
+    static ETL_CONSTANT control_t Empty = 0x80U;
+
+    //*********************************************************************
+    static bool is_full(control_t control)
+    {
+      return (control & 0x80U) == 0U;
+    }
+
+  public:
+
+    //*********************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, T>
+    {
+    public:
+
+      typedef typename etl::iterator<ETL_OR_STD::forward_iterator_tag, T>::value_type value_type;
+      typedef typename iunordered_flat_map::key_type                                  key_type;
+      typedef typename iunordered_flat_map::mapped_type                               mapped_type;
+      typedef typename iunordered_flat_map::hasher                                    hasher;
+      typedef typename iunordered_flat_map::key_equal                                 key_equal;
+      typedef typename iunordered_flat_map::reference                                 reference;
+      typedef typename iunordered_flat_map::const_reference                           const_reference;
+      typedef typename iunordered_flat_map::pointer                                   pointer;
+      typedef typename iunordered_flat_map::const_pointer                             const_pointer;
+      typedef typename iunordered_flat_map::size_type                                 size_type;
+
+      friend class iunordered_flat_map;
+      friend class const_iterator;
+
+      //*********************************
+      iterator()
+        : pcontrol(ETL_NULLPTR)
+        , pslots(ETL_NULLPTR)
+        , index(0U)
+        , number_of_slots(0U)
+      {
+      }
+
+      //*********************************
+      iterator(const iterator& other)
+        : pcontrol(other.pcontrol)
+        , pslots(other.pslots)
+        , index(other.index)
+        , number_of_slots(other.number_of_slots)
+      {
+      }
+
+      //*********************************
+      iterator& operator++()
+      {
+        ++index;
+        skip_unused_slots();
+
+        return *this;
+      }
+
+      //*********************************
+      iterator operator++(int)
+      {
+        iterator temp(*this);
+        operator++();
+        return temp;
+      }
+
+      //*********************************
+      iterator& operator=(const iterator& other)
+      {
+        pcontrol        = other.pcontrol;
+        pslots          = other.pslots;
+        index           = other.index;
+        number_of_slots = other.number_of_slots;
+        return *this;
+      }
+
+      //*********************************
+      reference operator*() const
+      {
+        return pslots[index];
+      }
+
+      //*********************************
+      pointer operator&() const
+      {
+        return &(pslots[index]);
+      }
+
+      //*********************************
+      pointer operator->() const
+      {
+        return &(pslots[index]);
+      }
+
+      //*********************************
+      friend bool operator==(const iterator& lhs, const iterator& rhs)
+      {
+        return (lhs.index == rhs.index) && (lhs.pslots == rhs.pslots);
+      }
+
+      //*********************************
+      friend bool operator!=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*********************************
+      iterator(const control_t* pcontrol_, pointer pslots_, size_t index_, size_t number_of_slots_)
+        : pcontrol(pcontrol_)
+        , pslots(pslots_)
+        , index(index_)
+        , number_of_slots(number_of_slots_)
+      {
+      }
+
+      //*********************************
+      void skip_unused_slots()
+      {
+        while ((index < number_of_slots) && !is_full(pcontrol[index]))
+        {
+          ++index;
+        }
+      }
+
+      const control_t* pcontrol;
+      pointer          pslots;
+      size_t           index;
+      size_t           number_of_slots;
+    };
+
+    //*********************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, const T>
+    {
+    public:
+
+      typedef typename etl::iterator<ETL_OR_STD::forward_iterator_tag, const T>::value_type value_type;
+      typedef typename iunordered_flat_map::key_type                                        key_type;
+      typedef typename iunordered_flat_map::mapped_type                                     mapped_type;
+      typedef typename iunordered_flat_map::hasher                                          hasher;
+      typedef typename iunordered_flat_map::key_equal                                       key_equal;
+      typedef typename iunordered_flat_map::reference                                       reference;
+      typedef typename iunordered_flat_map::const_reference                                 const_reference;
+      typedef typename iunordered_flat_map::pointer                                         pointer;
+      typedef typename iunordered_flat_map::const_pointer                                   const_pointer;
+      typedef typename iunordered_flat_map::size_type                                       size_type;
+
+      friend class iunordered_flat_map;
+      friend class iterator;
+
+      //*********************************
+      const_iterator()
+        : pcontrol(ETL_NULLPTR)
+        , pslots(ETL_NULLPTR)
+        , index(0U)
+        , number_of_slots(0U)
+      {
+      }
+
+      //*********************************
+      const_iterator(const typename iunordered_flat_map::iterator& other)
+        : pcontrol(other.pcontrol)
+        , pslots(other.pslots)
+        , index(other.index)
+        , number_of_slots(other.number_of_slots)
+      {
+      }
+
+      //*********************************
+      const_iterator(const const_iterator& other)
+        : pcontrol(other.pcontrol)
+        , pslots(other.pslots)
+        , index(other.index)
+        , number_of_slots(other.number_of_slots)
+      {
+      }
+
+      //*********************************
+      const_iterator& operator++()
+      {
+        ++index;
+        skip_unused_slots();
+
+        return *this;
+      }
+
+      //*********************************
+      const_iterator operator++(int)
+      {
+        const_iterator temp(*this);
+        operator++();
+        return temp;
+      }
+
+      //*********************************
+      const_iterator& operator=(const const_iterator& other)
+      {
+        pcontrol        = other.pcontrol;
+        pslots          = other.pslots;
+        index           = other.index;
+        number_of_slots = other.number_of_slots;
+        return *this;
+      }
+
+      //*********************************
+      const_reference operator*() const
+      {
+        return pslots[index];
+      }
+
+      //*********************************
+      const_pointer operator&() const
+      {
+        return &(pslots[index]);
+      }
+
+      //*********************************
+      const_pointer operator->() const
+      {
+        return &(pslots[index]);
+      }
+
+      //*********************************
+      friend bool operator==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.index == rhs.index) && (lhs.pslots == rhs.pslots);
+      }
+
+      //*********************************
+      friend bool operator!=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*********************************
+      const_iterator(const control_t* pcontrol_, const_pointer pslots_, size_t index_, size_t number_of_slots_)
+        : pcontrol(pcontrol_)
+        , pslots(pslots_)
+        , index(index_)
+        , number_of_slots(number_of_slots_)
+      {
+      }
+
+      //*********************************
+      void skip_unused_slots()
+      {
+        while ((index < number_of_slots) && !is_full(pcontrol[index]))
+        {
+          ++index;
+        }
+      }
+
+      const control_t* pcontrol;
+      const_pointer    pslots;
+      size_t           index;
+      size_t           number_of_slots;
+    };
+
+    typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+
+    //*********************************************************************
+    /// Returns an iterator to the beginning of the unordered_flat_map.
+    ///\return An iterator to the beginning of the unordered_flat_map.
+    //*********************************************************************
+    iterator begin()
+    {
+      iterator itr(pcontrol, pslots, 0U, number_of_slots);
+      itr.skip_unused_slots();
+
+      return itr;
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the unordered_flat_map.
+    ///\return A const iterator to the beginning of the unordered_flat_map.
+    //*********************************************************************
+    const_iterator begin() const
+    {
+      const_iterator itr(pcontrol, pslots, 0U, number_of_slots);
+      itr.skip_unused_slots();
+
+      return itr;
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the unordered_flat_map.
+    ///\return A const iterator to the beginning of the unordered_flat_map.
+    //*********************************************************************
+    const_iterator cbegin() const
+    {
+      return begin();
+    }
+
+    //*********************************************************************
+    /// Returns an iterator to the end of the unordered_flat_map.
+    ///\return An iterator to the end of the unordered_flat_map.
+    //*********************************************************************
+    iterator end()
+    {
+      return iterator(pcontrol, pslots, number_of_slots, number_of_slots);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the unordered_flat_map.
+    ///\return A const iterator to the end of the unordered_flat_map.
+    //*********************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(pcontrol, pslots, number_of_slots, number_of_slots);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the unordered_flat_map.
+    ///\return A const iterator to the end of the unordered_flat_map.
+    //*********************************************************************
+    const_iterator cend() const
+    {
+      return end();
+    }
+
+    //*********************************************************************
+    /// Returns the home slot index for the key.
+    /// This is the slot at which the probe sequence for the key starts.
+    ///\return The home slot index for the key.
+    //*********************************************************************
+    size_type get_bucket_index(const_key_reference key) const
+    {
+      return hash_key(key) & slot_mask;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Returns the home slot index for the key.
+    /// This is the slot at which the probe sequence for the key starts.
+    ///\return The home slot index for the key.
+    //*********************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    size_type get_bucket_index(const K& key) const
+    {
+      return hash_key(key) & slot_mask;
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns the number of slots that a lookup of the key examines,
+    /// whether or not the key is in the map.
+    /// Useful for checking how well a hash function suits the keys.
+    ///\return The number of slots examined.
+    //*********************************************************************
+    size_type probe_length(const_key_reference key) const
+    {
+      const size_t    hash   = hash_key(key);
+      const control_t tag    = get_tag(hash);
+      size_t          index  = hash & slot_mask;
+      size_type       length = 1U;
+
+      while ((pcontrol[index] != Empty) && !((pcontrol[index] == tag) && key_equal_function(key, pslots[index].first)))
+      {
+        index = (index + 1U) & slot_mask;
+        ++length;
+      }
+
+      return length;
+    }
+
+    //*********************************************************************
+    /// Returns the maximum number of the slots the container can hold.
+    ///\return The maximum number of the slots the container can hold.
+    //*********************************************************************
+    size_type max_bucket_count() const
+    {
+      return number_of_slots;
+    }
+
+    //*********************************************************************
+    /// Returns the number of the slots the container holds.
+    ///\return The number of the slots the container holds.
+    //*********************************************************************
+    size_type bucket_count() const
+    {
+      return number_of_slots;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference operator[](rvalue_key_reference key)
+    {
+      size_t hash  = hash_key(key);
+      size_t index = find_index(key, hash);
+
+      if (index == number_of_slots)
+      {
+        // Doesn't exist, so add a new one.
+        index = allocate_slot(key, hash);
+        ::new ((void*)etl::addressof(pslots[index].first)) key_type(etl::move(key));
+        ::new ((void*)etl::addressof(pslots[index].second)) mapped_type();
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
+
+      return pslots[index].second;
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference operator[](const_key_reference key)
+    {
+      size_t hash  = hash_key(key);
+      size_t index = find_index(key, hash);
+
+      if (index == number_of_slots)
+      {
+        // Doesn't exist, so add a new one.
+        index = allocate_slot(key, hash);
+        ::new ((void*)etl::addressof(pslots[index].first)) key_type(key);
+        ::new ((void*)etl::addressof(pslots[index].second)) mapped_type();
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
+
+      return pslots[index].second;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    mapped_reference operator[](const K& key)
+    {
+      size_t hash  = hash_key(key);
+      size_t index = find_index(key, hash);
+
+      if (index == number_of_slots)
+      {
+        // Doesn't exist, so add a new one.
+        index = allocate_slot(key, hash);
+        ::new ((void*)etl::addressof(pslots[index].first)) key_type(key);
+        ::new ((void*)etl::addressof(pslots[index].second)) mapped_type();
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
+
+      return pslots[index].second;
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an
+    /// etl::unordered_flat_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference at(const_key_reference key)
+    {
+      size_t index = find_index(key, hash_key(key));
+
+      ETL_ASSERT(index != number_of_slots, ETL_ERROR(unordered_flat_map_out_of_range));
+
+      return pslots[index].second;
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an
+    /// etl::unordered_flat_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
+    //*********************************************************************
+    const_mapped_reference at(const_key_reference key) const
+    {
+      size_t index = find_index(key, hash_key(key));
+
+      ETL_ASSERT(index != number_of_slots, ETL_ERROR(unordered_flat_map_out_of_range));
+
+      return pslots[index].second;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an
+    /// etl::unordered_flat_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    mapped_reference at(const K& key)
+    {
+      size_t index = find_index(key, hash_key(key));
+
+      ETL_ASSERT(index != number_of_slots, ETL_ERROR(unordered_flat_map_out_of_range));
+
+      return pslots[index].second;
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an
+    /// etl::unordered_flat_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
+    //*********************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    const_mapped_reference at(const K& key) const
+    {
+      size_t index = find_index(key, hash_key(key));
+
+      ETL_ASSERT(index != number_of_slots, ETL_ERROR(unordered_flat_map_out_of_range));
+
+      return pslots[index].second;
+    }
+#endif
+
+    //*********************************************************************
+    /// Assigns values to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if
+    /// the unordered_flat_map does not have enough free space. If asserts or
+    /// exceptions are enabled, emits unordered_flat_map_iterator if the
+    /// iterators are reversed.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first_, TIterator last_)
+    {
+#if ETL_IS_DEBUG_BUILD
+      difference_type d = etl::distance(first_, last_);
+      ETL_ASSERT(d >= 0, ETL_ERROR(unordered_flat_map_iterator));
+      ETL_ASSERT(size_t(d) <= max_size(), ETL_ERROR(unordered_flat_map_full));
+#endif
+
+      clear();
+
+      while (first_ != last_)
+      {
+        insert(*first_);
+        ++first_;
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if
+    /// the unordered_flat_map is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference key_value_pair)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unordered_flat_map_full));
+
+      const key_type& key = key_value_pair.first;
+
+      size_t hash  = hash_key(key);
+      size_t index = find_index(key, hash);
+
+      // Already there?
+      if (index != number_of_slots)
+      {
+        return ETL_OR_STD::pair<iterator, bool>(make_iterator(index), false);
+      }
+
+      index = allocate_slot(key, hash);
+      ::new ((void*)etl::addressof(pslots[index])) value_type(key_value_pair);
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      return ETL_OR_STD::pair<iterator, bool>(make_iterator(index), true);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if
+    /// the unordered_flat_map is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference key_value_pair)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unordered_flat_map_full));
+
+      const key_type& key = key_value_pair.first;
+
+      size_t hash  = hash_key(key);
+      size_t index = find_index(key, hash);
+
+      // Already there?
+      if (index != number_of_slots)
+      {
+        return ETL_OR_STD::pair<iterator, bool>(make_iterator(index), false);
+      }
+
+      index = allocate_slot(key, hash);
+      ::new ((void*)etl::addressof(pslots[index])) value_type(etl::move(key_value_pair));
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      return ETL_OR_STD::pair<iterator, bool>(make_iterator(index), true);
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if
+    /// the unordered_flat_map is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, const_reference key_value_pair)
+    {
+      return insert(key_value_pair).first;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if
+    /// the unordered_flat_map is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, rvalue_reference key_value_pair)
+    {
+      return insert(etl::move(key_value_pair)).first;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if
+    /// the unordered_flat_map does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first_, TIterator last_)
+    {
+      while (first_ != last_)
+      {
+        insert(*first_);
+        ++first_;
+      }
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    size_t erase(const_key_reference key)
+    {
+      size_t index = find_index(key, hash_key(key));
+
+      if (index == number_of_slots)
+      {
+        return 0U;
+      }
+
+      release_slot(index);
+
+      return 1U;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    size_t erase(const K& key)
+    {
+      size_t index = find_index(key, hash_key(key));
+
+      if (index == number_of_slots)
+      {
+        return 0U;
+      }
+
+      release_slot(index);
+
+      return 1U;
+    }
+#endif
+
+    //*********************************************************************
+    /// Erases an element.
+    /// Elements later in the probe sequence are shifted back to close the
+    /// gap, so iterators to other elements are invalidated.
+    /// The returned iterator may be used to continue iterating. If the probe
+    /// sequence wraps round the end of the slots, an element that has already
+    /// been visited may be moved to a later slot and be visited again.
+    ///\param ielement Iterator to the element.
+    ///\return An iterator to the next element.
+    //*********************************************************************
+    iterator erase(const_iterator ielement)
+    {
+      size_t index = ielement.index;
+
+      release_slot(index);
+
+      return make_next_iterator(index);
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    /// The range includes all the elements between first and last, including
+    /// the element pointed by first, but not the one pointed to by last.
+    ///\param first Iterator to the first element.
+    ///\param last  Iterator to the last element.
+    //*********************************************************************
+    iterator erase(const_iterator first_, const_iterator last_)
+    {
+      // Erasing everything?
+      if ((first_ == cbegin()) && (last_ == cend()))
+      {
+        clear();
+        return end();
+      }
+
+      // Destroy the whole range first, as closing the gaps one at a time
+      // could move elements from after the range into it.
+      const size_t first_index = first_.index;
+      const size_t last_index  = last_.index;
+
+      for (size_t index = first_index; index != last_index; ++index)
+      {
+        if (is_full(pcontrol[index]))
+        {
+          destroy_slot(index);
+        }
+      }
+
+      // Re-place the elements whose probe sequences ran through the range.
+      size_t index = last_index & slot_mask;
+
+      while (is_full(pcontrol[index]))
+      {
+        relocate_slot(index);
+        index = (index + 1U) & slot_mask;
+      }
+
+      return make_next_iterator(first_index);
+    }
+
+    //*************************************************************************
+    /// Clears the unordered_flat_map.
+    //*************************************************************************
+    void clear()
+    {
+      initialise();
+    }
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(const_key_reference key) const
+    {
+      return (find_index(key, hash_key(key)) == number_of_slots) ? 0 : 1;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    size_t count(const K& key) const
+    {
+      return (find_index(key, hash_key(key)) == number_of_slots) ? 0 : 1;
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    iterator find(const_key_reference key)
+    {
+      return make_iterator(find_index(key, hash_key(key)));
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    const_iterator find(const_key_reference key) const
+    {
+      return make_const_iterator(find_index(key, hash_key(key)));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    iterator find(const K& key)
+    {
+      return make_iterator(find_index(key, hash_key(key)));
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    const_iterator find(const K& key) const
+    {
+      return make_const_iterator(find_index(key, hash_key(key)));
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return An iterator pair to the range of elements if the key exists,
+    /// otherwise end().
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const_key_reference key)
+    {
+      iterator f = find(key);
+      iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<iterator, iterator>(f, l);
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return A const iterator pair to the range of elements if the key exists,
+    /// otherwise end().
+    //*********************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const_key_reference key) const
+    {
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return An iterator pair to the range of elements if the key exists,
+    /// otherwise end().
+    //*********************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      iterator f = find(key);
+      iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<iterator, iterator>(f, l);
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return A const iterator pair to the range of elements if the key exists,
+    /// otherwise end().
+    //*********************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets the size of the unordered_flat_map.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the unordered_flat_map.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return maximum_size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the unordered_flat_map.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return maximum_size;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the unordered_flat_map is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the unordered_flat_map is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == maximum_size;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return maximum_size - current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the load factor = size / bucket_count.
+    ///\return The load factor = size / bucket_count.
+    //*************************************************************************
+    float load_factor() const
+    {
+      return static_cast<float>(size()) / static_cast<float>(bucket_count());
+    }
+
+    //*************************************************************************
+    /// Returns the function that hashes the keys.
+    ///\return The function that hashes the keys..
+    //*************************************************************************
+    hasher hash_function() const
+    {
+      return key_hash_function;
+    }
+
+    //*************************************************************************
+    /// Returns the function that compares the keys.
+    ///\return The function that compares the keys..
+    //*************************************************************************
+    key_equal key_eq() const
+    {
+      return key_equal_function;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    iunordered_flat_map& operator=(const iunordered_flat_map& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        key_hash_function  = rhs.hash_function();
+        key_equal_function = rhs.key_eq();
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iunordered_flat_map& operator=(iunordered_flat_map&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        clear();
+        key_hash_function  = rhs.hash_function();
+        key_equal_function = rhs.key_eq();
+        this->move(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+#endif
+
+    //*************************************************************************
+    /// Check if the unordered_flat_map contains the key.
+    //*************************************************************************
+    bool contains(const_key_reference key) const
+    {
+      return find_index(key, hash_key(key)) != number_of_slots;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Check if the unordered_flat_map contains the key.
+    //*************************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    bool contains(const K& key) const
+    {
+      return find_index(key, hash_key(key)) != number_of_slots;
+    }
+#endif
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    /// The number of slots must be a power of 2 and greater than max_size.
+    /// There must be control_group::Width - 1 control bytes after those for
+    /// the slots.
+    //*********************************************************************
+    iunordered_flat_map(control_t* pcontrol_, value_type* pslots_, size_t number_of_slots_, size_t max_size_, hasher key_hash_function_,
+                        key_equal key_equal_function_)
+      : pcontrol(pcontrol_)
+      , pslots(pslots_)
+      , number_of_slots(number_of_slots_)
+      , slot_mask(number_of_slots_ - 1U)
+      , maximum_size(max_size_)
+      , current_size(0U)
+      , key_hash_function(key_hash_function_)
+      , key_equal_function(key_equal_function_)
+    {
+      etl::fill_n(pcontrol, number_of_slots + control_group::Width - 1U, Empty);
+    }
+
+    //*********************************************************************
+    /// Initialise the unordered_flat_map.
+    //*********************************************************************
+    void initialise()
+    {
+      if (!empty())
+      {
+        for (size_t i = 0U; i < number_of_slots; ++i)
+        {
+          if (is_full(pcontrol[i]))
+          {
+            pslots[i].~value_type();
+            ETL_DECREMENT_DEBUG_COUNT;
+          }
+        }
+
+        current_size = 0U;
+      }
+
+      etl::fill_n(pcontrol, number_of_slots + control_group::Width - 1U, Empty);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move from a range
+    //*************************************************************************
+    void move(iterator b, iterator e)
+    {
+      while (b != e)
+      {
+        iterator temp = b;
+        ++temp;
+        insert(etl::move(*b));
+        b = temp;
+      }
+    }
+#endif
+
+  private:
+
+    //*********************************************************************
+    /// Hashes the key.
+    /// The hasher's result is passed through the murmur3 finaliser, so weak
+    /// hashes, such as the identity etl::hash for integrals, still spread
+    /// over the slots and give varied tags.
+    //*********************************************************************
+    template <typename K>
+    size_t hash_key(const K& key) const
+    {
+      return etl::murmur3_hash_finaliser()(static_cast<size_t>(key_hash_function(key)));
+    }
+
+    //*********************************************************************
+    /// Gets the 7 bit tag stored in the control byte from the top of the hash.
+    //*********************************************************************
+    static control_t get_tag(size_t hash)
+    {
+      return static_cast<control_t>((hash >> ((sizeof(size_t) * CHAR_BIT) - 7U)) & 0x7FU);
+    }
+
+    //*********************************************************************
+    /// Finds the slot holding the key.
+    ///\return The slot index, or number_of_slots if not found.
+    //*********************************************************************
+    template <typename K>
+    size_t find_index(const K& key, size_t hash) const
+    {
+      const control_t tag   = get_tag(hash);
+      size_t          index = hash & slot_mask;
+
+      for (size_t probe = 0U; probe < number_of_slots; probe += control_group::Width)
+      {
+        const control_group::word_t group   = control_group::load(pcontrol + index);
+        control_group::word_t       matches = control_group::match(group, tag);
+
+        while (matches != 0U)
+        {
+          const size_t match_index = (index + control_group::first(matches)) & slot_mask;
+
+          if (key_equal_function(key, pslots[match_index].first))
+          {
+            return match_index;
+          }
+
+          // Clear the lowest match.
+          matches &= (matches - 1U);
+        }
+
+        // An empty slot terminates every probe sequence passing through it.
+        if (control_group::match_empty(group) != 0U)
+        {
+          break;
+        }
+
+        index = (index + control_group::Width) & slot_mask;
+      }
+
+      return number_of_slots;
+    }
+
+    //*********************************************************************
+    /// Claims the first free slot in the key's probe sequence.
+    /// The key must not already be in the map.
+    ///\return The slot index.
+    //*********************************************************************
+    template <typename K>
+    size_t allocate_slot(const K&, size_t hash)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unordered_flat_map_full));
+
+      size_t                index   = hash & slot_mask;
+      control_group::word_t empties = control_group::match_empty(control_group::load(pcontrol + index));
+
+      // There is always at least one free slot, as number_of_slots > max_size.
+      while (empties == 0U)
+      {
+        index   = (index + control_group::Width) & slot_mask;
+        empties = control_group::match_empty(control_group::load(pcontrol + index));
+      }
+
+      index = (index + control_group::first(empties)) & slot_mask;
+
+      set_control(index, get_tag(hash));
+      ++current_size;
+
+      return index;
+    }
+
+    //*********************************************************************
+    /// Destroys the element in the slot and marks it as empty.
+    //*********************************************************************
+    void destroy_slot(size_t index)
+    {
+      pslots[index].~value_type();
+      set_control(index, Empty);
+      ETL_DECREMENT_DEBUG_COUNT;
+      --current_size;
+    }
+
+    //*********************************************************************
+    /// Moves the element in slot 'from' to the empty slot 'to'.
+    //*********************************************************************
+    void move_slot(size_t from, size_t to)
+    {
+#if ETL_USING_CPP11
+      ::new (&pslots[to]) value_type(etl::move(pslots[from]));
+#else
+      ::new (&pslots[to]) value_type(pslots[from]);
+#endif
+      pslots[from].~value_type();
+
+      set_control(to, pcontrol[from]);
+      set_control(from, Empty);
+    }
+
+    //*********************************************************************
+    /// Sets the control byte for the slot.
+    /// The control bytes of the first slots are copied after the last one,
+    /// so that a group loaded near the end wraps round to the start.
+    //*********************************************************************
+    void set_control(size_t index, control_t control)
+    {
+      pcontrol[index] = control;
+
+      if (index < (control_group::Width - 1U))
+      {
+        for (size_t copy = index + number_of_slots; copy < (number_of_slots + control_group::Width - 1U); copy += number_of_slots)
+        {
+          pcontrol[copy] = control;
+        }
+      }
+    }
+
+    //*********************************************************************
+    /// Destroys the element in the slot, then shifts the following elements
+    /// of the probe sequence back to close the gap.
+    /// An element may move to the gap if its home slot is not between the
+    /// gap and its current slot. No tombstones are left behind, so lookups
+    /// never have to probe past erased elements.
+    //*********************************************************************
+    void release_slot(size_t index)
+    {
+      destroy_slot(index);
+
+      size_t gap  = index;
+      size_t next = (index + 1U) & slot_mask;
+
+      while (is_full(pcontrol[next]))
+      {
+        const size_t home = hash_key(pslots[next].first) & slot_mask;
+
+        // Is the gap no further from the element's slot than its home is?
+        if (((next - gap) & slot_mask) <= ((next - home) & slot_mask))
+        {
+          move_slot(next, gap);
+          gap = next;
+        }
+
+        next = (next + 1U) & slot_mask;
+      }
+    }
+
+    //*********************************************************************
+    /// Moves the element in the slot to the first empty slot in its probe
+    /// sequence, if that is before the slot.
+    //*********************************************************************
+    void relocate_slot(size_t index)
+    {
+      size_t free = hash_key(pslots[index].first) & slot_mask;
+
+      while ((free != index) && is_full(pcontrol[free]))
+      {
+        free = (free + 1U) & slot_mask;
+      }
+
+      if (free != index)
+      {
+        move_slot(index, free);
+      }
+    }
+
+    //*********************************************************************
+    /// An iterator to the first element at or after the slot.
+    //*********************************************************************
+    iterator make_next_iterator(size_t index)
+    {
+      iterator inext = make_iterator(index);
+
+      if ((index < number_of_slots) && !is_full(pcontrol[index]))
+      {
+        ++inext;
+      }
+
+      return inext;
+    }
+
+    //*********************************************************************
+    iterator make_iterator(size_t index)
+    {
+      return iterator(pcontrol, pslots, index, number_of_slots);
+    }
+
+    //*********************************************************************
+    const_iterator make_const_iterator(size_t index) const
+    {
+      return const_iterator(pcontrol, pslots, index, number_of_slots);
+    }
+
+    // Disable copy construction.
+    iunordered_flat_map(const iunordered_flat_map&);
+
+    /// The control bytes, followed by copies of the first control_group::Width - 1.
+    control_t* pcontrol;
+
+    /// The slots.
+    value_type* pslots;
+
+    /// The number of slots.
+    const size_t number_of_slots;
+
+    /// The mask to convert a hash to a slot index.
+    const size_t slot_mask;
+
+    /// The maximum number of elements.
+    const size_t maximum_size;
+
+    /// The current number of elements.
+    size_t current_size;
+
+    /// The function that creates the hashes.
+    hasher key_hash_function;
+
+    /// The function that compares the keys for equality.
+    key_equal key_equal_function;
+
+    /// For library debugging purposes only.
+    ETL_DECLARE_DEBUG_COUNT;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_UNORDERED_FLAT_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+
+  public:
+
+    virtual ~iunordered_flat_map() {}
+#else
+
+  protected:
+
+    ~iunordered_flat_map() {}
+#endif
+  };
+
+  template <typename TKey, typename T, typename THash, typename TKeyEqual>
+  ETL_CONSTANT typename iunordered_flat_map<TKey, T, THash, TKeyEqual>::control_t iunordered_flat_map<TKey, T, THash, TKeyEqual>::Empty;
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first unordered_flat_map.
+  ///\param rhs Reference to the second unordered_flat_map.
+  ///\return <b>true</b> if the arrays are equal, otherwise <b>false</b>
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename THash, typename TKeyEqual>
+  bool operator==(const etl::iunordered_flat_map<TKey, T, THash, TKeyEqual>& lhs, const etl::iunordered_flat_map<TKey, T, THash, TKeyEqual>& rhs)
+  {
+    const bool sizes_match    = (lhs.size() == rhs.size());
+    bool       elements_match = true;
+
+    typedef typename etl::iunordered_flat_map<TKey, T, THash, TKeyEqual>::const_iterator itr_t;
+
+    if (sizes_match)
+    {
+      itr_t l_begin = lhs.begin();
+      itr_t l_end   = lhs.end();
+
+      while ((l_begin != l_end) && elements_match)
+      {
+        // See if the lhs key exists in the rhs.
+        itr_t irhs = rhs.find(l_begin->first);
+
+        if (irhs != rhs.end())
+        {
+          // See if the values match
+          elements_match = (irhs->second == l_begin->second);
+        }
+        else
+        {
+          elements_match = false;
+        }
+
+        ++l_begin;
+      }
+    }
+
+    return (sizes_match && elements_match);
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first unordered_flat_map.
+  ///\param rhs Reference to the second unordered_flat_map.
+  ///\return <b>true</b> if the arrays are not equal, otherwise <b>false</b>
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename THash, typename TKeyEqual>
+  bool operator!=(const etl::iunordered_flat_map<TKey, T, THash, TKeyEqual>& lhs, const etl::iunordered_flat_map<TKey, T, THash, TKeyEqual>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// A templated unordered_flat_map implementation that uses a fixed size buffer.
+  /// The number of slots is the smallest power of 2 that keeps the maximum
+  /// load factor at or below 3/4.
+  //*************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class unordered_flat_map : public etl::iunordered_flat_map<TKey, TValue, THash, TKeyEqual>
+  {
+  private:
+
+    typedef iunordered_flat_map<TKey, TValue, THash, TKeyEqual> base;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE  = MAX_SIZE_;
+    static ETL_CONSTANT size_t MAX_SLOTS = etl::power_of_2_round_up<MAX_SIZE_ + ((MAX_SIZE_ + 2U) / 3U)>::value;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    unordered_flat_map(const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(control, reinterpret_cast<typename base::value_type*>(&slots), MAX_SLOTS, MAX_SIZE, hash, equal)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    unordered_flat_map(const unordered_flat_map& other)
+      : base(control, reinterpret_cast<typename base::value_type*>(&slots), MAX_SLOTS, MAX_SIZE, other.hash_function(), other.key_eq())
+    {
+      base::assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    unordered_flat_map(unordered_flat_map&& other)
+      : base(control, reinterpret_cast<typename base::value_type*>(&slots), MAX_SLOTS, MAX_SIZE, other.hash_function(), other.key_eq())
+    {
+      if (this != &other)
+      {
+        base::move(other.begin(), other.end());
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    unordered_flat_map(TIterator first_, TIterator last_, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(control, reinterpret_cast<typename base::value_type*>(&slots), MAX_SLOTS, MAX_SIZE, hash, equal)
+    {
+      base::assign(first_, last_);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    unordered_flat_map(std::initializer_list<ETL_OR_STD::pair<TKey, TValue>> init, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(control, reinterpret_cast<typename base::value_type*>(&slots), MAX_SLOTS, MAX_SIZE, hash, equal)
+    {
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~unordered_flat_map()
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    unordered_flat_map& operator=(const unordered_flat_map& rhs)
+    {
+      base::operator=(rhs);
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    unordered_flat_map& operator=(unordered_flat_map&& rhs)
+    {
+      base::operator=(etl::move(rhs));
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The control bytes, one per slot, then the copies that let a group wrap.
+    typename base::control_t control[MAX_SLOTS + base::control_group::Width - 1U];
+
+    /// The contiguous slot storage.
+    typename etl::aligned_storage<sizeof(typename base::value_type) * MAX_SLOTS, etl::alignment_of<typename base::value_type>::value>::type slots;
+  };
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t unordered_flat_map<TKey, TValue, MAX_SIZE_, THash, TKeyEqual>::MAX_SIZE;
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t unordered_flat_map<TKey, TValue, MAX_SIZE_, THash, TKeyEqual>::MAX_SLOTS;
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if ETL_USING_CPP17 && ETL_HAS_INITIALIZER_LIST
+  template <typename... TPairs>
+  unordered_flat_map(TPairs...) -> unordered_flat_map<typename etl::nth_type_t<0, TPairs...>::first_type,
+                                                      typename etl::nth_type_t<0, TPairs...>::second_type, sizeof...(TPairs)>;
+#endif
+
+  //*************************************************************************
+  /// Make
+  //*************************************************************************
+#if ETL_USING_CPP11 && ETL_HAS_INITIALIZER_LIST
+  template <typename TKey, typename T, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename... TPairs>
+  constexpr auto make_unordered_flat_map(TPairs&&... pairs) -> etl::unordered_flat_map<TKey, T, sizeof...(TPairs), THash, TKeyEqual>
+  {
+    return {etl::forward<TPairs>(pairs)...};
+  }
+#endif
+} // namespace etl
+
+#endif
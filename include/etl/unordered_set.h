@@ -584,7 +584,7 @@ namespace etl
     //*********************************************************************
     size_type get_bucket_index(key_parameter_t key) const
     {
-      return key_hash_function(key) % number_of_buckets;
+      return hash_to_bucket_index(key_hash_function(key));
     }
 
 #if ETL_USING_CPP11
@@ -595,7 +595,7 @@ namespace etl
     template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
     size_type get_bucket_index(const K& key) const
     {
-      return key_hash_function(key) % number_of_buckets;
+      return hash_to_bucket_index(key_hash_function(key));
     }
 #endif
 
@@ -1537,6 +1537,7 @@ namespace etl
       : pnodepool(&node_pool_)
       , pbuckets(pbuckets_)
       , number_of_buckets(number_of_buckets_)
+      , bucket_mask(((number_of_buckets_ & (number_of_buckets_ - 1U)) == 0U) ? (number_of_buckets_ - 1U) : 0U)
       , first(pbuckets)
       , last(pbuckets)
       , key_hash_function(key_hash_function_)
@@ -1695,6 +1696,15 @@ namespace etl
       return inext;
     }
 
+    //*********************************************************************
+    /// Converts a hash to a bucket index.
+    /// Uses a mask instead of a division when the number of buckets is a power of 2.
+    //*********************************************************************
+    size_t hash_to_bucket_index(size_t hash) const
+    {
+      return (bucket_mask != 0U) ? (hash & bucket_mask) : (hash % number_of_buckets);
+    }
+
     // Disable copy construction.
     iunordered_set(const iunordered_set&);
 
@@ -1707,6 +1717,9 @@ namespace etl
     /// The number of buckets.
     const size_t number_of_buckets;
 
+    /// The mask to convert a hash to a bucket index, if the number of buckets is a power of 2.
+    const size_t bucket_mask;
+
     /// The first and last iterators to buckets with values.
     bucket_t* first;
     bucket_t* last;
@@ -0,0 +1,291 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_WYHASH_INCLUDED
+#define ETL_WYHASH_INCLUDED
+
+#include "platform.h"
+#include "iterator.h"
+#include "static_assert.h"
+#include "type_traits.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_USING_64BIT_TYPES
+
+  #if defined(ETL_COMPILER_MICROSOFT) && defined(_M_X64)
+    #include <intrin.h>
+  #endif
+
+///\defgroup wyhash wyhash hash calculation
+///\ingroup maths
+
+namespace etl
+{
+  namespace private_wyhash
+  {
+    //*************************************************************************
+    /// The default secret.
+    //*************************************************************************
+    struct secret
+    {
+      static ETL_CONSTANT uint64_t s0 = 0x2D358DCCAA6C78A5ULL;
+      static ETL_CONSTANT uint64_t s1 = 0x8BB84B93962EACC9ULL;
+      static ETL_CONSTANT uint64_t s2 = 0x4B33A62ED433D4A3ULL;
+      static ETL_CONSTANT uint64_t s3 = 0x4D5A2DA51DE1AA47ULL;
+    };
+
+    //*************************************************************************
+    /// 64 x 64 => 128 bit multiply, built from 32 bit partial products.
+    /// On return, 'a' holds the low 64 bits and 'b' the high 64 bits.
+    //*************************************************************************
+    inline void multiply_128_portable(uint64_t& a, uint64_t& b)
+    {
+      const uint64_t ha = a >> 32U;
+      const uint64_t hb = b >> 32U;
+      const uint64_t la = static_cast<uint32_t>(a);
+      const uint64_t lb = static_cast<uint32_t>(b);
+
+      const uint64_t rh  = ha * hb;
+      const uint64_t rm0 = ha * lb;
+      const uint64_t rm1 = hb * la;
+      const uint64_t rl  = la * lb;
+
+      const uint64_t t = rl + (rm0 << 32U);
+      uint64_t       c = (t < rl) ? 1U : 0U;
+
+      const uint64_t lo = t + (rm1 << 32U);
+      c += (lo < t) ? 1U : 0U;
+
+      a = lo;
+      b = rh + (rm0 >> 32U) + (rm1 >> 32U) + c;
+    }
+
+    //*************************************************************************
+    /// 64 x 64 => 128 bit multiply, using the widest multiply the compiler offers.
+    /// On return, 'a' holds the low 64 bits and 'b' the high 64 bits.
+    //*************************************************************************
+    inline void multiply_128(uint64_t& a, uint64_t& b)
+    {
+  #if defined(__SIZEOF_INT128__)
+      __extension__ typedef unsigned __int128 uint128_t;
+
+      const uint128_t r = static_cast<uint128_t>(a) * b;
+
+      a = static_cast<uint64_t>(r);
+      b = static_cast<uint64_t>(r >> 64U);
+  #elif defined(ETL_COMPILER_MICROSOFT) && defined(_M_X64)
+      a = _umul128(a, b, &b);
+  #else
+      multiply_128_portable(a, b);
+  #endif
+    }
+
+    //*************************************************************************
+    /// Multiplies and folds the 128 bit result to 64 bits.
+    //*************************************************************************
+    inline uint64_t mix(uint64_t a, uint64_t b)
+    {
+      multiply_128(a, b);
+
+      return a ^ b;
+    }
+
+    //*************************************************************************
+    /// Reads a little endian 64 bit word, independent of the alignment of the
+    /// data and the endianness of the platform.
+    //*************************************************************************
+    inline uint64_t read_64(const uint8_t* p)
+    {
+      return static_cast<uint64_t>(p[0]) | (static_cast<uint64_t>(p[1]) << 8U) | (static_cast<uint64_t>(p[2]) << 16U) | (static_cast<uint64_t>(p[3]) << 24U)
+             | (static_cast<uint64_t>(p[4]) << 32U) | (static_cast<uint64_t>(p[5]) << 40U) | (static_cast<uint64_t>(p[6]) << 48U)
+             | (static_cast<uint64_t>(p[7]) << 56U);
+    }
+
+    //*************************************************************************
+    /// Reads a little endian 32 bit word, independent of the alignment of the
+    /// data and the endianness of the platform.
+    //*************************************************************************
+    inline uint64_t read_32(const uint8_t* p)
+    {
+      return static_cast<uint64_t>(p[0]) | (static_cast<uint64_t>(p[1]) << 8U) | (static_cast<uint64_t>(p[2]) << 16U) | (static_cast<uint64_t>(p[3]) << 24U);
+    }
+
+    //*************************************************************************
+    /// Reads 1 to 3 bytes.
+    //*************************************************************************
+    inline uint64_t read_1_to_3(const uint8_t* p, size_t length)
+    {
+      return (static_cast<uint64_t>(p[0]) << 16U) | (static_cast<uint64_t>(p[length >> 1U]) << 8U) | static_cast<uint64_t>(p[length - 1U]);
+    }
+
+    //*************************************************************************
+    /// Calculates the hash of a contiguous block of memory.
+    //*************************************************************************
+    inline uint64_t calculate(const uint8_t* p, size_t length, uint64_t seed)
+    {
+      typedef secret s;
+
+      seed ^= mix(seed ^ s::s0, s::s1);
+
+      uint64_t a;
+      uint64_t b;
+
+      if (length <= 16U)
+      {
+        if (length >= 4U)
+        {
+          const size_t offset = (length >> 3U) << 2U;
+
+          a = (read_32(p) << 32U) | read_32(p + offset);
+          b = (read_32(p + length - 4U) << 32U) | read_32(p + length - 4U - offset);
+        }
+        else if (length > 0U)
+        {
+          a = read_1_to_3(p, length);
+          b = 0U;
+        }
+        else
+        {
+          a = 0U;
+          b = 0U;
+        }
+      }
+      else
+      {
+        size_t remaining = length;
+
+        if (remaining >= 48U)
+        {
+          uint64_t seed1 = seed;
+          uint64_t seed2 = seed;
+
+          do
+          {
+            seed  = mix(read_64(p) ^ s::s1, read_64(p + 8U) ^ seed);
+            seed1 = mix(read_64(p + 16U) ^ s::s2, read_64(p + 24U) ^ seed1);
+            seed2 = mix(read_64(p + 32U) ^ s::s3, read_64(p + 40U) ^ seed2);
+
+            p += 48U;
+            remaining -= 48U;
+          } while (remaining >= 48U);
+
+          seed ^= seed1 ^ seed2;
+        }
+
+        while (remaining > 16U)
+        {
+          seed = mix(read_64(p) ^ s::s1, read_64(p + 8U) ^ seed);
+
+          p += 16U;
+          remaining -= 16U;
+        }
+
+        // The last 16 bytes, which may overlap those already consumed.
+        a = read_64(p + remaining - 16U);
+        b = read_64(p + remaining - 8U);
+      }
+
+      a ^= s::s1;
+      b ^= seed;
+      multiply_128(a, b);
+
+      return mix(a ^ s::s0 ^ static_cast<uint64_t>(length), b ^ s::s1);
+    }
+  } // namespace private_wyhash
+
+  //***************************************************************************
+  /// Calculates the wyhash (final version 4) hash of a contiguous range.
+  /// Processes 8 bytes per step, with three independent lanes for longer
+  /// inputs, so is much faster than the byte serial hashes for long keys.
+  /// Results are the same for all alignments and endiannesses.
+  /// See https://github.com/wangyi-fudan/wyhash for more details.
+  ///\ingroup wyhash
+  //***************************************************************************
+  class wyhash
+  {
+  public:
+
+    typedef uint64_t value_type;
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// The range must be contiguous.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    /// \param seed  The seed value. Default = 0.
+    //*************************************************************************
+    template <typename TPointer>
+    wyhash(TPointer begin, const TPointer end, value_type seed = 0)
+      : hash(0U)
+    {
+      ETL_STATIC_ASSERT(etl::is_pointer<TPointer>::value, "Range must be contiguous");
+      ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TPointer>::value_type) == 1, "Incompatible type");
+
+      hash = private_wyhash::calculate(reinterpret_cast<const uint8_t*>(begin), static_cast<size_t>(end - begin), seed);
+    }
+
+    //*************************************************************************
+    /// Constructor from a block of memory.
+    /// \param data   Pointer to the data.
+    /// \param length The length of the data, in bytes.
+    /// \param seed   The seed value. Default = 0.
+    //*************************************************************************
+    wyhash(const void* data, size_t length, value_type seed = 0)
+      : hash(private_wyhash::calculate(static_cast<const uint8_t*>(data), length, seed))
+    {
+    }
+
+    //*************************************************************************
+    /// Gets the hash value.
+    //*************************************************************************
+    value_type value() const
+    {
+      return hash;
+    }
+
+    //*************************************************************************
+    /// Conversion operator to value_type.
+    //*************************************************************************
+    operator value_type() const
+    {
+      return hash;
+    }
+
+  private:
+
+    value_type hash;
+  };
+} // namespace etl
+
+#endif
+
+#endif
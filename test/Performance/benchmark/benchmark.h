@@ -0,0 +1,210 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// A minimal timing harness for the ETL benchmarks.
+// Each benchmark runs a batch of operations a number of times (samples).
+// Throughput is taken from the median sample. The latency percentiles are
+// of the mean time per operation within each sample.
+//*****************************************************************************
+
+#ifndef ETL_BENCHMARK_INCLUDED
+#define ETL_BENCHMARK_INCLUDED
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace benchmark
+{
+  //***************************************************************************
+  // The result of one benchmark.
+  //***************************************************************************
+  struct result
+  {
+    std::string group;          // e.g. "vector"
+    std::string name;           // e.g. "push_back"
+    std::string implementation; // e.g. "etl" or "std"
+    size_t      operations;     // Operations per sample.
+    size_t      samples;        // Number of samples.
+    double      ops_per_second; // From the median sample.
+    double      min_ns;         // Per operation.
+    double      p50_ns;         // Per operation.
+    double      p90_ns;         // Per operation.
+    double      p99_ns;         // Per operation.
+  };
+
+  //***************************************************************************
+  // Stops the compiler from optimising away a value.
+  //***************************************************************************
+  template <typename T>
+  inline void do_not_optimise(const T& value)
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T* volatile sink;
+    sink = &value;
+#endif
+  }
+
+  //***************************************************************************
+  // Runs the benchmarks and collects the results.
+  //***************************************************************************
+  class runner
+  {
+  public:
+
+    runner(size_t samples_, const std::string& filter_)
+      : samples(samples_)
+      , filter(filter_)
+    {
+    }
+
+    //*************************************************************************
+    // Should the benchmarks in 'group' be run?
+    //*************************************************************************
+    bool enabled(const char* group) const
+    {
+      return filter.empty() || (std::string(group).find(filter) != std::string::npos);
+    }
+
+    //*************************************************************************
+    // Times 'batch', which must perform 'operations' operations per call.
+    // 'setup' is called, untimed, before each sample.
+    //*************************************************************************
+    template <typename TSetup, typename TBatch>
+    void run(const char* group, const char* name, const char* implementation, size_t operations, TSetup setup, TBatch batch)
+    {
+      if (!enabled(group))
+      {
+        return;
+      }
+
+      std::vector<double> times;
+      times.reserve(samples);
+
+      // Warm up.
+      setup();
+      batch();
+
+      for (size_t i = 0U; i < samples; ++i)
+      {
+        setup();
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        batch();
+        std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+
+        times.push_back(std::chrono::duration<double, std::nano>(stop - start).count() / double(operations));
+      }
+
+      std::sort(times.begin(), times.end());
+
+      result r;
+      r.group          = group;
+      r.name           = name;
+      r.implementation = implementation;
+      r.operations     = operations;
+      r.samples        = samples;
+      r.min_ns         = times.front();
+      r.p50_ns         = percentile(times, 50);
+      r.p90_ns         = percentile(times, 90);
+      r.p99_ns         = percentile(times, 99);
+      r.ops_per_second = (r.p50_ns > 0.0) ? (1.0e9 / r.p50_ns) : 0.0;
+
+      results.push_back(r);
+
+      std::fprintf(stderr, "%-16s %-24s %-28s %10.2f ns/op\n", group, name, implementation, r.p50_ns);
+    }
+
+    //*************************************************************************
+    // Times 'batch' with no per-sample setup.
+    //*************************************************************************
+    template <typename TBatch>
+    void run(const char* group, const char* name, const char* implementation, size_t operations, TBatch batch)
+    {
+      run(group, name, implementation, operations, []() {}, batch);
+    }
+
+    //*************************************************************************
+    // Writes the results as JSON.
+    //*************************************************************************
+    void write_json(FILE* file) const
+    {
+      std::fprintf(file, "{\n  \"samples\": %zu,\n  \"benchmarks\": [\n", samples);
+
+      for (size_t i = 0U; i < results.size(); ++i)
+      {
+        const result& r = results[i];
+
+        std::fprintf(file,
+                     "    {\"group\": \"%s\", \"name\": \"%s\", \"implementation\": \"%s\", \"operations\": %zu, "
+                     "\"ops_per_second\": %.1f, \"min_ns\": %.3f, \"p50_ns\": %.3f, \"p90_ns\": %.3f, \"p99_ns\": %.3f}%s\n",
+                     r.group.c_str(), r.name.c_str(), r.implementation.c_str(), r.operations, r.ops_per_second, r.min_ns, r.p50_ns, r.p90_ns, r.p99_ns,
+                     ((i + 1U) < results.size()) ? "," : "");
+      }
+
+      std::fprintf(file, "  ]\n}\n");
+    }
+
+  private:
+
+    //*************************************************************************
+    // The nearest rank percentile of sorted values.
+    //*************************************************************************
+    static double percentile(const std::vector<double>& sorted, size_t percent)
+    {
+      size_t rank = ((percent * sorted.size()) + 99U) / 100U;
+
+      rank = (rank == 0U) ? 1U : rank;
+
+      return sorted[rank - 1U];
+    }
+
+    size_t              samples;
+    std::string         filter;
+    std::vector<result> results;
+  };
+} // namespace benchmark
+
+//*****************************************************************************
+// The benchmark groups.
+//*****************************************************************************
+void run_container_benchmarks(benchmark::runner& runner);
+void run_queue_benchmarks(benchmark::runner& runner);
+void run_sort_benchmarks(benchmark::runner& runner);
+void run_hash_benchmarks(benchmark::runner& runner);
+void run_messaging_benchmarks(benchmark::runner& runner);
+void run_string_benchmarks(benchmark::runner& runner);
+void run_variant_benchmarks(benchmark::runner& runner);
+
+#endif
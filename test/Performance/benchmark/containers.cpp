@@ -0,0 +1,582 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Benchmarks etl::vector, deque, circular_buffer, bitset and the maps against
+// their std equivalents.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/bitset.h"
+#include "etl/bloom_filter.h"
+#include "etl/btree_map.h"
+#include "etl/circular_buffer.h"
+#include "etl/contiguous_flat_map.h"
+#include "etl/cuckoo_filter.h"
+#include "etl/deque.h"
+#include "etl/flat_map.h"
+#include "etl/map.h"
+#include "etl/span.h"
+#include "etl/unordered_flat_map.h"
+#include "etl/unordered_map.h"
+#include "etl/vector.h"
+
+#include <algorithm>
+#include <bitset>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+  const size_t Size           = 10000U;
+  const size_t Flat_Map_Size  = 2000U;
+  const size_t Large_Map_Size = 100000U;
+  const size_t Buffer_Size    = 256U;
+  const size_t Bits           = 65536U;
+  const size_t Bloom_Keys     = 100000U;
+
+  //***************************************************************************
+  // Unique keys in random order.
+  //***************************************************************************
+  std::vector<uint32_t> make_keys(size_t size)
+  {
+    std::vector<uint32_t> keys(size);
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      keys[i] = uint32_t(i * 2654435761U);
+    }
+
+    std::mt19937 urng(1U);
+    std::shuffle(keys.begin(), keys.end(), urng);
+
+    return keys;
+  }
+
+  //***************************************************************************
+  template <typename TVector>
+  void vector_benchmarks(benchmark::runner& runner, TVector& v, const char* implementation)
+  {
+    runner.run(
+      "vector", "push_back", implementation, Size, [&v]() { v.clear(); },
+      [&v]()
+      {
+        for (size_t i = 0U; i < Size; ++i)
+        {
+          v.push_back(int(i));
+        }
+      });
+
+    runner.run("vector", "iterate", implementation, Size,
+               [&v]()
+               {
+                 int sum = 0;
+
+                 for (typename TVector::const_iterator itr = v.begin(); itr != v.end(); ++itr)
+                 {
+                   sum += *itr;
+                 }
+
+                 benchmark::do_not_optimise(sum);
+               });
+  }
+
+  //***************************************************************************
+  template <typename TDeque>
+  void deque_benchmarks(benchmark::runner& runner, TDeque& d, const char* implementation)
+  {
+    runner.run(
+      "deque", "push_back_pop_front", implementation, Size, [&d]() { d.clear(); },
+      [&d]()
+      {
+        for (size_t i = 0U; i < (Size / 2U); ++i)
+        {
+          d.push_back(int(i));
+          d.push_back(int(i));
+          d.pop_front();
+        }
+
+        benchmark::do_not_optimise(d.front());
+      });
+
+    runner.run("deque", "index", implementation, Size / 2U,
+               [&d]()
+               {
+                 int sum = 0;
+
+                 for (size_t i = 0U; i < d.size(); ++i)
+                 {
+                   sum += d[i];
+                 }
+
+                 benchmark::do_not_optimise(sum);
+               });
+  }
+
+  //***************************************************************************
+  // Insert and find for any of the map types.
+  //***************************************************************************
+  template <typename TMap>
+  void map_benchmarks(benchmark::runner& runner, TMap& m, const std::vector<uint32_t>& keys, const char* group, const char* implementation)
+  {
+    runner.run(
+      group, "insert", implementation, keys.size(), [&m]() { m.clear(); },
+      [&m, &keys]()
+      {
+        for (size_t i = 0U; i < keys.size(); ++i)
+        {
+          m.insert(typename TMap::value_type(keys[i], i));
+        }
+      });
+
+    runner.run(group, "find", implementation, keys.size(),
+               [&m, &keys]()
+               {
+                 size_t found = 0U;
+
+                 for (size_t i = 0U; i < keys.size(); ++i)
+                 {
+                   found += (m.find(keys[i]) != m.end()) ? 1U : 0U;
+                 }
+
+                 benchmark::do_not_optimise(found);
+               });
+
+    runner.run(group, "find_missing", implementation, keys.size(),
+               [&m, &keys]()
+               {
+                 size_t found = 0U;
+
+                 for (size_t i = 0U; i < keys.size(); ++i)
+                 {
+                   found += (m.find(keys[i] + 1U) != m.end()) ? 1U : 0U;
+                 }
+
+                 benchmark::do_not_optimise(found);
+               });
+
+    runner.run(group, "iterate", implementation, keys.size(),
+               [&m]()
+               {
+                 size_t sum = 0U;
+
+                 for (typename TMap::const_iterator itr = m.begin(); itr != m.end(); ++itr)
+                 {
+                   sum += itr->second;
+                 }
+
+                 benchmark::do_not_optimise(sum);
+               });
+
+    runner.run(
+      group, "erase", implementation, keys.size(),
+      [&m, &keys]()
+      {
+        m.clear();
+
+        for (size_t i = 0U; i < keys.size(); ++i)
+        {
+          m.insert(typename TMap::value_type(keys[i], i));
+        }
+      },
+      [&m, &keys]()
+      {
+        for (size_t i = 0U; i < keys.size(); ++i)
+        {
+          m.erase(keys[i]);
+        }
+      });
+  }
+
+  //***************************************************************************
+  // A bounded FIFO that overwrites the oldest item when full.
+  //***************************************************************************
+  void circular_buffer_benchmarks(benchmark::runner& runner)
+  {
+    static etl::circular_buffer<int, Buffer_Size> etl_buffer;
+    static std::deque<int>                        std_buffer;
+
+    runner.run("circular_buffer", "push_overwrite", "etl::circular_buffer", Size,
+               []()
+               {
+                 for (size_t i = 0U; i < Size; ++i)
+                 {
+                   etl_buffer.push(int(i));
+                 }
+
+                 benchmark::do_not_optimise(etl_buffer.front());
+               });
+
+    runner.run("circular_buffer", "push_overwrite", "std::deque", Size,
+               []()
+               {
+                 for (size_t i = 0U; i < Size; ++i)
+                 {
+                   if (std_buffer.size() == Buffer_Size)
+                   {
+                     std_buffer.pop_front();
+                   }
+
+                   std_buffer.push_back(int(i));
+                 }
+
+                 benchmark::do_not_optimise(std_buffer.front());
+               });
+
+    // Samples are streamed through in blocks of 64.
+    static int samples[Size];
+    static int block[64];
+
+    runner.run("circular_buffer", "push_pop_block", "etl::circular_buffer::pop_into", Size,
+               []()
+               {
+                 for (size_t i = 0U; i < Size; i += 64U)
+                 {
+                   etl_buffer.push(etl::span<const int>(samples + i, (Size - i) < 64U ? Size - i : 64U));
+                   etl_buffer.pop_into(etl::span<int>(block));
+                 }
+
+                 benchmark::do_not_optimise(block[0]);
+               });
+
+    runner.run("circular_buffer", "push_pop_block", "etl::circular_buffer::pop", Size,
+               []()
+               {
+                 for (size_t i = 0U; i < Size; i += 64U)
+                 {
+                   const size_t n = (Size - i) < 64U ? Size - i : 64U;
+
+                   etl_buffer.push(samples + i, samples + i + n);
+
+                   for (size_t j = 0U; (j < 64U) && !etl_buffer.empty(); ++j)
+                   {
+                     block[j] = etl_buffer.front();
+                     etl_buffer.pop();
+                   }
+                 }
+
+                 benchmark::do_not_optimise(block[0]);
+               });
+  }
+
+  //***************************************************************************
+  // Whole bitset operations and scans over the set bits.
+  //***************************************************************************
+  void bitset_benchmarks(benchmark::runner& runner)
+  {
+    static etl::bitset<Bits> etl_bitset1;
+    static etl::bitset<Bits> etl_bitset2;
+    static std::bitset<Bits> std_bitset1;
+    static std::bitset<Bits> std_bitset2;
+
+    // Sparse, so that the scans skip most of the elements.
+    std::mt19937 generator(1U);
+
+    for (size_t i = 0U; i < (Bits / 64U); ++i)
+    {
+      const size_t position = generator() % Bits;
+
+      etl_bitset1.set(position);
+      std_bitset1.set(position);
+      etl_bitset2.set(Bits - 1U - position);
+      std_bitset2.set(Bits - 1U - position);
+    }
+
+    runner.run("bitset", "count", "etl::bitset", 1U, []() { benchmark::do_not_optimise(etl_bitset1.count()); });
+
+    runner.run("bitset", "count", "std::bitset", 1U, []() { benchmark::do_not_optimise(std_bitset1.count()); });
+
+    runner.run("bitset", "and", "etl::bitset", 1U,
+               []()
+               {
+                 etl_bitset2 &= etl_bitset1;
+                 etl_bitset2 |= etl_bitset1;
+                 benchmark::do_not_optimise(etl_bitset2.test(0U));
+               });
+
+    runner.run("bitset", "and", "std::bitset", 1U,
+               []()
+               {
+                 std_bitset2 &= std_bitset1;
+                 std_bitset2 |= std_bitset1;
+                 benchmark::do_not_optimise(std_bitset2.test(0U));
+               });
+
+    runner.run("bitset", "find_next", "etl::bitset", 1U,
+               []()
+               {
+                 size_t total = 0U;
+
+                 for (size_t i = etl_bitset1.find_first(true); i != etl_bitset1.npos; i = etl_bitset1.find_next(true, i + 1U))
+                 {
+                   total += i;
+                 }
+
+                 benchmark::do_not_optimise(total);
+               });
+
+    runner.run("bitset", "find_next", "etl::bitset::for_each_set_bit", 1U,
+               []()
+               {
+                 size_t total = 0U;
+
+                 etl_bitset1.for_each_set_bit([&total](size_t i) { total += i; });
+
+                 benchmark::do_not_optimise(total);
+               });
+
+    runner.run("bitset", "find_next", "std::bitset", 1U,
+               []()
+               {
+                 size_t total = 0U;
+
+                 for (size_t i = 0U; i < Bits; ++i)
+                 {
+                   if (std_bitset1.test(i))
+                   {
+                     total += i;
+                   }
+                 }
+
+                 benchmark::do_not_optimise(total);
+               });
+  }
+
+  //***************************************************************************
+  // Multiplicative hashes for the bloom filters.
+  //***************************************************************************
+  template <uint64_t Multiplier>
+  struct bloom_hash
+  {
+    typedef uint32_t argument_type;
+
+    size_t operator()(uint32_t key) const
+    {
+      return size_t((uint64_t(key) * Multiplier) >> 24U);
+    }
+  };
+
+  typedef bloom_hash<0x9E3779B97F4A7C15ULL> bloom_hash1;
+  typedef bloom_hash<0xC2B2AE3D27D4EB4FULL> bloom_hash2;
+  typedef bloom_hash<0x165667B19E3779F9ULL> bloom_hash3;
+
+  //***************************************************************************
+  // A pre-filter for a 100000 entry table. Half of the lookups are present.
+  //***************************************************************************
+  template <size_t Width>
+  void bloom_filter_benchmarks(benchmark::runner& runner, const char* test, const std::vector<uint32_t>& lookups)
+  {
+    static etl::bloom_filter<Width, bloom_hash1, bloom_hash2, bloom_hash3> bloom;
+    static etl::blocked_bloom_filter<Width, 3, bloom_hash1>                blocked3;
+    static etl::blocked_bloom_filter<Width, 7, bloom_hash1>                blocked7;
+    static bool                                                            results[Bloom_Keys * 2U];
+
+    for (size_t i = 0U; i < lookups.size(); i += 2U)
+    {
+      bloom.add(lookups[i]);
+      blocked3.add(lookups[i]);
+      blocked7.add(lookups[i]);
+    }
+
+    runner.run("bloom_filter", test, "etl::bloom_filter<3 hashes>", lookups.size(),
+               [&lookups]()
+               {
+                 size_t found = 0U;
+
+                 for (size_t i = 0U; i < lookups.size(); ++i)
+                 {
+                   found += bloom.exists(lookups[i]) ? 1U : 0U;
+                 }
+
+                 benchmark::do_not_optimise(found);
+               });
+
+    runner.run("bloom_filter", test, "etl::blocked_bloom_filter<K=3>", lookups.size(),
+               [&lookups]()
+               {
+                 size_t found = 0U;
+
+                 for (size_t i = 0U; i < lookups.size(); ++i)
+                 {
+                   found += blocked3.exists(lookups[i]) ? 1U : 0U;
+                 }
+
+                 benchmark::do_not_optimise(found);
+               });
+
+    runner.run("bloom_filter", test, "etl::blocked_bloom_filter<K=7>", lookups.size(),
+               [&lookups]()
+               {
+                 size_t found = 0U;
+
+                 for (size_t i = 0U; i < lookups.size(); ++i)
+                 {
+                   found += blocked7.exists(lookups[i]) ? 1U : 0U;
+                 }
+
+                 benchmark::do_not_optimise(found);
+               });
+
+    runner.run("bloom_filter", test, "etl::blocked_bloom_filter<K=7> batched", lookups.size(),
+               [&lookups]()
+               { benchmark::do_not_optimise(blocked7.exists(etl::span<const uint32_t>(lookups.data(), lookups.size()), etl::span<bool>(results))); });
+  }
+
+  //***************************************************************************
+  // A filter for a 100000 entry table whose keys churn. The bloom filter has
+  // to be rebuilt from the live keys, the cuckoo filter removes the old key.
+  //***************************************************************************
+  void cuckoo_filter_benchmarks(benchmark::runner& runner, const std::vector<uint32_t>& lookups)
+  {
+    static etl::cuckoo_filter<uint32_t, Bloom_Keys>                                   cuckoo;
+    static etl::bloom_filter<Bloom_Keys * 10U, bloom_hash1, bloom_hash2, bloom_hash3> bloom;
+
+    for (size_t i = 0U; i < lookups.size(); i += 2U)
+    {
+      cuckoo.add(lookups[i]);
+    }
+
+    runner.run("cuckoo_filter", "exists", "etl::cuckoo_filter", lookups.size(),
+               [&lookups]()
+               {
+                 size_t found = 0U;
+
+                 for (size_t i = 0U; i < lookups.size(); ++i)
+                 {
+                   found += cuckoo.exists(lookups[i]) ? 1U : 0U;
+                 }
+
+                 benchmark::do_not_optimise(found);
+               });
+
+    // Replaces every live key with one that is not, one at a time.
+    runner.run("cuckoo_filter", "replace_key", "etl::cuckoo_filter", Bloom_Keys,
+               [&lookups]()
+               {
+                 static size_t live = 0U;
+
+                 for (size_t i = 0U; i < lookups.size(); i += 2U)
+                 {
+                   cuckoo.remove(lookups[i + live]);
+                   cuckoo.add(lookups[i + 1U - live]);
+                 }
+
+                 live = 1U - live;
+                 benchmark::do_not_optimise(cuckoo.count());
+               });
+
+    // The whole rebuild, which has to be repeated for each batch of changes.
+    runner.run("cuckoo_filter", "rebuild", "etl::bloom_filter", 1U,
+               [&lookups]()
+               {
+                 static size_t live = 0U;
+
+                 bloom.clear();
+
+                 for (size_t i = live; i < lookups.size(); i += 2U)
+                 {
+                   bloom.add(lookups[i]);
+                 }
+
+                 live = 1U - live;
+                 benchmark::do_not_optimise(bloom.count());
+               });
+  }
+} // namespace
+
+//*****************************************************************************
+void run_container_benchmarks(benchmark::runner& runner)
+{
+  static etl::vector<int, Size> etl_vector;
+  std::vector<int>              std_vector;
+  std_vector.reserve(Size);
+
+  vector_benchmarks(runner, etl_vector, "etl::vector");
+  vector_benchmarks(runner, std_vector, "std::vector");
+
+  static etl::deque<int, Size> etl_deque;
+  std::deque<int>              std_deque;
+
+  deque_benchmarks(runner, etl_deque, "etl::deque");
+  deque_benchmarks(runner, std_deque, "std::deque");
+
+  const std::vector<uint32_t> keys          = make_keys(Size);
+  const std::vector<uint32_t> flat_map_keys  = make_keys(Flat_Map_Size);
+
+  static etl::map<uint32_t, size_t, Size>       etl_map;
+  static etl::btree_map<uint32_t, size_t, Size> etl_btree_map;
+  std::map<uint32_t, size_t>                    std_map;
+
+  map_benchmarks(runner, etl_map, keys, "map", "etl::map");
+  map_benchmarks(runner, etl_btree_map, keys, "map", "etl::btree_map");
+  map_benchmarks(runner, std_map, keys, "map", "std::map");
+
+  // Larger than the L2 cache.
+  const std::vector<uint32_t> large_map_keys = make_keys(Large_Map_Size);
+
+  static etl::map<uint32_t, size_t, Large_Map_Size>       etl_large_map;
+  static etl::btree_map<uint32_t, size_t, Large_Map_Size> etl_large_btree_map;
+  std::map<uint32_t, size_t>                              std_large_map;
+
+  map_benchmarks(runner, etl_large_map, large_map_keys, "map_100k", "etl::map");
+  map_benchmarks(runner, etl_large_btree_map, large_map_keys, "map_100k", "etl::btree_map");
+  map_benchmarks(runner, std_large_map, large_map_keys, "map_100k", "std::map");
+
+  static etl::flat_map<uint32_t, size_t, Flat_Map_Size>            etl_flat_map;
+  static etl::contiguous_flat_map<uint32_t, size_t, Flat_Map_Size> etl_contiguous_flat_map;
+  std::map<uint32_t, size_t>                                       std_flat_map;
+
+  map_benchmarks(runner, etl_flat_map, flat_map_keys, "flat_map", "etl::flat_map");
+  map_benchmarks(runner, etl_contiguous_flat_map, flat_map_keys, "flat_map", "etl::contiguous_flat_map");
+  map_benchmarks(runner, std_flat_map, flat_map_keys, "flat_map", "std::map");
+
+  static etl::unordered_map<uint32_t, size_t, Size>      etl_unordered_map;
+  static etl::unordered_flat_map<uint32_t, size_t, Size> etl_unordered_flat_map;
+  std::unordered_map<uint32_t, size_t>                   std_unordered_map;
+  std_unordered_map.reserve(Size);
+
+  map_benchmarks(runner, etl_unordered_map, keys, "unordered_map", "etl::unordered_map");
+  map_benchmarks(runner, etl_unordered_flat_map, keys, "unordered_map", "etl::unordered_flat_map");
+  map_benchmarks(runner, std_unordered_map, keys, "unordered_map", "std::unordered_map");
+
+  circular_buffer_benchmarks(runner);
+  bitset_benchmarks(runner);
+
+  // 10 bits per key, which fits in the L2 cache, and 640 bits per key, which
+  // does not.
+  const std::vector<uint32_t> bloom_lookups = make_keys(Bloom_Keys * 2U);
+
+  bloom_filter_benchmarks<Bloom_Keys * 10U>(runner, "exists_1Mbit", bloom_lookups);
+  bloom_filter_benchmarks<Bloom_Keys * 640U>(runner, "exists_64Mbit", bloom_lookups);
+  cuckoo_filter_benchmarks(runner, bloom_lookups);
+}
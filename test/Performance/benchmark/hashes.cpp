@@ -0,0 +1,140 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Benchmarks the ETL hashes and CRCs against std::hash.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/crc32.h"
+#include "etl/crc32_c.h"
+#include "etl/fnv_1.h"
+#include "etl/hash.h"
+#include "etl/murmur3.h"
+#include "etl/string_view.h"
+
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+  const size_t Keys = 10000U;
+
+  //***************************************************************************
+  // Times 'checksum' over a buffer of 'size' bytes.
+  // The operation count is the number of bytes, so ops/s is bytes/s.
+  //***************************************************************************
+  template <typename TChecksum>
+  void bytes_benchmark(benchmark::runner& runner, const char* group, const char* name, const char* implementation, const std::vector<uint8_t>& data, TChecksum checksum)
+  {
+    runner.run(group, name, implementation, data.size(), [&data, checksum]() { benchmark::do_not_optimise(checksum(data.data(), data.data() + data.size())); });
+  }
+
+  //***************************************************************************
+  void buffer_benchmarks(benchmark::runner& runner, const char* name, const std::vector<uint8_t>& data)
+  {
+    // Hashes.
+    bytes_benchmark(runner, "hash", name, "etl::hash<etl::string_view>", data,
+                    [](const uint8_t* b, const uint8_t* e) { return etl::hash<etl::string_view>()(etl::string_view(reinterpret_cast<const char*>(b), size_t(e - b))); });
+
+    bytes_benchmark(runner, "hash", name, "etl::murmur3<uint32_t>", data, [](const uint8_t* b, const uint8_t* e) { return etl::murmur3<uint32_t>(b, e).value(); });
+
+    bytes_benchmark(runner, "hash", name, "etl::fnv_1a_32", data, [](const uint8_t* b, const uint8_t* e) { return etl::fnv_1a_32(b, e).value(); });
+
+    bytes_benchmark(runner, "hash", name, "etl::fnv_1a_64", data, [](const uint8_t* b, const uint8_t* e) { return etl::fnv_1a_64(b, e).value(); });
+
+    bytes_benchmark(runner, "hash", name, "std::hash<std::string_view>", data,
+                    [](const uint8_t* b, const uint8_t* e) { return std::hash<std::string_view>()(std::string_view(reinterpret_cast<const char*>(b), size_t(e - b))); });
+
+    // CRCs. There is no std CRC, so the table sizes are compared with each other.
+    bytes_benchmark(runner, "crc", name, "etl::crc32_t16", data, [](const uint8_t* b, const uint8_t* e) { return etl::crc32_t16(b, e).value(); });
+
+    bytes_benchmark(runner, "crc", name, "etl::crc32_t256", data, [](const uint8_t* b, const uint8_t* e) { return etl::crc32_t256(b, e).value(); });
+
+    bytes_benchmark(runner, "crc", name, "etl::crc32_t2048", data, [](const uint8_t* b, const uint8_t* e) { return etl::crc32_t2048(b, e).value(); });
+
+    bytes_benchmark(runner, "crc", name, "etl::crc32_t4096", data, [](const uint8_t* b, const uint8_t* e) { return etl::crc32_t4096(b, e).value(); });
+
+    bytes_benchmark(runner, "crc", name, "etl::crc32_c_t4096", data, [](const uint8_t* b, const uint8_t* e) { return etl::crc32_c_t4096(b, e).value(); });
+  }
+} // namespace
+
+//*****************************************************************************
+void run_hash_benchmarks(benchmark::runner& runner)
+{
+  std::vector<uint8_t> data(65536U);
+
+  for (size_t i = 0U; i < data.size(); ++i)
+  {
+    data[i] = uint8_t((i * 131U) ^ (i >> 8));
+  }
+
+  const std::vector<uint8_t> small_data(data.begin(), data.begin() + 16);
+  const std::vector<uint8_t> medium_data(data.begin(), data.begin() + 256);
+
+  buffer_benchmarks(runner, "16_bytes", small_data);
+  buffer_benchmarks(runner, "256_bytes", medium_data);
+  buffer_benchmarks(runner, "64k_bytes", data);
+
+  // Integral keys, as used by the unordered containers.
+  std::vector<uint32_t> keys(Keys);
+
+  for (size_t i = 0U; i < Keys; ++i)
+  {
+    keys[i] = uint32_t(data[i * 4U]) | (uint32_t(data[(i * 4U) + 1U]) << 8) | (uint32_t(i) << 16);
+  }
+
+  runner.run("hash", "uint32_t", "etl::hash<uint32_t>", Keys,
+             [&keys]()
+             {
+               size_t sum = 0U;
+
+               for (size_t i = 0U; i < keys.size(); ++i)
+               {
+                 sum += etl::hash<uint32_t>()(keys[i]);
+               }
+
+               benchmark::do_not_optimise(sum);
+             });
+
+  runner.run("hash", "uint32_t", "std::hash<uint32_t>", Keys,
+             [&keys]()
+             {
+               size_t sum = 0U;
+
+               for (size_t i = 0U; i < keys.size(); ++i)
+               {
+                 sum += std::hash<uint32_t>()(keys[i]);
+               }
+
+               benchmark::do_not_optimise(sum);
+             });
+}
@@ -0,0 +1,107 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Benchmarks for the ETL containers, queues, hashes, CRCs, sorts and string
+// formatting, each compared with its std equivalent.
+// Build with the CMakeLists.txt in this directory.
+//
+// Usage: etl_benchmark [--output <file.json>] [--filter <group>] [--samples <n>]
+//
+// The results are written as JSON to the output file, or stdout, so that runs
+// from different commits may be diffed. Progress is written to stderr.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+//*****************************************************************************
+int main(int argc, char* argv[])
+{
+  const char* output  = nullptr;
+  std::string filter;
+  size_t      samples = 50U;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    if ((std::strcmp(argv[i], "--output") == 0) && ((i + 1) < argc))
+    {
+      output = argv[++i];
+    }
+    else if ((std::strcmp(argv[i], "--filter") == 0) && ((i + 1) < argc))
+    {
+      filter = argv[++i];
+    }
+    else if ((std::strcmp(argv[i], "--samples") == 0) && ((i + 1) < argc))
+    {
+      samples = size_t(std::strtoul(argv[++i], nullptr, 10));
+      samples = (samples == 0U) ? 1U : samples;
+    }
+    else
+    {
+      std::fprintf(stderr, "Usage: %s [--output <file.json>] [--filter <group>] [--samples <n>]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  benchmark::runner runner(samples, filter);
+
+  run_container_benchmarks(runner);
+  run_queue_benchmarks(runner);
+  run_sort_benchmarks(runner);
+  run_hash_benchmarks(runner);
+  run_messaging_benchmarks(runner);
+  run_string_benchmarks(runner);
+  run_variant_benchmarks(runner);
+
+  FILE* file = stdout;
+
+  if (output != nullptr)
+  {
+    file = std::fopen(output, "w");
+
+    if (file == nullptr)
+    {
+      std::fprintf(stderr, "Cannot open %s\n", output);
+      return 1;
+    }
+  }
+
+  runner.write_json(file);
+
+  if (file != stdout)
+  {
+    std::fclose(file);
+  }
+
+  return 0;
+}
@@ -0,0 +1,148 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Benchmarks etl::message_bus broadcasts, with and without a routing index.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/message.h"
+#include "etl/message_bus.h"
+#include "etl/message_router.h"
+
+#include <deque>
+
+namespace
+{
+  const size_t Routers  = 40U;
+  const size_t Messages = 200U;
+
+  //***************************************************************************
+  // A message with an id set at run time.
+  //***************************************************************************
+  class any_message : public etl::imessage
+  {
+  public:
+
+    explicit any_message(etl::message_id_t id_)
+      : id(id_)
+    {
+    }
+
+    etl::message_id_t get_message_id() const ETL_NOEXCEPT ETL_OVERRIDE
+    {
+      return id;
+    }
+
+  private:
+
+    etl::message_id_t id;
+  };
+
+  //***************************************************************************
+  // A router that accepts every tenth message id, starting from its own.
+  //***************************************************************************
+  class subscriber : public etl::imessage_router
+  {
+  public:
+
+    explicit subscriber(etl::message_router_id_t id_)
+      : imessage_router(id_)
+      , count(0U)
+    {
+    }
+
+    using etl::imessage_router::receive;
+
+    void receive(const etl::imessage&) ETL_OVERRIDE
+    {
+      ++count;
+    }
+
+    bool accepts(etl::message_id_t id) const ETL_OVERRIDE
+    {
+      return (id % 10U) == (get_message_router_id() % 10U);
+    }
+
+    bool is_null_router() const ETL_OVERRIDE
+    {
+      return false;
+    }
+
+    bool is_producer() const ETL_OVERRIDE
+    {
+      return false;
+    }
+
+    bool is_consumer() const ETL_OVERRIDE
+    {
+      return true;
+    }
+
+    size_t count;
+  };
+
+  //***************************************************************************
+  template <typename TBus>
+  void broadcast_benchmark(benchmark::runner& runner, const char* implementation, TBus& bus)
+  {
+    static std::deque<subscriber> subscribers;
+
+    subscribers.clear();
+
+    for (size_t i = 0U; i < Routers; ++i)
+    {
+      subscribers.emplace_back(etl::message_router_id_t(i));
+      bus.subscribe(subscribers.back());
+    }
+
+    runner.run("message_bus", "broadcast_40_routers", implementation, Messages,
+               [&bus]()
+               {
+                 for (size_t i = 0U; i < Messages; ++i)
+                 {
+                   bus.receive(any_message(etl::message_id_t(i)));
+                 }
+
+                 benchmark::do_not_optimise(subscribers[0].count);
+               });
+
+    bus.clear();
+  }
+} // namespace
+
+//*****************************************************************************
+void run_messaging_benchmarks(benchmark::runner& runner)
+{
+  static etl::message_bus<Routers>           bus;
+  static etl::message_bus<Routers, Messages> indexed_bus;
+
+  broadcast_benchmark(runner, "etl::message_bus", bus);
+  broadcast_benchmark(runner, "etl::message_bus_indexed", indexed_bus);
+}
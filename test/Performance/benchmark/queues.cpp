@@ -0,0 +1,218 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Benchmarks etl::queue and the SPSC and MPMC queues against std::queue
+// with a mutex.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/queue.h"
+#include "etl/queue_mpmc_atomic.h"
+#include "etl/queue_mpmc_mutex.h"
+#include "etl/queue_spsc_atomic.h"
+#include "etl/queue_spsc_atomic_padded.h"
+
+#include <atomic>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  const size_t Size      = 1024U;
+  const size_t Transfers = 200000U;
+
+  //***************************************************************************
+  // A std::queue guarded by a std::mutex, with the same interface as the ETL
+  // concurrent queues.
+  //***************************************************************************
+  class std_locked_queue
+  {
+  public:
+
+    bool push(int value)
+    {
+      std::lock_guard<std::mutex> lock(access);
+
+      if (queue.size() == Size)
+      {
+        return false;
+      }
+
+      queue.push(value);
+
+      return true;
+    }
+
+    bool pop(int& value)
+    {
+      std::lock_guard<std::mutex> lock(access);
+
+      if (queue.empty())
+      {
+        return false;
+      }
+
+      value = queue.front();
+      queue.pop();
+
+      return true;
+    }
+
+  private:
+
+    std::mutex      access;
+    std::queue<int> queue;
+  };
+
+  //***************************************************************************
+  // Moves 'Transfers' items through the queue from 'producers' threads to
+  // 'consumers' threads.
+  //***************************************************************************
+  template <typename TQueue>
+  void transfer(TQueue& queue, size_t producers, size_t consumers)
+  {
+    std::vector<std::thread> threads;
+    std::atomic<size_t>      popped(0U);
+
+    for (size_t p = 0U; p < producers; ++p)
+    {
+      threads.push_back(std::thread(
+        [&queue, producers]()
+        {
+          for (size_t i = 0U; i < (Transfers / producers); ++i)
+          {
+            while (!queue.push(int(i)))
+            {
+              std::this_thread::yield();
+            }
+          }
+        }));
+    }
+
+    for (size_t c = 0U; c < consumers; ++c)
+    {
+      threads.push_back(std::thread(
+        [&queue, &popped, producers]()
+        {
+          const size_t total = (Transfers / producers) * producers;
+
+          int value;
+
+          while (popped.load(std::memory_order_relaxed) < total)
+          {
+            if (queue.pop(value))
+            {
+              popped.fetch_add(1U, std::memory_order_relaxed);
+            }
+            else
+            {
+              std::this_thread::yield();
+            }
+          }
+        }));
+    }
+
+    for (size_t t = 0U; t < threads.size(); ++t)
+    {
+      threads[t].join();
+    }
+  }
+
+  //***************************************************************************
+  template <typename TQueue>
+  void spsc_benchmark(benchmark::runner& runner, TQueue& queue, const char* implementation)
+  {
+    runner.run("queue_concurrent", "spsc_transfer", implementation, Transfers, [&queue]() { transfer(queue, 1U, 1U); });
+  }
+
+  //***************************************************************************
+  template <typename TQueue>
+  void mpmc_benchmark(benchmark::runner& runner, TQueue& queue, const char* implementation)
+  {
+    runner.run("queue_concurrent", "mpmc_2x2_transfer", implementation, Transfers, [&queue]() { transfer(queue, 2U, 2U); });
+  }
+} // namespace
+
+//*****************************************************************************
+void run_queue_benchmarks(benchmark::runner& runner)
+{
+  // Single threaded.
+  static etl::queue<int, Size> etl_queue;
+  std::queue<int>              std_queue;
+
+  runner.run("queue", "push_pop", "etl::queue", Size,
+             []()
+             {
+               for (size_t i = 0U; i < Size; ++i)
+               {
+                 etl_queue.push(int(i));
+               }
+
+               while (!etl_queue.empty())
+               {
+                 benchmark::do_not_optimise(etl_queue.front());
+                 etl_queue.pop();
+               }
+             });
+
+  runner.run("queue", "push_pop", "std::queue", Size,
+             [&std_queue]()
+             {
+               for (size_t i = 0U; i < Size; ++i)
+               {
+                 std_queue.push(int(i));
+               }
+
+               while (!std_queue.empty())
+               {
+                 benchmark::do_not_optimise(std_queue.front());
+                 std_queue.pop();
+               }
+             });
+
+  // Concurrent.
+  static etl::queue_spsc_atomic<int, Size>        spsc_atomic;
+  static etl::queue_spsc_atomic_padded<int, Size> spsc_atomic_padded;
+  static etl::queue_mpmc_atomic<int, Size>        mpmc_atomic;
+  static etl::queue_mpmc_mutex<int, Size>         mpmc_mutex;
+  static std_locked_queue                         std_locked;
+
+  spsc_benchmark(runner, spsc_atomic, "etl::queue_spsc_atomic");
+  spsc_benchmark(runner, spsc_atomic_padded, "etl::queue_spsc_atomic_padded");
+  spsc_benchmark(runner, mpmc_atomic, "etl::queue_mpmc_atomic");
+  spsc_benchmark(runner, mpmc_mutex, "etl::queue_mpmc_mutex");
+  spsc_benchmark(runner, std_locked, "std::queue+std::mutex");
+
+  mpmc_benchmark(runner, mpmc_atomic, "etl::queue_mpmc_atomic");
+  mpmc_benchmark(runner, mpmc_mutex, "etl::queue_mpmc_mutex");
+  mpmc_benchmark(runner, std_locked, "std::queue+std::mutex");
+}
@@ -0,0 +1,142 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Benchmarks etl::radix_sort against etl::sort, etl::intro_sort and std::sort.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/algorithm.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+  const size_t Sizes[] = {1000U, 10000U, 100000U};
+
+  typedef std::pair<uint32_t, uint32_t> KeyIndex;
+
+  //***************************************************************************
+  struct KeyLess
+  {
+    bool operator()(const KeyIndex& lhs, const KeyIndex& rhs) const
+    {
+      return lhs.first < rhs.first;
+    }
+  };
+
+  //***************************************************************************
+  // Times 'sort' on a fresh copy of 'data' for each sample.
+  // The operation count is the number of elements.
+  //***************************************************************************
+  template <typename T, typename TSort>
+  void sort_benchmark(benchmark::runner& runner, const char* group, const std::string& name, const char* implementation, const std::vector<T>& data, TSort sort)
+  {
+    std::vector<T> work;
+
+    runner.run(group, name.c_str(), implementation, data.size(), [&work, &data]() { work = data; }, [&work, sort]() { sort(work); });
+  }
+
+  //***************************************************************************
+  // uint32_t timestamps.
+  //***************************************************************************
+  void timestamp_benchmarks(benchmark::runner& runner, std::mt19937& urng, size_t size)
+  {
+    std::vector<uint32_t> data(size);
+    std::vector<uint32_t> buffer(size);
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      data[i] = static_cast<uint32_t>(urng());
+    }
+
+    const std::string name = "uint32_t_" + std::to_string(size);
+
+    sort_benchmark(runner, "sort", name, "etl::radix_sort", data,
+                   [&buffer](std::vector<uint32_t>& v) { etl::radix_sort(v.begin(), v.end(), buffer.begin(), buffer.end()); });
+
+    sort_benchmark(runner, "sort", name, "etl::sort", data, [](std::vector<uint32_t>& v) { etl::sort(v.begin(), v.end()); });
+
+    sort_benchmark(runner, "sort", name, "etl::intro_sort", data, [](std::vector<uint32_t>& v) { etl::intro_sort(v.begin(), v.end()); });
+
+    sort_benchmark(runner, "sort", name, "std::sort", data, [](std::vector<uint32_t>& v) { std::sort(v.begin(), v.end()); });
+  }
+
+  //***************************************************************************
+  // (key, index) pairs, sorted by key.
+  //***************************************************************************
+  void key_index_benchmarks(benchmark::runner& runner, std::mt19937& urng, size_t size)
+  {
+    std::vector<KeyIndex> data(size);
+    std::vector<KeyIndex> buffer(size);
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      data[i] = KeyIndex(static_cast<uint32_t>(urng()), static_cast<uint32_t>(i));
+    }
+
+    const std::string name = "key_index_" + std::to_string(size);
+
+    sort_benchmark(runner, "sort", name, "etl::radix_sort", data,
+                   [&buffer](std::vector<KeyIndex>& v)
+                   { etl::radix_sort(v.begin(), v.end(), buffer.begin(), buffer.end(), [](const KeyIndex& ki) { return ki.first; }); });
+
+    sort_benchmark(runner, "sort", name, "etl::sort", data, [](std::vector<KeyIndex>& v) { etl::sort(v.begin(), v.end(), KeyLess()); });
+
+    sort_benchmark(runner, "sort", name, "etl::intro_sort", data, [](std::vector<KeyIndex>& v) { etl::intro_sort(v.begin(), v.end(), KeyLess()); });
+
+    sort_benchmark(runner, "sort", name, "std::sort", data, [](std::vector<KeyIndex>& v) { std::sort(v.begin(), v.end(), KeyLess()); });
+  }
+} // namespace
+
+//*****************************************************************************
+void run_sort_benchmarks(benchmark::runner& runner)
+{
+  if (!runner.enabled("sort"))
+  {
+    return;
+  }
+
+  std::mt19937 urng(1U);
+
+  for (size_t size : Sizes)
+  {
+    timestamp_benchmarks(runner, urng, size);
+  }
+
+  for (size_t size : Sizes)
+  {
+    key_index_benchmarks(runner, urng, size);
+  }
+}
@@ -0,0 +1,356 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Benchmarks etl::string, string_view, to_string, to_arithmetic and format
+// against std::string, std::string_view, snprintf and strtod.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/base64_decoder.h"
+#include "etl/base64_encoder.h"
+#include "etl/format.h"
+#include "etl/string.h"
+#include "etl/string_view.h"
+#include "etl/to_arithmetic.h"
+#include "etl/to_string.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+  const size_t Values = 1000U;
+
+  //***************************************************************************
+  // Integers with a spread of digit counts and signs.
+  //***************************************************************************
+  std::vector<int32_t> make_integers()
+  {
+    std::vector<int32_t> values(Values);
+
+    uint32_t x = 1U;
+
+    for (size_t i = 0U; i < Values; ++i)
+    {
+      x         = (x * 1664525U) + 1013904223U;
+      values[i] = int32_t(x >> (i % 31U)) * (((i % 2U) == 0U) ? 1 : -1);
+    }
+
+    return values;
+  }
+
+  //***************************************************************************
+  std::vector<double> make_doubles()
+  {
+    std::vector<double> values(Values);
+
+    for (size_t i = 0U; i < Values; ++i)
+    {
+      values[i] = (double(i) * 1.618033988749) - 250.0;
+    }
+
+    return values;
+  }
+
+  //***************************************************************************
+  // The values as text, in a printf format.
+  //***************************************************************************
+  template <typename T>
+  std::vector<std::string> make_texts(const std::vector<T>& values, const char* format)
+  {
+    std::vector<std::string> texts(values.size());
+
+    for (size_t i = 0U; i < values.size(); ++i)
+    {
+      char text[64];
+      std::snprintf(text, sizeof(text), format, values[i]);
+      texts[i] = text;
+    }
+
+    return texts;
+  }
+} // namespace
+
+//*****************************************************************************
+void run_string_benchmarks(benchmark::runner& runner)
+{
+  const std::vector<int32_t> integers = make_integers();
+  const std::vector<double>  doubles  = make_doubles();
+
+  // to_string
+  runner.run("to_string", "int32_t", "etl::to_string", Values,
+             [&integers]()
+             {
+               etl::string<32> text;
+
+               for (size_t i = 0U; i < integers.size(); ++i)
+               {
+                 etl::to_string(integers[i], text);
+                 benchmark::do_not_optimise(text[0]);
+               }
+             });
+
+  runner.run("to_string", "int32_t", "std::to_string", Values,
+             [&integers]()
+             {
+               for (size_t i = 0U; i < integers.size(); ++i)
+               {
+                 std::string text = std::to_string(integers[i]);
+                 benchmark::do_not_optimise(text[0]);
+               }
+             });
+
+  runner.run("to_string", "uint32_t_hex", "etl::to_string", Values,
+             [&integers]()
+             {
+               etl::string<32> text;
+               etl::format_spec format;
+               format.hex().upper_case(true);
+
+               for (size_t i = 0U; i < integers.size(); ++i)
+               {
+                 etl::to_string(uint32_t(integers[i]), text, format);
+                 benchmark::do_not_optimise(text[0]);
+               }
+             });
+
+  runner.run("to_string", "uint32_t_hex", "std::snprintf", Values,
+             [&integers]()
+             {
+               char text[32];
+
+               for (size_t i = 0U; i < integers.size(); ++i)
+               {
+                 std::snprintf(text, sizeof(text), "%X", unsigned(integers[i]));
+                 benchmark::do_not_optimise(text[0]);
+               }
+             });
+
+  runner.run("to_string", "double", "etl::to_string", Values,
+             [&doubles]()
+             {
+               etl::string<32> text;
+               etl::format_spec format;
+               format.precision(6); // As std::to_string.
+
+               for (size_t i = 0U; i < doubles.size(); ++i)
+               {
+                 etl::to_string(doubles[i], text, format);
+                 benchmark::do_not_optimise(text[0]);
+               }
+             });
+
+  runner.run("to_string", "double", "std::to_string", Values,
+             [&doubles]()
+             {
+               for (size_t i = 0U; i < doubles.size(); ++i)
+               {
+                 std::string text = std::to_string(doubles[i]);
+                 benchmark::do_not_optimise(text[0]);
+               }
+             });
+
+  // to_arithmetic
+  const std::vector<std::string> integer_texts = make_texts(integers, "%d");
+  const std::vector<std::string> double_texts  = make_texts(doubles, "%.17g");
+
+  runner.run("to_arithmetic", "int32_t", "etl::to_arithmetic", Values,
+             [&integer_texts]()
+             {
+               for (size_t i = 0U; i < integer_texts.size(); ++i)
+               {
+                 const std::string& text = integer_texts[i];
+                 benchmark::do_not_optimise(etl::to_arithmetic<int32_t>(text.data(), text.size()).value());
+               }
+             });
+
+  runner.run("to_arithmetic", "int32_t", "std::strtol", Values,
+             [&integer_texts]()
+             {
+               for (size_t i = 0U; i < integer_texts.size(); ++i)
+               {
+                 benchmark::do_not_optimise(std::strtol(integer_texts[i].c_str(), nullptr, 10));
+               }
+             });
+
+  runner.run("to_arithmetic", "double", "etl::to_arithmetic", Values,
+             [&double_texts]()
+             {
+               for (size_t i = 0U; i < double_texts.size(); ++i)
+               {
+                 const std::string& text = double_texts[i];
+                 benchmark::do_not_optimise(etl::to_arithmetic<double>(text.data(), text.size()).value());
+               }
+             });
+
+  runner.run("to_arithmetic", "double", "std::strtod", Values,
+             [&double_texts]()
+             {
+               for (size_t i = 0U; i < double_texts.size(); ++i)
+               {
+                 benchmark::do_not_optimise(std::strtod(double_texts[i].c_str(), nullptr));
+               }
+             });
+
+  // format. std::format is not available on all of the compilers that we
+  // benchmark with, so snprintf is the reference.
+  runner.run("format", "two_integers", "etl::format_to", Values,
+             [&integers]()
+             {
+               etl::string<64> text;
+
+               for (size_t i = 1U; i < integers.size(); ++i)
+               {
+                 text.clear();
+                 etl::format_to(text, "{} and {}", integers[i - 1U], integers[i]);
+                 benchmark::do_not_optimise(text[0]);
+               }
+             });
+
+  runner.run("format", "two_integers", "std::snprintf", Values,
+             [&integers]()
+             {
+               char text[64];
+
+               for (size_t i = 1U; i < integers.size(); ++i)
+               {
+                 std::snprintf(text, sizeof(text), "%d and %d", int(integers[i - 1U]), int(integers[i]));
+                 benchmark::do_not_optimise(text[0]);
+               }
+             });
+
+  runner.run("format", "double_shortest", "etl::format_to", Values,
+             [&doubles]()
+             {
+               etl::string<64> text;
+
+               for (size_t i = 0U; i < doubles.size(); ++i)
+               {
+                 text.clear();
+                 etl::format_to(text, "{}", doubles[i]);
+                 benchmark::do_not_optimise(text[0]);
+               }
+             });
+
+  runner.run("format", "double_shortest", "std::snprintf", Values,
+             [&doubles]()
+             {
+               char text[64];
+
+               for (size_t i = 0U; i < doubles.size(); ++i)
+               {
+                 std::snprintf(text, sizeof(text), "%.17g", doubles[i]);
+                 benchmark::do_not_optimise(text[0]);
+               }
+             });
+
+  runner.run("format", "double_fixed_3", "etl::format_to", Values,
+             [&doubles]()
+             {
+               etl::string<64> text;
+
+               for (size_t i = 0U; i < doubles.size(); ++i)
+               {
+                 text.clear();
+                 etl::format_to(text, "{:.3f}", doubles[i]);
+                 benchmark::do_not_optimise(text[0]);
+               }
+             });
+
+  runner.run("format", "double_fixed_3", "std::snprintf", Values,
+             [&doubles]()
+             {
+               char text[64];
+
+               for (size_t i = 0U; i < doubles.size(); ++i)
+               {
+                 std::snprintf(text, sizeof(text), "%.3f", doubles[i]);
+                 benchmark::do_not_optimise(text[0]);
+               }
+             });
+
+  // string_view searches through 64 KB of log text.
+  std::string log;
+
+  for (size_t i = 0U; log.size() < 65536U; ++i)
+  {
+    char line[64];
+    std::snprintf(line, sizeof(line), "%08d INFO  sensor %d reading %d ok\n", int(i), int(i % 17U), integers[i % integers.size()]);
+    log += line;
+  }
+
+  log += "00000000 ERROR sensor 3 timeout\n";
+
+  const etl::string_view etl_log(log.data(), log.size());
+  const std::string_view std_log(log.data(), log.size());
+
+  runner.run("string_view", "find_64KB", "etl::string_view", 1U,
+             [&etl_log]() { benchmark::do_not_optimise(etl_log.find(etl::string_view("ERROR sensor"))); });
+
+  runner.run("string_view", "find_64KB", "std::string_view", 1U,
+             [&std_log]() { benchmark::do_not_optimise(std_log.find(std::string_view("ERROR sensor"))); });
+
+  runner.run("string_view", "find_char_64KB", "etl::string_view", 1U, [&etl_log]() { benchmark::do_not_optimise(etl_log.find('E')); });
+
+  runner.run("string_view", "find_char_64KB", "std::string_view", 1U, [&std_log]() { benchmark::do_not_optimise(std_log.find('E')); });
+
+  runner.run("string_view", "find_first_of_64KB", "etl::string_view", 1U,
+             [&etl_log]() { benchmark::do_not_optimise(etl_log.find_first_of(etl::string_view("EWX!"))); });
+
+  runner.run("string_view", "find_first_of_64KB", "std::string_view", 1U,
+             [&std_log]() { benchmark::do_not_optimise(std_log.find_first_of(std::string_view("EWX!"))); });
+
+  // base64. Decodes 4 KB of text per operation.
+  static etl::base64_rfc4648_padding_encoder<4096U> encoder;
+  static etl::base64_rfc4648_padding_decoder<3072U> decoder;
+
+  std::vector<unsigned char> binary(3072U);
+
+  for (size_t i = 0U; i < binary.size(); ++i)
+  {
+    binary[i] = static_cast<unsigned char>(integers[i % integers.size()]);
+  }
+
+  encoder.encode_final(binary.begin(), binary.end());
+
+  const std::vector<char> text(encoder.begin(), encoder.end());
+
+  runner.run("base64", "decode_4KB", "etl::base64_rfc4648_padding_decoder", 1U,
+             [&text]()
+             {
+               decoder.restart();
+               decoder.decode_final(text.data(), text.size());
+               benchmark::do_not_optimise(decoder.begin()[0]);
+             });
+}
@@ -0,0 +1,184 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Benchmarks etl::variant visitation against std::visit.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/utility.h"
+#include "etl/variant.h"
+
+#include <cstdint>
+#include <variant>
+#include <vector>
+
+namespace
+{
+  const size_t Values       = 1000U;
+  const size_t Alternatives = 24U;
+
+  //***************************************************************************
+  template <size_t N>
+  struct alternative
+  {
+    uint32_t value;
+  };
+
+  template <size_t... I>
+  etl::variant<alternative<I>...> make_etl_variant(etl::index_sequence<I...>);
+
+  template <size_t... I>
+  std::variant<alternative<I>...> make_std_variant(etl::index_sequence<I...>);
+
+  using etl_variant_t = decltype(make_etl_variant(etl::make_index_sequence<Alternatives>{}));
+  using std_variant_t = decltype(make_std_variant(etl::make_index_sequence<Alternatives>{}));
+
+  //***************************************************************************
+  // Variants holding alternatives in a random order.
+  //***************************************************************************
+  template <typename TVariant, size_t... I>
+  std::vector<TVariant> make_values(etl::index_sequence<I...>)
+  {
+    const TVariant choices[] = {TVariant(alternative<I>{uint32_t(I)})...};
+
+    std::vector<TVariant> values;
+    values.reserve(Values);
+
+    uint32_t x = 1U;
+
+    for (size_t i = 0U; i < Values; ++i)
+    {
+      x = (x * 1664525U) + 1013904223U;
+      values.push_back(choices[(x >> 16U) % Alternatives]);
+    }
+
+    return values;
+  }
+
+  //***************************************************************************
+  struct weigh
+  {
+    template <size_t N>
+    uint32_t operator()(const alternative<N>& a) const
+    {
+      return a.value * uint32_t(N + 1U);
+    }
+
+    template <size_t N1, size_t N2>
+    uint32_t operator()(const alternative<N1>& a, const alternative<N2>& b) const
+    {
+      return (a.value * uint32_t(N2 + 1U)) + b.value;
+    }
+  };
+
+  //***************************************************************************
+  struct accumulate
+  {
+    template <size_t N>
+    void operator()(const alternative<N>& a)
+    {
+      total += a.value * uint32_t(N + 1U);
+    }
+
+    uint32_t total;
+  };
+} // namespace
+
+//*****************************************************************************
+void run_variant_benchmarks(benchmark::runner& runner)
+{
+  const std::vector<etl_variant_t> etl_values = make_values<etl_variant_t>(etl::make_index_sequence<Alternatives>{});
+  const std::vector<std_variant_t> std_values = make_values<std_variant_t>(etl::make_index_sequence<Alternatives>{});
+
+  runner.run("variant", "visit_24_types", "etl::visit", Values,
+             [&etl_values]()
+             {
+               uint32_t total = 0U;
+
+               for (size_t i = 0U; i < etl_values.size(); ++i)
+               {
+                 total += etl::visit(weigh(), etl_values[i]);
+               }
+
+               benchmark::do_not_optimise(total);
+             });
+
+  runner.run("variant", "visit_24_types", "std::visit", Values,
+             [&std_values]()
+             {
+               uint32_t total = 0U;
+
+               for (size_t i = 0U; i < std_values.size(); ++i)
+               {
+                 total += std::visit(weigh(), std_values[i]);
+               }
+
+               benchmark::do_not_optimise(total);
+             });
+
+  runner.run("variant", "visit_24_types", "etl::variant::accept", Values,
+             [&etl_values]()
+             {
+               accumulate functor = {0U};
+
+               for (size_t i = 0U; i < etl_values.size(); ++i)
+               {
+                 etl_values[i].accept(functor);
+               }
+
+               benchmark::do_not_optimise(functor.total);
+             });
+
+  runner.run("variant", "visit_2_variants", "etl::visit", Values,
+             [&etl_values]()
+             {
+               uint32_t total = 0U;
+
+               for (size_t i = 1U; i < etl_values.size(); ++i)
+               {
+                 total += etl::visit(weigh(), etl_values[i - 1U], etl_values[i]);
+               }
+
+               benchmark::do_not_optimise(total);
+             });
+
+  runner.run("variant", "visit_2_variants", "std::visit", Values,
+             [&std_values]()
+             {
+               uint32_t total = 0U;
+
+               for (size_t i = 1U; i < std_values.size(); ++i)
+               {
+                 total += std::visit(weigh(), std_values[i - 1U], std_values[i]);
+               }
+
+               benchmark::do_not_optimise(total);
+             });
+}
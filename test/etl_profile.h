@@ -55,6 +55,8 @@ SOFTWARE.
 #define ETL_POLYMORPHIC_RANDOM
 
 #define ETL_POLYMORPHIC_BITSET
+#define ETL_POLYMORPHIC_BTREE
+#define ETL_POLYMORPHIC_CONTIGUOUS_FLAT
 #define ETL_POLYMORPHIC_DEQUE
 #define ETL_POLYMORPHIC_FLAT_MAP
 #define ETL_POLYMORPHIC_FLAT_MULTIMAP
@@ -76,6 +78,7 @@ SOFTWARE.
 #define ETL_POLYMORPHIC_UNORDERED_MULTIMAP
 #define ETL_POLYMORPHIC_UNORDERED_SET
 #define ETL_POLYMORPHIC_UNORDERED_MULTISET
+#define ETL_POLYMORPHIC_UNORDERED_FLAT_MAP
 #define ETL_POLYMORPHIC_STRINGS
 #define ETL_POLYMORPHIC_POOL
 #define ETL_POLYMORPHIC_VECTOR
@@ -31,14 +31,18 @@ SOFTWARE.
 #include "etl/algorithm.h"
 #include "etl/binary.h"
 #include "etl/container.h"
+#include "etl/list.h"
 
 #include "data.h"
 #include "iterators_for_unit_tests.h"
 
 #include <algorithm>
 #include <array>
+#include <cmath>
+#include <cstring>
 #include <forward_list>
 #include <functional>
+#include <limits>
 #include <list>
 #include <memory>
 #include <numeric>
@@ -75,6 +79,52 @@ namespace
   int dataD1[SIZE] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
   int dataD2[SIZE] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
 
+  //***********************************
+  // Test data for the sort algorithms.
+  // The index records the original position, to check stability.
+  enum class SortPattern
+  {
+    Random,
+    Sorted,
+    Reversed,
+    OrganPipe,
+    AllEqual,
+    FewUnique,
+    SortedWithNoise
+  };
+
+  const SortPattern sort_patterns[] = {SortPattern::Random,   SortPattern::Sorted,    SortPattern::Reversed,       SortPattern::OrganPipe,
+                                       SortPattern::AllEqual, SortPattern::FewUnique, SortPattern::SortedWithNoise};
+
+  const size_t sort_sizes[] = {0, 1, 2, 3, 7, 16, 23, 24, 25, 50, 127, 128, 129, 500, 1000, 5000};
+
+  std::vector<NDC> make_sort_data(size_t size, SortPattern pattern)
+  {
+    std::vector<NDC> result;
+    std::uniform_int_distribution<int> random_value(0, 1000000);
+    std::uniform_int_distribution<int> few_value(0, 3);
+
+    for (size_t i = 0; i < size; ++i)
+    {
+      int value = 0;
+
+      switch (pattern)
+      {
+        case SortPattern::Random:          value = random_value(urng); break;
+        case SortPattern::Sorted:          value = int(i); break;
+        case SortPattern::Reversed:        value = int(size - i); break;
+        case SortPattern::OrganPipe:       value = int((i < (size / 2)) ? i : (size - i)); break;
+        case SortPattern::AllEqual:        value = 42; break;
+        case SortPattern::FewUnique:       value = few_value(urng); break;
+        case SortPattern::SortedWithNoise: value = ((i % 37) == 0) ? random_value(urng) : int(i); break;
+      }
+
+      result.push_back(NDC(value, int(i)));
+    }
+
+    return result;
+  }
+
   class Data
   {
   public:
@@ -729,6 +779,34 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(branchless_lower_and_upper_bound)
+    {
+      // Every length from 0 to SIZE, with and without duplicates.
+      for (size_t length = 0U; length <= SIZE; ++length)
+      {
+        for (int i = 0; i < 12; ++i)
+        {
+          CHECK_EQUAL(std::lower_bound(dataS, dataS + length, i) - dataS, etl::branchless_lower_bound(dataS, dataS + length, i) - dataS);
+          CHECK_EQUAL(std::upper_bound(dataS, dataS + length, i) - dataS, etl::branchless_upper_bound(dataS, dataS + length, i) - dataS);
+          CHECK_EQUAL(std::lower_bound(dataEQ, dataEQ + length, i) - dataEQ, etl::branchless_lower_bound(dataEQ, dataEQ + length, i) - dataEQ);
+          CHECK_EQUAL(std::upper_bound(dataEQ, dataEQ + length, i) - dataEQ, etl::branchless_upper_bound(dataEQ, dataEQ + length, i) - dataEQ);
+        }
+      }
+
+      // With a comparator.
+      int reversed[SIZE];
+      std::reverse_copy(std::begin(dataEQ), std::end(dataEQ), std::begin(reversed));
+
+      for (int i = 0; i < 12; ++i)
+      {
+        CHECK_EQUAL(std::lower_bound(std::begin(reversed), std::end(reversed), i, std::greater<int>()) - reversed,
+                    etl::branchless_lower_bound(std::begin(reversed), std::end(reversed), i, std::greater<int>()) - reversed);
+        CHECK_EQUAL(std::upper_bound(std::begin(reversed), std::end(reversed), i, std::greater<int>()) - reversed,
+                    etl::branchless_upper_bound(std::begin(reversed), std::end(reversed), i, std::greater<int>()) - reversed);
+      }
+    }
+
     //*************************************************************************
     TEST(equal_range_random_iterator)
     {
@@ -3800,6 +3878,390 @@ namespace
       CHECK(is_same);
     }
 
+    //*************************************************************************
+    TEST(intro_sort_default)
+    {
+      for (size_t size : sort_sizes)
+      {
+        for (SortPattern pattern : sort_patterns)
+        {
+          std::vector<NDC> data1 = make_sort_data(size, pattern);
+          std::vector<NDC> data2(data1);
+
+          std::sort(data1.begin(), data1.end());
+          etl::intro_sort(data2.begin(), data2.end());
+
+          bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+          CHECK(is_same);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(intro_sort_greater)
+    {
+      for (size_t size : sort_sizes)
+      {
+        for (SortPattern pattern : sort_patterns)
+        {
+          std::vector<NDC> data1 = make_sort_data(size, pattern);
+          std::vector<NDC> data2(data1);
+
+          std::sort(data1.begin(), data1.end(), std::greater<NDC>());
+          etl::intro_sort(data2.begin(), data2.end(), std::greater<NDC>());
+
+          bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+          CHECK(is_same);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(intro_sort_median_of_3_killer)
+    {
+      // A sequence that drives naive median of 3 quicksort to O(N^2).
+      const size_t     Size = 4096;
+      std::vector<int> data1(Size);
+
+      for (size_t i = 0; i < Size / 2; ++i)
+      {
+        data1[2 * i]     = int(i + 1);
+        data1[2 * i + 1] = int((Size / 2) + i + 1);
+      }
+
+      std::vector<int> data2(data1);
+
+      size_t compares = 0;
+
+      std::sort(data1.begin(), data1.end());
+      etl::intro_sort(data2.begin(), data2.end(),
+                      [&compares](int lhs, int rhs)
+                      {
+                        ++compares;
+                        return lhs < rhs;
+                      });
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+      CHECK(is_same);
+      CHECK(compares < (Size * 12U * 3U));
+    }
+
+    //*************************************************************************
+    TEST(merge_sort_default)
+    {
+      for (size_t size : sort_sizes)
+      {
+        for (SortPattern pattern : sort_patterns)
+        {
+          std::vector<NDC> data1 = make_sort_data(size, pattern);
+          std::vector<NDC> data2(data1);
+
+          std::stable_sort(data1.begin(), data1.end());
+          etl::merge_sort(data2.begin(), data2.end());
+
+          bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+          CHECK(is_same);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(merge_sort_greater)
+    {
+      for (size_t size : sort_sizes)
+      {
+        for (SortPattern pattern : sort_patterns)
+        {
+          std::vector<NDC> data1 = make_sort_data(size, pattern);
+          std::vector<NDC> data2(data1);
+
+          std::stable_sort(data1.begin(), data1.end(), std::greater<NDC>());
+          etl::merge_sort(data2.begin(), data2.end(), std::greater<NDC>());
+
+          bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+          CHECK(is_same);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(merge_sort_with_buffer)
+    {
+      for (size_t size : sort_sizes)
+      {
+        for (SortPattern pattern : sort_patterns)
+        {
+          // Full, half and small buffers.
+          const size_t buffer_sizes[] = {size, size / 2, 5};
+
+          for (size_t buffer_size : buffer_sizes)
+          {
+            std::vector<NDC> data1 = make_sort_data(size, pattern);
+            std::vector<NDC> data2(data1);
+            std::vector<NDC> buffer(buffer_size, NDC(0));
+
+            std::stable_sort(data1.begin(), data1.end());
+            etl::merge_sort(data2.begin(), data2.end(), buffer.begin(), buffer.end());
+
+            bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+            CHECK(is_same);
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(merge_sort_with_buffer_greater)
+    {
+      std::vector<NDC> data1 = make_sort_data(1000, SortPattern::FewUnique);
+      std::vector<NDC> data2(data1);
+
+      std::vector<NDC> buffer(100, NDC(0));
+
+      std::stable_sort(data1.begin(), data1.end(), std::greater<NDC>());
+      etl::merge_sort(data2.begin(), data2.end(), buffer.data(), buffer.data() + buffer.size(), std::greater<NDC>());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+      CHECK(is_same);
+    }
+
+#if ETL_NOT_USING_STL
+    //*************************************************************************
+    // Without the STL, etl::stable_sort accepts bidirectional iterators.
+    TEST(stable_sort_bidirectional_iterators)
+    {
+      std::vector<NDC> initial_data = {NDC(1, 1), NDC(2, 1), NDC(3, 1), NDC(2, 2), NDC(3, 2), NDC(4, 1), NDC(2, 3), NDC(3, 3), NDC(5, 1)};
+
+      std::vector<NDC>    data1(initial_data.begin(), initial_data.end());
+      etl::list<NDC, 10U> data2(initial_data.begin(), initial_data.end());
+      etl::list<NDC, 10U> data3(initial_data.begin(), initial_data.end());
+
+      std::stable_sort(data1.begin(), data1.end());
+      etl::stable_sort(data2.begin(), data2.end());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+      CHECK(is_same);
+
+      std::stable_sort(data1.begin(), data1.end(), std::greater<NDC>());
+      etl::stable_sort(data3.begin(), data3.end(), std::greater<NDC>());
+
+      is_same = std::equal(data1.begin(), data1.end(), data3.begin(), NDC::are_identical);
+      CHECK(is_same);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(stable_sort_large)
+    {
+      for (SortPattern pattern : sort_patterns)
+      {
+        std::vector<NDC> data1 = make_sort_data(1000, pattern);
+        std::vector<NDC> data2(data1);
+
+        std::stable_sort(data1.begin(), data1.end());
+        etl::stable_sort(data2.begin(), data2.end());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(stable_sort_with_buffer)
+    {
+      for (SortPattern pattern : sort_patterns)
+      {
+        std::vector<NDC> data1 = make_sort_data(1000, pattern);
+        std::vector<NDC> data2(data1);
+        std::vector<NDC> data3(data1);
+        std::vector<NDC> buffer(500, NDC(0));
+
+        std::stable_sort(data1.begin(), data1.end());
+        etl::stable_sort(data2.begin(), data2.end(), buffer.begin(), buffer.end());
+        etl::stable_sort(data3.begin(), data3.end(), buffer.begin(), buffer.end(), std::greater<NDC>());
+        std::reverse(data3.begin(), data3.end());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+        CHECK(is_same);
+
+        is_same = std::equal(data1.begin(), data1.end(), data3.begin(), [](const NDC& lhs, const NDC& rhs) { return lhs.value == rhs.value; });
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    template <typename T>
+    std::vector<T> make_radix_sort_data(size_t size)
+    {
+      std::vector<T> result;
+      std::uniform_int_distribution<uint64_t> random_value;
+
+      for (size_t i = 0; i < size; ++i)
+      {
+        uint64_t value = random_value(urng);
+        T        t;
+
+        // Use the whole bit pattern of the value.
+        memcpy(&t, &value, sizeof(T));
+        result.push_back(t);
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    template <typename T>
+    bool radix_sort_matches_sort()
+    {
+      for (size_t size : sort_sizes)
+      {
+        std::vector<T> data1 = make_radix_sort_data<T>(size);
+        std::vector<T> data2(data1);
+        std::vector<T> buffer(size);
+
+        std::sort(data1.begin(), data1.end());
+        etl::radix_sort(data2.begin(), data2.end(), buffer.begin(), buffer.end());
+
+        if (data1 != data2)
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    TEST(radix_sort_unsigned)
+    {
+      CHECK(radix_sort_matches_sort<uint8_t>());
+      CHECK(radix_sort_matches_sort<uint16_t>());
+      CHECK(radix_sort_matches_sort<uint32_t>());
+      CHECK(radix_sort_matches_sort<uint64_t>());
+    }
+
+    //*************************************************************************
+    TEST(radix_sort_signed)
+    {
+      CHECK(radix_sort_matches_sort<int8_t>());
+      CHECK(radix_sort_matches_sort<int16_t>());
+      CHECK(radix_sort_matches_sort<int32_t>());
+      CHECK(radix_sort_matches_sort<int64_t>());
+
+      std::vector<int> data   = {0, -1, 1, std::numeric_limits<int>::min(), std::numeric_limits<int>::max(), -256, 256, -255, 255};
+      std::vector<int> buffer(data.size());
+      std::vector<int> expected(data);
+
+      std::sort(expected.begin(), expected.end());
+      etl::radix_sort(data.begin(), data.end(), buffer.begin(), buffer.end());
+
+      CHECK(expected == data);
+    }
+
+    //*************************************************************************
+    TEST(radix_sort_floating_point)
+    {
+      std::vector<double> data   = {0.0,
+                                    -1.0,
+                                    1.0,
+                                    -0.5,
+                                    0.5,
+                                    1.0e300,
+                                    -1.0e300,
+                                    std::numeric_limits<double>::infinity(),
+                                    -std::numeric_limits<double>::infinity(),
+                                    std::numeric_limits<double>::denorm_min(),
+                                    -std::numeric_limits<double>::denorm_min(),
+                                    123.456,
+                                    -123.456};
+      std::vector<double> buffer(data.size());
+      std::vector<double> expected(data);
+
+      std::sort(expected.begin(), expected.end());
+      etl::radix_sort(data.begin(), data.end(), buffer.begin(), buffer.end());
+
+      CHECK(expected == data);
+
+      std::uniform_real_distribution<float> random_value(-1.0e6f, 1.0e6f);
+
+      std::vector<float> dataf;
+
+      for (size_t i = 0; i < 1000; ++i)
+      {
+        dataf.push_back(random_value(urng));
+      }
+
+      std::vector<float> bufferf(dataf.size());
+      std::vector<float> expectedf(dataf);
+
+      std::sort(expectedf.begin(), expectedf.end());
+      etl::radix_sort(dataf.begin(), dataf.end(), bufferf.begin(), bufferf.end());
+
+      CHECK(expectedf == dataf);
+    }
+
+    //*************************************************************************
+    TEST(radix_sort_negative_zero_orders_first)
+    {
+      std::vector<double> data   = {0.0, -0.0, 0.0, -0.0};
+      std::vector<double> buffer(data.size());
+
+      etl::radix_sort(data.begin(), data.end(), buffer.begin(), buffer.end());
+
+      CHECK(std::signbit(data[0]));
+      CHECK(std::signbit(data[1]));
+      CHECK(!std::signbit(data[2]));
+      CHECK(!std::signbit(data[3]));
+    }
+
+    //*************************************************************************
+    TEST(radix_sort_key_projection_is_stable)
+    {
+      for (SortPattern pattern : sort_patterns)
+      {
+        std::vector<NDC> data1 = make_sort_data(1000, pattern);
+        std::vector<NDC> data2(data1);
+        std::vector<NDC> buffer(data1.size(), NDC(0));
+
+        std::stable_sort(data1.begin(), data1.end());
+        etl::radix_sort(data2.begin(), data2.end(), buffer.begin(), buffer.end(), [](const NDC& ndc) { return ndc.value; });
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(radix_sort_key_projection_pairs)
+    {
+      using Pair = std::pair<uint32_t, size_t>;
+
+      std::vector<Pair> data1;
+      std::uniform_int_distribution<uint32_t> random_value(0, 1000);
+
+      for (size_t i = 0; i < 5000; ++i)
+      {
+        data1.push_back(Pair(random_value(urng), i));
+      }
+
+      std::vector<Pair> data2(data1);
+      Pair              buffer[5000];
+
+      std::stable_sort(data1.begin(), data1.end(), [](const Pair& lhs, const Pair& rhs) { return lhs.first < rhs.first; });
+      etl::radix_sort(data2.data(), data2.data() + data2.size(), std::begin(buffer), std::end(buffer), [](const Pair& p) { return p.first; });
+
+      CHECK(data1 == data2);
+    }
+
+    //*************************************************************************
+    TEST(radix_sort_buffer_too_small)
+    {
+      std::vector<uint32_t> data   = {3, 2, 1};
+      std::vector<uint32_t> buffer(2);
+
+      CHECK_THROW(etl::radix_sort(data.begin(), data.end(), buffer.begin(), buffer.end()), etl::algorithm_error);
+    }
+
     //*************************************************************************
     TEST(multimax)
     {
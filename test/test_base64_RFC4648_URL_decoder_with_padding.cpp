@@ -531,6 +531,31 @@ namespace
 #endif
     }
 
+    //*************************************************************************
+    TEST(test_decode_invalid_character_in_long_input)
+    {
+      // Characters from the other character sets, and one from none of them.
+      const std::string invalid_characters("+/,*\x80");
+
+      for (size_t c = 0; c < invalid_characters.size(); ++c)
+      {
+        for (size_t position = 0; position < 64; position += 7)
+        {
+          codec_full_buffer b64;
+
+          std::string invalid_input = encoded[255];
+          invalid_input[position]   = invalid_characters[c];
+
+#if ETL_USING_EXCEPTIONS
+          CHECK_THROW((b64.decode(invalid_input.data(), invalid_input.size())), etl::base64_invalid_data);
+#else
+          CHECK_FALSE(b64.decode(invalid_input.data(), invalid_input.size()));
+          CHECK_TRUE(b64.invalid_data());
+#endif
+        }
+      }
+    }
+
     //*************************************************************************
     TEST(test_decode_invalid_padding)
     {
@@ -2503,6 +2503,18 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(test_count_leading_zeros_64_every_bit)
+    {
+      for (int bit = 0; bit < 64; ++bit)
+      {
+        const uint64_t value = uint64_t(1U) << bit;
+
+        CHECK_EQUAL(int(test_leading_zeros(value)), int(etl::count_leading_zeros(value)));
+        CHECK_EQUAL(int(test_leading_zeros(value | 1U)), int(etl::count_leading_zeros(uint64_t(value | 1U))));
+      }
+    }
+
 #if ETL_USING_CPP14
     //*************************************************************************
     TEST(test_count_leading_zeros_64_constexpr)
@@ -30,7 +30,9 @@ SOFTWARE.
 
 #include <bitset>
 #include <limits>
+#include <string>
 #include <type_traits>
+#include <vector>
 
 #include "etl/string.h"
 #include "etl/u16string.h"
@@ -2073,6 +2075,87 @@ namespace
       CHECK_EQUAL(4U, bs4find_next_true1);
     }
 
+
+    //*************************************************************************
+    TEST(test_find_next_multi_element)
+    {
+      // Set bits every 7, all set, all clear, then alternating.
+      etl::bitset<200> data;
+
+      for (size_t i = 0U; i < 200U; ++i)
+      {
+        data.set(i, (i < 64U) ? ((i % 7U) == 3U) : (i < 128U) ? true : (i < 192U) ? false : ((i % 2U) == 0U));
+      }
+
+      for (size_t position = 0U; position <= 200U; ++position)
+      {
+        size_t expected_true  = etl::bitset<200>::npos;
+        size_t expected_false = etl::bitset<200>::npos;
+
+        for (size_t i = 200U; i > position; --i)
+        {
+          (data.test(i - 1U) ? expected_true : expected_false) = i - 1U;
+        }
+
+        CHECK_EQUAL(expected_true, data.find_next(true, position));
+        CHECK_EQUAL(expected_false, data.find_next(false, position));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_for_each_set_bit)
+    {
+      etl::bitset<200> data;
+      data.set(0U).set(7U).set(8U).set(63U).set(64U).set(150U).set(199U);
+
+      std::vector<size_t> positions;
+      data.for_each_set_bit([&positions](size_t position) { positions.push_back(position); });
+
+      std::vector<size_t> expected = {0U, 7U, 8U, 63U, 64U, 150U, 199U};
+      CHECK(expected == positions);
+
+      positions.clear();
+      etl::bitset<200>().for_each_set_bit([&positions](size_t position) { positions.push_back(position); });
+      CHECK(positions.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_bulk_operations_multi_element)
+    {
+      std::bitset<1000> compare1;
+      std::bitset<1000> compare2;
+      etl::bitset<1000> data1;
+      etl::bitset<1000> data2;
+
+      uint32_t random = 1U;
+
+      for (size_t i = 0U; i < 1000U; ++i)
+      {
+        random = (random * 1664525U) + 1013904223U;
+        compare1.set(i, (random & 0x10000U) != 0U);
+        compare2.set(i, (random & 0x20000U) != 0U);
+        data1.set(i, (random & 0x10000U) != 0U);
+        data2.set(i, (random & 0x20000U) != 0U);
+      }
+
+      CHECK_EQUAL(compare1.to_string(), data1.to_string<std::string>());
+      CHECK_EQUAL(compare1.count(), data1.count());
+      CHECK_EQUAL((compare1 & compare2).to_string(), (data1 & data2).to_string<std::string>());
+      CHECK_EQUAL((compare1 | compare2).to_string(), (data1 | data2).to_string<std::string>());
+      CHECK_EQUAL((compare1 ^ compare2).to_string(), (data1 ^ data2).to_string<std::string>());
+      CHECK_EQUAL((~compare1).to_string(), (~data1).to_string<std::string>());
+      CHECK_EQUAL((~compare1).count(), (~data1).count());
+
+      // Only the last bit set.
+      etl::bitset<1000> last;
+      CHECK(last.none());
+      CHECK(!last.any());
+
+      last.set(999U);
+      CHECK(!last.none());
+      CHECK(last.any());
+      CHECK_EQUAL(1U, last.count());
+    }
     //*************************************************************************
     ETL_CONSTEXPR14 std::pair<etl::bitset<8>, etl::bitset<8>> test_swap_helper()
     {
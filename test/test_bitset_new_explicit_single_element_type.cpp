@@ -30,7 +30,9 @@ SOFTWARE.
 
 #include <bitset>
 #include <limits>
+#include <string>
 #include <type_traits>
+#include <vector>
 
 #include "etl/string.h"
 #include "etl/u16string.h"
@@ -2196,6 +2198,37 @@ namespace
       CHECK_EQUAL(4U, bs4find_next_true1);
     }
 
+
+    //*************************************************************************
+    TEST(test_find_next_upper_bits_of_uint64_t)
+    {
+      ETL_CONSTEXPR14 etl::bitset<64, uint64_t> bs1(0x8000010000000000ULL);
+      ETL_CONSTEXPR14 size_t bs1find_next_true33 = bs1.find_next(true, 33);
+      ETL_CONSTEXPR14 size_t bs1find_next_true41 = bs1.find_next(true, 41);
+      ETL_CONSTEXPR14 size_t bs1find_next_false40 = bs1.find_next(false, 40);
+      ETL_CONSTEXPR14 size_t bs1find_next_false63 = bs1.find_next(false, 63);
+      CHECK_EQUAL(40U, bs1find_next_true33);
+      CHECK_EQUAL(63U, bs1find_next_true41);
+      CHECK_EQUAL(41U, bs1find_next_false40);
+      CHECK_EQUAL(etl::bitset<>::npos, bs1find_next_false63);
+
+      // The unused bits are not found.
+      ETL_CONSTEXPR14 etl::bitset<40, uint64_t> bs2(0xFFFFFFFFFFULL);
+      ETL_CONSTEXPR14 size_t bs2find_next_false0 = bs2.find_next(false, 0);
+      CHECK_EQUAL(etl::bitset<>::npos, bs2find_next_false0);
+    }
+
+    //*************************************************************************
+    TEST(test_for_each_set_bit)
+    {
+      etl::bitset<64, uint64_t> data(0x8000010000000081ULL);
+
+      std::vector<size_t> positions;
+      data.for_each_set_bit([&positions](size_t position) { positions.push_back(position); });
+
+      std::vector<size_t> expected = {0U, 7U, 40U, 63U};
+      CHECK(expected == positions);
+    }
     //*************************************************************************
     ETL_CONSTEXPR14 std::pair<etl::bitset<8, uint8_t>, etl::bitset<8, uint8_t>> test_swap_helper()
     {
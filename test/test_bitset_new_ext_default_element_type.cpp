@@ -30,7 +30,9 @@ SOFTWARE.
 
 #include <bitset>
 #include <limits>
+#include <string>
 #include <type_traits>
+#include <vector>
 
 #include "etl/endianness.h"
 #include "etl/string.h"
@@ -1773,6 +1775,70 @@ namespace
       CHECK_EQUAL(4U, bs4fnt1);
     }
 
+
+    //*************************************************************************
+    TEST(test_for_each_set_bit)
+    {
+      etl::bitset_ext<200>::buffer_type buffer;
+      etl::bitset_ext<200>              data(buffer);
+      data.set(0U).set(7U).set(8U).set(63U).set(64U).set(150U).set(199U);
+
+      std::vector<size_t> positions;
+      data.for_each_set_bit([&positions](size_t position) { positions.push_back(position); });
+
+      std::vector<size_t> expected = {0U, 7U, 8U, 63U, 64U, 150U, 199U};
+      CHECK(expected == positions);
+    }
+
+    //*************************************************************************
+    TEST(test_bulk_operations_multi_element)
+    {
+      std::bitset<1000> compare1;
+      std::bitset<1000> compare2;
+
+      etl::bitset_ext<1000>::buffer_type buffer1;
+      etl::bitset_ext<1000>::buffer_type buffer2;
+      etl::bitset_ext<1000>              data1(buffer1);
+      etl::bitset_ext<1000>              data2(buffer2);
+
+      uint32_t random = 1U;
+
+      for (size_t i = 0U; i < 1000U; ++i)
+      {
+        random = (random * 1664525U) + 1013904223U;
+        compare1.set(i, (random & 0x10000U) != 0U);
+        compare2.set(i, (random & 0x20000U) != 0U);
+        data1.set(i, (random & 0x10000U) != 0U);
+        data2.set(i, (random & 0x20000U) != 0U);
+      }
+
+      CHECK_EQUAL(compare1.count(), data1.count());
+      CHECK_EQUAL(compare1.to_string(), data1.to_string<std::string>());
+
+      compare1 &= compare2;
+      data1 &= data2;
+      CHECK_EQUAL(compare1.to_string(), data1.to_string<std::string>());
+
+      compare1 |= compare2;
+      data1 |= data2;
+      CHECK_EQUAL(compare1.to_string(), data1.to_string<std::string>());
+
+      compare1 ^= compare2;
+      data1 ^= data2;
+      CHECK_EQUAL(compare1.to_string(), data1.to_string<std::string>());
+
+      compare1.flip();
+      data1.flip();
+      CHECK_EQUAL(compare1.to_string(), data1.to_string<std::string>());
+      CHECK_EQUAL(compare1.count(), data1.count());
+
+      data1.reset();
+      CHECK(data1.none());
+
+      data1.set(999U);
+      CHECK(data1.any());
+      CHECK_EQUAL(999U, data1.find_first(true));
+    }
     //*************************************************************************
     TEST(test_swap)
     {
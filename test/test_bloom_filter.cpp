@@ -71,6 +71,16 @@ struct hash3_t
   }
 };
 
+struct hash_uint32_t
+{
+  typedef uint32_t argument_type;
+
+  size_t operator()(argument_type value) const
+  {
+    return value;
+  }
+};
+
 std::vector<const char*> exist_text     = {"The", "rain", "in", "Spain", "falls", "mainly", "on", "the", "plain"};
 std::vector<const char*> not_exist_text = {"My", "hovercraft", "is", "full", "of", "eels"};
 
@@ -261,5 +271,148 @@ namespace
 
       CHECK(!any_exist);
     }
+
+    //*************************************************************************
+    TEST(test_blocked_bloom_filter)
+    {
+      etl::blocked_bloom_filter<1024, 6, hash1_t> bloom;
+
+      for (size_t i = 0UL; i < exist_text.size(); ++i)
+      {
+        bloom.add(exist_text[i]);
+      }
+
+      // Check for false negatives.
+      bool all_exist = true;
+
+      for (size_t i = 0UL; i < exist_text.size(); ++i)
+      {
+        all_exist = all_exist && bloom.exists(exist_text[i]);
+      }
+
+      CHECK(all_exist);
+
+      // Check for false positives. There should be none for this set.
+      bool any_exist = false;
+
+      for (size_t i = 0UL; i < not_exist_text.size(); ++i)
+      {
+        any_exist = any_exist || bloom.exists(not_exist_text[i]);
+      }
+
+      CHECK(!any_exist);
+
+      // At most K bits for each key.
+      size_t count = bloom.count();
+      CHECK(count > 0);
+      CHECK(count <= (6 * exist_text.size()));
+    }
+
+    //*************************************************************************
+    TEST(test_blocked_bloom_filter_width)
+    {
+      typedef etl::blocked_bloom_filter<1000, 4, hash1_t> Bloom;
+      Bloom                                               bloom;
+
+      CHECK_EQUAL(2U, Bloom::BLOCKS);
+      CHECK_EQUAL(1024U, Bloom::WIDTH);
+      CHECK_EQUAL(1024U, bloom.width());
+    }
+
+    //*************************************************************************
+    TEST(test_blocked_bloom_filter_false_positive_rate)
+    {
+      // 10 bits per key with K = 7 gives a rate of about 1% for a classic
+      // filter, a little more for a blocked one.
+      static etl::blocked_bloom_filter<100000, 7, hash_uint32_t> bloom;
+
+      for (uint32_t i = 0U; i < 10000U; ++i)
+      {
+        bloom.add(i * 2U);
+      }
+
+      size_t false_negatives = 0U;
+      size_t false_positives = 0U;
+
+      for (uint32_t i = 0U; i < 10000U; ++i)
+      {
+        false_negatives += bloom.exists(i * 2U) ? 0U : 1U;
+        false_positives += bloom.exists((i * 2U) + 1U) ? 1U : 0U;
+      }
+
+      CHECK_EQUAL(0U, false_negatives);
+      CHECK(false_positives < 200U);
+    }
+
+    //*************************************************************************
+    TEST(test_blocked_bloom_filter_batched_exists)
+    {
+      etl::blocked_bloom_filter<4096, 5, hash_uint32_t> bloom;
+
+      for (uint32_t i = 0U; i < 200U; ++i)
+      {
+        bloom.add(i * 3U);
+      }
+
+      // Not a multiple of the group size.
+      std::vector<uint32_t> keys;
+
+      for (uint32_t i = 0U; i < 613U; ++i)
+      {
+        keys.push_back(i);
+      }
+
+      bool              result_bools[613];
+
+      size_t count = bloom.exists(etl::span<const uint32_t>(keys.data(), keys.size()), etl::span<bool>(result_bools, 613U));
+
+      size_t expected_count = 0U;
+      bool   all_match      = true;
+
+      for (size_t i = 0U; i < keys.size(); ++i)
+      {
+        const bool expected = bloom.exists(keys[i]);
+
+        expected_count += expected ? 1U : 0U;
+        all_match = all_match && (result_bools[i] == expected);
+
+        if (((keys[i] % 3U) == 0U) && (keys[i] < 600U))
+        {
+          all_match = all_match && result_bools[i];
+        }
+      }
+
+      CHECK(all_match);
+      CHECK_EQUAL(expected_count, count);
+
+      // Only the smaller of the two sizes is processed.
+      bool few_results[10] = {};
+
+      count = bloom.exists(etl::span<const uint32_t>(keys.data(), keys.size()), etl::span<bool>(few_results, 10U));
+
+      CHECK(count <= 10U);
+      CHECK(few_results[0]);
+      CHECK(few_results[3]);
+      CHECK(few_results[9]);
+    }
+
+    //*************************************************************************
+    TEST(test_blocked_bloom_filter_clear)
+    {
+      etl::blocked_bloom_filter<512, 3, hash1_t> bloom;
+
+      for (size_t i = 0UL; i < exist_text.size(); ++i)
+      {
+        bloom.add(exist_text[i]);
+      }
+
+      CHECK(bloom.usage() > 0);
+
+      bloom.clear();
+
+      CHECK_EQUAL(0U, bloom.usage());
+      CHECK_EQUAL(0U, bloom.count());
+      CHECK(!bloom.exists(exist_text[0]));
+    }
   }
 } // namespace
@@ -1008,6 +1008,167 @@ namespace
       CHECK(isEqual);
     }
 
+    //*************************************************************************
+    TEST(test_push_span)
+    {
+      etl::circular_buffer<int, SIZE> data;
+
+      const int input1[] = {0, 1, 2, 3, 4, 5, 6};
+      const int input2[] = {7, 8, 9, 10, 11, 12};
+
+      data.push(etl::span<const int>(input1));
+      data.pop(5);
+      data.push(etl::span<const int>(input2)); // Wraps around the end of the storage.
+
+      std::vector<int> compare = {5, 6, 7, 8, 9, 10, 11, 12};
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(std::equal(compare.begin(), compare.end(), data.begin()));
+      CHECK_EQUAL(5, data.front());
+      CHECK_EQUAL(12, data.back());
+    }
+
+    //*************************************************************************
+    TEST(test_push_span_overwrites_oldest)
+    {
+      etl::circular_buffer<int, SIZE> data;
+
+      const int input1[] = {0, 1, 2, 3, 4, 5, 6};
+      const int input2[] = {7, 8, 9, 10, 11, 12};
+
+      data.push(etl::span<const int>(input1));
+      data.push(etl::span<const int>(input2));
+
+      std::vector<int> compare = {3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+
+      CHECK(data.full());
+      CHECK(std::equal(compare.begin(), compare.end(), data.begin()));
+
+      // More than the capacity in one go.
+      std::vector<int> input3 = {20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32};
+      data.push(etl::span<const int>(input3.data(), input3.size()));
+
+      CHECK(data.full());
+      CHECK(std::equal(input3.end() - SIZE, input3.end(), data.begin()));
+
+      // An empty span.
+      data.push(etl::span<const int>());
+
+      CHECK(std::equal(input3.end() - SIZE, input3.end(), data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_push_span_non_trivial)
+    {
+      Compare input1{Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9")};
+      Compare input2{Ndc("10"), Ndc("11"), Ndc("12")};
+      Data    data;
+
+      data.push(etl::span<const Ndc>(input1.data(), input1.size()));
+      data.push(etl::span<const Ndc>(input2.data(), input2.size()));
+
+      Compare compare{Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12")};
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(std::equal(compare.begin(), compare.end(), data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_pop_into_span)
+    {
+      etl::circular_buffer<int, SIZE> data;
+
+      const int input1[] = {0, 1, 2, 3, 4, 5, 6, 7};
+      const int input2[] = {8, 9, 10, 11, 12};
+
+      data.push(etl::span<const int>(input1));
+      data.pop(6);
+      data.push(etl::span<const int>(input2)); // Wraps around the end of the storage.
+
+      int output[5] = {};
+
+      CHECK_EQUAL(5U, data.pop_into(etl::span<int>(output)));
+      CHECK_EQUAL(2U, data.size());
+
+      const int compare1[] = {6, 7, 8, 9, 10};
+      CHECK(std::equal(std::begin(compare1), std::end(compare1), output));
+
+      // Fewer available than the span will hold.
+      CHECK_EQUAL(2U, data.pop_into(etl::span<int>(output)));
+      CHECK(data.empty());
+      CHECK_EQUAL(11, output[0]);
+      CHECK_EQUAL(12, output[1]);
+
+      CHECK_EQUAL(0U, data.pop_into(etl::span<int>(output)));
+
+      // The buffer is usable after emptying.
+      data.push(etl::span<const int>(input1));
+      CHECK(std::equal(std::begin(input1), std::end(input1), data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_pop_into_span_non_trivial)
+    {
+      Compare input{Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11")};
+      Data    data;
+
+      data.push(input.begin(), input.end());
+
+      Compare output(4, Ndc(""));
+
+      CHECK_EQUAL(4U, data.pop_into(etl::span<Ndc>(output.data(), output.size())));
+      CHECK_EQUAL(6U, data.size());
+      CHECK(std::equal(input.begin() + 2, input.begin() + 6, output.begin()));
+      CHECK(std::equal(input.begin() + 6, input.end(), data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_array_one_and_array_two)
+    {
+      etl::circular_buffer<int, SIZE> data;
+
+      CHECK(data.array_one().empty());
+      CHECK(data.array_two().empty());
+
+      const int input1[] = {0, 1, 2, 3, 4, 5, 6, 7};
+      const int input2[] = {8, 9, 10, 11, 12};
+
+      data.push(etl::span<const int>(input1));
+
+      // Not wrapped.
+      etl::span<int> one = data.array_one();
+      etl::span<int> two = data.array_two();
+
+      CHECK_EQUAL(8U, one.size());
+      CHECK_EQUAL(0U, two.size());
+      CHECK(std::equal(one.begin(), one.end(), std::begin(input1)));
+
+      data.pop(6);
+      data.push(etl::span<const int>(input2));
+
+      // Wrapped.
+      const etl::circular_buffer<int, SIZE>& cdata = data;
+
+      etl::span<const int> cone = cdata.array_one();
+      etl::span<const int> ctwo = cdata.array_two();
+
+      CHECK_EQUAL(data.size(), cone.size() + ctwo.size());
+
+      std::vector<int> segments(cone.begin(), cone.end());
+      segments.insert(segments.end(), ctwo.begin(), ctwo.end());
+
+      CHECK(std::equal(segments.begin(), segments.end(), data.begin()));
+      CHECK_EQUAL(&data.front(), cone.data());
+      CHECK_EQUAL(&data.back(), &ctwo.back());
+
+      // Writes through the segments are seen by the buffer.
+      data.array_one()[0] = 100;
+      data.array_two()[0] = 200;
+
+      CHECK_EQUAL(100, data[0]);
+      CHECK_EQUAL(200, data[cone.size()]);
+    }
+
     //*************************************************************************
     TEST(test_memcpy_repair)
     {
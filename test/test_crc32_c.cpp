@@ -316,5 +316,125 @@ namespace
       uint32_t crc3 = etl::crc32_c_t4(data3.rbegin(), data3.rend());
       CHECK_EQUAL(crc1, crc3);
     }
+
+    //*************************************************************************
+    // Table size 2048 (slicing-by-8)
+    //*************************************************************************
+    TEST(test_crc32_c_t2048)
+    {
+      std::string data("123456789");
+
+      uint32_t crc1 = etl::crc32_c_t2048(data.begin(), data.end());
+      uint32_t crc2 = etl::crc32_c_t2048(data.data(), data.data() + data.size());
+
+      CHECK_EQUAL(0xE3069283UL, crc1);
+      CHECK_EQUAL(0xE3069283UL, crc2);
+    }
+
+#if ETL_USING_CPP14 && !defined(ETL_CRC_FORCE_CPP03_IMPLEMENTATION) && !ETL_USING_CRC32C_INSTRUCTIONS
+    //*************************************************************************
+    TEST(test_crc32_c_t2048_constexpr)
+    {
+      constexpr char     data[] = "123456789";
+      constexpr uint32_t crc    = etl::crc32_c_t2048(data, data + 9);
+
+      CHECK_EQUAL(0xE3069283UL, crc);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_crc32_c_t2048_add_values_and_ranges)
+    {
+      std::string data("123456789");
+
+      etl::crc32_c_t2048 crc_calculator;
+
+      crc_calculator.add(static_cast<uint8_t>(data[0]));
+      crc_calculator.add(data.data() + 1, data.data() + 4);
+      crc_calculator.add(data.begin() + 4, data.end());
+
+      CHECK_EQUAL(0xE3069283UL, crc_calculator.value());
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_c_t2048_matches_256_table_for_all_lengths_and_offsets)
+    {
+      std::vector<uint8_t> data(100U);
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        data[i] = static_cast<uint8_t>((i * 151U) + 7U);
+      }
+
+      for (size_t offset = 0UL; offset < 8UL; ++offset)
+      {
+        for (size_t length = 0UL; length <= (data.size() - offset); ++length)
+        {
+          const uint8_t* begin = data.data() + offset;
+
+          CHECK_EQUAL(uint32_t(etl::crc32_c_t256(begin, begin + length)), uint32_t(etl::crc32_c_t2048(begin, begin + length)));
+        }
+      }
+    }
+
+    //*************************************************************************
+    // Table size 4096 (slicing-by-16)
+    //*************************************************************************
+    TEST(test_crc32_c_t4096)
+    {
+      std::string data("123456789");
+
+      uint32_t crc1 = etl::crc32_c_t4096(data.begin(), data.end());
+      uint32_t crc2 = etl::crc32_c_t4096(data.data(), data.data() + data.size());
+
+      CHECK_EQUAL(0xE3069283UL, crc1);
+      CHECK_EQUAL(0xE3069283UL, crc2);
+    }
+
+#if ETL_USING_CPP14 && !defined(ETL_CRC_FORCE_CPP03_IMPLEMENTATION) && !ETL_USING_CRC32C_INSTRUCTIONS
+    //*************************************************************************
+    TEST(test_crc32_c_t4096_constexpr)
+    {
+      constexpr char     data[] = "123456789";
+      constexpr uint32_t crc    = etl::crc32_c_t4096(data, data + 9);
+
+      CHECK_EQUAL(0xE3069283UL, crc);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_crc32_c_t4096_add_values_and_ranges)
+    {
+      std::string data("123456789");
+
+      etl::crc32_c_t4096 crc_calculator;
+
+      crc_calculator.add(static_cast<uint8_t>(data[0]));
+      crc_calculator.add(data.data() + 1, data.data() + 4);
+      crc_calculator.add(data.begin() + 4, data.end());
+
+      CHECK_EQUAL(0xE3069283UL, crc_calculator.value());
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_c_t4096_matches_256_table_for_all_lengths_and_offsets)
+    {
+      std::vector<uint8_t> data(100U);
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        data[i] = static_cast<uint8_t>((i * 151U) + 7U);
+      }
+
+      for (size_t offset = 0UL; offset < 8UL; ++offset)
+      {
+        for (size_t length = 0UL; length <= (data.size() - offset); ++length)
+        {
+          const uint8_t* begin = data.data() + offset;
+
+          CHECK_EQUAL(uint32_t(etl::crc32_c_t256(begin, begin + length)), uint32_t(etl::crc32_c_t4096(begin, begin + length)));
+        }
+      }
+    }
   }
 } // namespace
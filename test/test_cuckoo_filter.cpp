@@ -0,0 +1,292 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <stdint.h>
+#include <vector>
+
+#include "etl/cuckoo_filter.h"
+
+#include "etl/char_traits.h"
+#include "etl/fnv_1.h"
+
+namespace
+{
+  struct text_hash_t
+  {
+    size_t operator()(const char* text) const
+    {
+      return etl::fnv_1a_32(text, text + etl::char_traits<char>::length(text));
+    }
+  };
+
+  std::vector<const char*> exist_text     = {"The", "rain", "in", "Spain", "falls", "mainly", "on", "the", "plain"};
+  std::vector<const char*> not_exist_text = {"My", "hovercraft", "is", "full", "of", "eels"};
+
+  SUITE(test_cuckoo_filter)
+  {
+    //*************************************************************************
+    TEST(test_add_exists)
+    {
+      etl::cuckoo_filter<const char*, 64, text_hash_t> filter;
+
+      for (size_t i = 0UL; i < exist_text.size(); ++i)
+      {
+        CHECK(filter.add(exist_text[i]));
+      }
+
+      // Check for false negatives.
+      bool all_exist = true;
+
+      for (size_t i = 0UL; i < exist_text.size(); ++i)
+      {
+        all_exist = all_exist && filter.exists(exist_text[i]);
+      }
+
+      CHECK(all_exist);
+
+      // Check for false positives. There should be none for this set.
+      bool any_exist = false;
+
+      for (size_t i = 0UL; i < not_exist_text.size(); ++i)
+      {
+        any_exist = any_exist || filter.exists(not_exist_text[i]);
+      }
+
+      CHECK(!any_exist);
+      CHECK_EQUAL(exist_text.size(), filter.count());
+    }
+
+    //*************************************************************************
+    TEST(test_remove)
+    {
+      etl::cuckoo_filter<const char*, 64, text_hash_t> filter;
+
+      for (size_t i = 0UL; i < exist_text.size(); ++i)
+      {
+        filter.add(exist_text[i]);
+      }
+
+      CHECK(filter.remove(exist_text[1]));
+      CHECK(filter.remove(exist_text[4]));
+
+      CHECK(!filter.exists(exist_text[1]));
+      CHECK(!filter.exists(exist_text[4]));
+      CHECK(filter.exists(exist_text[0]));
+      CHECK(filter.exists(exist_text[8]));
+      CHECK_EQUAL(exist_text.size() - 2U, filter.count());
+
+      // Not in the filter.
+      CHECK(!filter.remove(exist_text[1]));
+      CHECK(!filter.remove(not_exist_text[0]));
+      CHECK_EQUAL(exist_text.size() - 2U, filter.count());
+    }
+
+    //*************************************************************************
+    TEST(test_duplicates)
+    {
+      etl::cuckoo_filter<int, 16> filter;
+
+      filter.add(42);
+      filter.add(42);
+
+      CHECK_EQUAL(2U, filter.count());
+
+      // Each add is matched by a remove.
+      CHECK(filter.remove(42));
+      CHECK(filter.exists(42));
+      CHECK(filter.remove(42));
+      CHECK(!filter.exists(42));
+      CHECK_EQUAL(0U, filter.count());
+    }
+
+    //*************************************************************************
+    TEST(test_sizes)
+    {
+      typedef etl::cuckoo_filter<int, 1000> Filter;
+      Filter                                filter;
+
+      // 1000 keys need 278 buckets at 90%, rounded up to 512.
+      CHECK_EQUAL(512U, Filter::BUCKETS);
+      CHECK_EQUAL(2048U, Filter::SLOTS);
+      CHECK_EQUAL(2048U, filter.width());
+      CHECK_EQUAL(0U, filter.usage());
+      CHECK(!filter.full());
+    }
+
+    //*************************************************************************
+    TEST(test_churn)
+    {
+      // A table that keeps 1000 keys, replacing the oldest with a new one.
+      static etl::cuckoo_filter<uint32_t, 1000> filter;
+
+      const uint32_t Live = 1000U;
+
+      bool all_added = true;
+
+      for (uint32_t key = 0U; key < Live; ++key)
+      {
+        all_added = all_added && filter.add(key);
+      }
+
+      for (uint32_t key = Live; key < (Live * 20U); ++key)
+      {
+        all_added = all_added && filter.remove(key - Live);
+        all_added = all_added && filter.add(key);
+      }
+
+      CHECK(all_added);
+      CHECK_EQUAL(Live, filter.count());
+
+      size_t false_negatives = 0U;
+      size_t false_positives = 0U;
+
+      for (uint32_t key = 0U; key < (Live * 19U); ++key)
+      {
+        false_positives += filter.exists(key) ? 1U : 0U;
+      }
+
+      for (uint32_t key = (Live * 19U); key < (Live * 20U); ++key)
+      {
+        false_negatives += filter.exists(key) ? 0U : 1U;
+      }
+
+      CHECK_EQUAL(0U, false_negatives);
+
+      // About 0.01% for 16 bit fingerprints at this load.
+      CHECK(false_positives < 20U);
+    }
+
+    //*************************************************************************
+    TEST(test_fill_to_full)
+    {
+      etl::cuckoo_filter<uint32_t, 100, etl::hash<uint32_t>, uint8_t> filter;
+
+      uint32_t key = 0U;
+
+      while (filter.add(key))
+      {
+        ++key;
+      }
+
+      // Cuckoo filters with buckets of four fill to about 95%.
+      CHECK(filter.full());
+      CHECK(key > (filter.width() * 90U / 100U));
+      CHECK_EQUAL(size_t(key), filter.count());
+
+      // Everything added, including the last one, can be found.
+      bool all_exist = true;
+
+      for (uint32_t i = 0U; i < key; ++i)
+      {
+        all_exist = all_exist && filter.exists(i);
+      }
+
+      CHECK(all_exist);
+
+      // Removing keys makes room again.
+      for (uint32_t i = 0U; i < 10U; ++i)
+      {
+        CHECK(filter.remove(i));
+      }
+
+      CHECK(!filter.full());
+      CHECK(filter.add(key));
+      CHECK_EQUAL(size_t(key - 9U), filter.count());
+
+      all_exist = true;
+
+      for (uint32_t i = 10U; i <= key; ++i)
+      {
+        all_exist = all_exist && filter.exists(i);
+      }
+
+      CHECK(all_exist);
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      etl::cuckoo_filter<const char*, 64, text_hash_t> filter;
+
+      for (size_t i = 0UL; i < exist_text.size(); ++i)
+      {
+        filter.add(exist_text[i]);
+      }
+
+      CHECK(filter.usage() > 0U);
+
+      filter.clear();
+
+      CHECK_EQUAL(0U, filter.usage());
+      CHECK_EQUAL(0U, filter.count());
+
+      bool any_exist = false;
+
+      for (size_t i = 0UL; i < exist_text.size(); ++i)
+      {
+        any_exist = any_exist || filter.exists(exist_text[i]);
+      }
+
+      CHECK(!any_exist);
+    }
+
+    //*************************************************************************
+    TEST(test_false_positive_rate_with_many_buckets)
+    {
+      // More buckets than 2^(32 - 16), so a 32 bit hash would have to share
+      // bits between the bucket index and the 16 bit fingerprint.
+      typedef etl::cuckoo_filter<uint64_t, 600000> Filter;
+
+      static Filter filter;
+
+      const uint64_t Added   = 500000U;
+      const uint64_t Queries = 1000000U;
+
+      for (uint64_t key = 0U; key < Added; ++key)
+      {
+        filter.add(key * 0x9E3779B97F4A7C15ULL);
+      }
+
+      size_t false_positives = 0U;
+
+      for (uint64_t key = Added; key < (Added + Queries); ++key)
+      {
+        if (filter.exists(key * 0x9E3779B97F4A7C15ULL))
+        {
+          ++false_positives;
+        }
+      }
+
+      // About 8 * load / 2^16 of the queries, so around 60.
+      // Sharing two bits between the index and fingerprint gives over 130.
+      CHECK(false_positives < 100U);
+    }
+  }
+} // namespace
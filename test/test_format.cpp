@@ -204,7 +204,7 @@ namespace
 
       CHECK_EQUAL("1.0", test_format(s, "{}", 1.0f));
       CHECK_EQUAL("1.234567", test_format(s, "{}", 1.234567f));
-      CHECK_EQUAL("1.234567", test_format(s, "{}", 1.2345678f));
+      CHECK_EQUAL("1.2345678", test_format(s, "{}", 1.2345678f));
       CHECK_EQUAL("1.125", test_format(s, "{}", 1.125f));
     }
 
@@ -215,7 +215,7 @@ namespace
 
       CHECK_EQUAL("1.0", test_format(s, "{}", 1.0));
       CHECK_EQUAL("1.234564", test_format(s, "{}", 1.234564));
-      CHECK_EQUAL("1.234567", test_format(s, "{}", 1.2345678));
+      CHECK_EQUAL("1.2345678", test_format(s, "{}", 1.2345678));
       CHECK_EQUAL("1.5", test_format(s, "{}", 1.5));
     }
 
@@ -227,10 +227,66 @@ namespace
       CHECK_EQUAL("1.0", test_format(s, "{}", 1.0l));
       auto& result = test_format(s, "{}", 1.234567l);
       CHECK("1.234567" == result || "1.234566" == result);
-      CHECK_EQUAL("1.234567", test_format(s, "{}", 1.2345678l));
+      CHECK_EQUAL("1.2345678", test_format(s, "{}", 1.2345678l));
       CHECK_EQUAL("1.25", test_format(s, "{}", 1.25l));
     }
 
+    //*************************************************************************
+    TEST(test_format_floating_shortest_round_trip)
+    {
+      etl::string<100> s;
+
+      CHECK_EQUAL("0.1", test_format(s, "{}", 0.1));
+      CHECK_EQUAL("0.1", test_format(s, "{}", 0.1f));
+      CHECK_EQUAL("0.30000000000000004", test_format(s, "{}", 0.1 + 0.2));
+      CHECK_EQUAL("123456789.125", test_format(s, "{}", 123456789.125));
+      CHECK_EQUAL("0.0001", test_format(s, "{}", 0.0001));
+      CHECK_EQUAL("1e-05", test_format(s, "{}", 0.00001));
+      CHECK_EQUAL("1000000000000000.0", test_format(s, "{}", 1e15));
+      CHECK_EQUAL("1e+16", test_format(s, "{}", 1e16));
+      CHECK_EQUAL("1.7976931348623157e+308", test_format(s, "{}", 1.7976931348623157e308));
+      CHECK_EQUAL("5e-324", test_format(s, "{}", 5e-324));
+      CHECK_EQUAL("3.4028235e+38", test_format(s, "{}", 3.4028235e38f));
+      CHECK_EQUAL("0.0", test_format(s, "{}", 0.0));
+      CHECK_EQUAL("-0.0", test_format(s, "{}", -0.0));
+      CHECK_EQUAL("-2.5", test_format(s, "{}", -2.5));
+      CHECK_EQUAL("+2.5", test_format(s, "{:+}", 2.5));
+    }
+
+    //*************************************************************************
+    TEST(test_format_floating_precision)
+    {
+      etl::string<100> s;
+
+      CHECK_EQUAL("2.67", test_format(s, "{:.2f}", 2.675));
+      CHECK_EQUAL("0.10000000000000001", test_format(s, "{:.17f}", 0.1));
+      CHECK_EQUAL("0", test_format(s, "{:.0f}", 0.5));
+      CHECK_EQUAL("2", test_format(s, "{:.0f}", 1.5));
+      CHECK_EQUAL("1.", test_format(s, "{:#.0f}", 1.0));
+      CHECK_EQUAL("-0.50", test_format(s, "{:.2f}", -0.5));
+      CHECK_EQUAL("1.234e+04", test_format(s, "{:.3e}", 12345.0));
+      CHECK_EQUAL("1.235e+04", test_format(s, "{:.3e}", 12346.0));
+      CHECK_EQUAL("1.000e+05", test_format(s, "{:.3e}", 99999.0));
+      CHECK_EQUAL("1e+22", test_format(s, "{:.0e}", 1e22));
+      CHECK_EQUAL("1.00e-300", test_format(s, "{:.2e}", 1e-300));
+      CHECK_EQUAL("1.5e+100", test_format(s, "{:.1g}", 1.5e100));
+      CHECK_EQUAL("   3.14", test_format(s, "{:7.2f}", 3.14159));
+    }
+
+    //*************************************************************************
+    TEST(test_format_floating_exact_digits_beyond_64_bits)
+    {
+      etl::string<100> s;
+
+      CHECK_EQUAL("0.10000000000000000555", test_format(s, "{:.20f}", 0.1));
+      CHECK_EQUAL("864569230984345.250000", test_format(s, "{:.6f}", 864569230984345.25));
+      CHECK_EQUAL("1000000000000000019884624838656", test_format(s, "{:.0f}", 1e30));
+      CHECK_EQUAL("1.00000000000000005551e-01", test_format(s, "{:.20e}", 0.1));
+      CHECK_EQUAL("9.9999999999999991611392e+22", test_format(s, "{:.22e}", 1e23));
+      CHECK_EQUAL("4.9406564584124654e-324", test_format(s, "{:.16e}", 4.9406564584124654e-324));
+      CHECK_EQUAL("0.100000001490116119384765625000", test_format(s, "{:.30f}", 0.1f));
+    }
+
     //*************************************************************************
     TEST(test_format_float_presentation)
     {
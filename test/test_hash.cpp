@@ -29,6 +29,7 @@ SOFTWARE.
 #include "unit_test_framework.h"
 
 #include <iterator>
+#include <set>
 #include <stdint.h>
 #include <string>
 #include <type_traits>
@@ -240,6 +241,30 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(test_buffer_hash)
+    {
+      const char     text[] = "The quick brown fox jumps over the lazy dog";
+      const uint8_t* begin  = reinterpret_cast<const uint8_t*>(text);
+      const uint8_t* end    = begin + sizeof(text) - 1U;
+
+      size_t hash = etl::private_hash::buffer_hash<size_t>(begin, end);
+
+#if ETL_USING_WYHASH_FOR_HASH
+      // Strings, views, spans and blobs use wyhash, folded to size_t.
+      uint64_t expected = etl::wyhash(begin, end).value();
+
+      if (sizeof(size_t) == sizeof(uint32_t))
+      {
+        expected ^= (expected >> 32U);
+      }
+
+      CHECK_EQUAL(static_cast<size_t>(expected), hash);
+#else
+      CHECK_EQUAL(etl::private_hash::generic_hash<size_t>(begin, end), hash);
+#endif
+    }
+
     //*************************************************************************
     TEST(test_hash_pointer)
     {
@@ -331,5 +356,96 @@ namespace
       CHECK_TRUE(std::is_copy_assignable<custom_hasher>::value);
       CHECK_TRUE(std::is_move_assignable<custom_hasher>::value);
     }
+
+    //*************************************************************************
+    TEST(test_identity_hash_finaliser)
+    {
+      etl::identity_hash_finaliser finaliser;
+
+      CHECK_EQUAL(size_t(0U), finaliser(0U));
+      CHECK_EQUAL(size_t(0x12345678UL), finaliser(0x12345678UL));
+    }
+
+    //*************************************************************************
+    TEST(test_fibonacci_hash_finaliser)
+    {
+      etl::fibonacci_hash_finaliser finaliser;
+
+      if (sizeof(size_t) == sizeof(uint64_t))
+      {
+        uint64_t x = uint64_t(1U) * 0x9E3779B97F4A7C15ULL; // 1 ^ (1 >> 32) == 1
+        CHECK_EQUAL(size_t(etl::reverse_bytes(x)), finaliser(1U));
+      }
+      else
+      {
+        uint32_t x = uint32_t(1U) * 0x9E3779B9UL; // 1 ^ (1 >> 16) == 1
+        CHECK_EQUAL(size_t(etl::reverse_bytes(x)), finaliser(1U));
+      }
+
+      // Keys that only differ in their high bits must not share their low bits.
+      const size_t high = size_t(1U) << ((sizeof(size_t) * 8U) - 1U);
+      CHECK((finaliser(high) & 0xFFU) != (finaliser(0U) & 0xFFU));
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_hash_finaliser)
+    {
+      etl::murmur3_hash_finaliser finaliser;
+
+      if (sizeof(size_t) == sizeof(uint64_t))
+      {
+        // Reference values for murmur3 fmix64.
+        CHECK_EQUAL(size_t(0x0000000000000000ULL), finaliser(size_t(0x0000000000000000ULL)));
+        CHECK_EQUAL(size_t(0xB456BCFC34C2CB2CULL), finaliser(size_t(0x0000000000000001ULL)));
+      }
+      else
+      {
+        // Reference values for murmur3 fmix32.
+        CHECK_EQUAL(size_t(0x00000000UL), finaliser(size_t(0x00000000UL)));
+        CHECK_EQUAL(size_t(0x514E28B7UL), finaliser(size_t(0x00000001UL)));
+      }
+
+      const size_t high = size_t(1U) << ((sizeof(size_t) * 8U) - 1U);
+      CHECK((finaliser(high) & 0xFFU) != (finaliser(0U) & 0xFFU));
+    }
+
+    //*************************************************************************
+    TEST(test_finalised_hash)
+    {
+      typedef etl::finalised_hash<etl::hash<uint32_t> >                              fibonacci_hash;
+      typedef etl::finalised_hash<etl::hash<uint32_t>, etl::murmur3_hash_finaliser>  murmur3_hash;
+      typedef etl::finalised_hash<etl::hash<uint32_t>, etl::identity_hash_finaliser> identity_hash;
+
+      CHECK_EQUAL(etl::fibonacci_hash_finaliser()(etl::hash<uint32_t>()(1234U)), fibonacci_hash()(1234U));
+      CHECK_EQUAL(etl::murmur3_hash_finaliser()(etl::hash<uint32_t>()(1234U)), murmur3_hash()(1234U));
+      CHECK_EQUAL(etl::hash<uint32_t>()(1234U), identity_hash()(1234U));
+    }
+
+    //*************************************************************************
+    TEST(test_finalised_hash_spreads_identity_hash)
+    {
+      typedef etl::finalised_hash<etl::hash<uint32_t> >                             fibonacci_hash;
+      typedef etl::finalised_hash<etl::hash<uint32_t>, etl::murmur3_hash_finaliser> murmur3_hash;
+
+      etl::hash<uint32_t> identity;
+      fibonacci_hash      fibonacci;
+      murmur3_hash        murmur3;
+
+      // With the identity hash, keys that are multiples of 16 all select bucket 0 of 16.
+      std::set<size_t> identity_buckets;
+      std::set<size_t> fibonacci_buckets;
+      std::set<size_t> murmur3_buckets;
+
+      for (uint32_t i = 0U; i < 16U; ++i)
+      {
+        identity_buckets.insert(identity(i * 16U) & 15U);
+        fibonacci_buckets.insert(fibonacci(i * 16U) & 15U);
+        murmur3_buckets.insert(murmur3(i * 16U) & 15U);
+      }
+
+      CHECK_EQUAL(1U, identity_buckets.size());
+      CHECK(fibonacci_buckets.size() > 4U);
+      CHECK(murmur3_buckets.size() > 4U);
+    }
   }
 } // namespace
@@ -33,6 +33,9 @@ SOFTWARE.
 #include "etl/message_router.h"
 #include "etl/packet.h"
 #include "etl/queue.h"
+#include "etl/reference_counted_message.h"
+#include "etl/shared_message.h"
+#include "etl/span.h"
 
 //***************************************************************************
 // The set of messages.
@@ -243,12 +246,18 @@ namespace
 
     RouterC(etl::message_router_id_t id)
       : message_router(id)
+      , message6_count(0)
     {
     }
 
-    void on_receive(const Message6&) {}
+    void on_receive(const Message6&)
+    {
+      ++message6_count;
+    }
 
     void on_receive_unknown(const etl::imessage&) {}
+
+    int message6_count;
   };
 
   //***************************************************************************
@@ -1003,5 +1012,149 @@ namespace
       CHECK_TRUE(bus1.accepts(MESSAGE6));
       CHECK_FALSE(bus1.accepts(MESSAGE7));
     }
+
+    //*************************************************************************
+    TEST(message_bus_indexed_broadcast)
+    {
+      // Message ids below MESSAGE5 are indexed.
+      etl::message_bus<4, MESSAGE5> bus1;
+      MessageBus<2>                 bus2;
+
+      RouterA router1(ROUTER1);
+      RouterB router2(ROUTER2);
+      RouterC router3(ROUTER3);
+      RouterA router4(ROUTER4);
+
+      RouterA callback(ROUTER5);
+
+      bus1.subscribe(router1);
+      bus1.subscribe(router2);
+      bus1.subscribe(bus2);
+      bus1.subscribe(router3);
+
+      bus2.subscribe(router4);
+
+      Message1 message1(callback);
+      Message3 message3(callback);
+      Message6 message6;
+
+      bus1.receive(message1); // Indexed
+      bus1.receive(message3); // Indexed, not accepted by router2
+      bus1.receive(message6); // Not indexed
+      bus1.receive(response); // Not indexed
+
+      CHECK_EQUAL(1, router1.message1_count);
+      CHECK_EQUAL(1, router1.message3_count);
+      CHECK_EQUAL(1, router1.message5_count);
+      CHECK_EQUAL(0, router1.message_unknown_count);
+
+      CHECK_EQUAL(1, router2.message1_count);
+      CHECK_EQUAL(1, router2.message5_count);
+      CHECK_EQUAL(0, router2.message_unknown_count);
+
+      CHECK_EQUAL(1, router3.message6_count);
+
+      CHECK_EQUAL(1, router4.message1_count);
+      CHECK_EQUAL(1, router4.message3_count);
+      CHECK_EQUAL(1, router4.message5_count);
+      CHECK_EQUAL(0, router4.message_unknown_count);
+
+      CHECK_EQUAL(5, callback.message5_count);
+      CHECK_EQUAL(3, bus2.message_count);
+
+      // The index follows the subscriptions.
+      bus1.unsubscribe(router1);
+
+      bus1.receive(message1);
+
+      CHECK_EQUAL(1, router1.message1_count);
+      CHECK_EQUAL(2, router2.message1_count);
+      CHECK_EQUAL(2, router4.message1_count);
+
+      CHECK_TRUE(bus1.accepts(MESSAGE3)); // Through bus2
+
+      bus1.unsubscribe(bus2);
+
+      CHECK_FALSE(bus1.accepts(MESSAGE3));
+      CHECK_TRUE(bus1.accepts(MESSAGE1));
+
+      bus1.clear();
+
+      CHECK_FALSE(bus1.accepts(MESSAGE1));
+    }
+
+    //*************************************************************************
+    TEST(message_bus_receive_shared_messages)
+    {
+      etl::message_bus<2, MESSAGE7 + 1> bus;
+
+      RouterA router1(ROUTER1);
+      RouterC router2(ROUTER2);
+
+      bus.subscribe(router1);
+      bus.subscribe(router2);
+
+      etl::persistent_message<Response> persistent_response(response);
+      etl::persistent_message<Message6> persistent_message6((Message6()));
+
+      etl::shared_message messages[] = {etl::shared_message(persistent_response), etl::shared_message(persistent_message6),
+                                        etl::shared_message(persistent_response)};
+
+      bus.receive(etl::span<etl::shared_message>(messages));
+
+      CHECK_EQUAL(2, router1.message5_count);
+      CHECK_EQUAL(0, router1.message_unknown_count);
+      CHECK_EQUAL(1, router2.message6_count);
+
+      // Addressed.
+      bus.receive(ROUTER2, etl::span<etl::shared_message>(messages));
+
+      CHECK_EQUAL(2, router1.message5_count);
+      CHECK_EQUAL(2, router2.message6_count);
+    }
+
+    //*************************************************************************
+    TEST(message_bus_receive_shared_messages_through_buses)
+    {
+      etl::message_bus<3> bus1;
+      etl::message_bus<1> bus2;
+      etl::message_bus<1> bus3;
+
+      RouterA router1(ROUTER1);
+      RouterC router2(ROUTER2);
+      RouterA router3(ROUTER1);
+      RouterA router4(ROUTER1);
+
+      bus1.subscribe(router1);
+      bus1.subscribe(router2);
+      bus1.subscribe(bus2);
+      bus1.set_successor(bus3);
+
+      bus2.subscribe(router3);
+      bus3.subscribe(router4);
+
+      etl::persistent_message<Response> persistent_response(response);
+      etl::persistent_message<Message6> persistent_message6((Message6()));
+
+      etl::shared_message messages[] = {etl::shared_message(persistent_response), etl::shared_message(persistent_message6),
+                                        etl::shared_message(persistent_response)};
+
+      // Addressed.
+      bus1.receive(ROUTER1, etl::span<etl::shared_message>(messages));
+
+      CHECK_EQUAL(2, router1.message5_count);
+      CHECK_EQUAL(0, router1.message_unknown_count);
+      CHECK_EQUAL(0, router2.message6_count);
+      CHECK_EQUAL(2, router3.message5_count);
+      CHECK_EQUAL(2, router4.message5_count);
+
+      // Broadcast.
+      bus1.receive(etl::span<etl::shared_message>(messages));
+
+      CHECK_EQUAL(4, router1.message5_count);
+      CHECK_EQUAL(1, router2.message6_count);
+      CHECK_EQUAL(4, router3.message5_count);
+      CHECK_EQUAL(4, router4.message5_count);
+    }
   }
 } // namespace
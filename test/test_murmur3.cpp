@@ -135,5 +135,70 @@ namespace
       MurmurHash3_x86_32((uint8_t*)&data2[0], data2.size() * sizeof(uint32_t), 0, &compare2);
       CHECK_EQUAL(compare2, hash2);
     }
+
+    //*************************************************************************
+    TEST(test_murmur3_32_contiguous_unaligned_lengths_and_offsets)
+    {
+      uint8_t data[80];
+
+      for (size_t i = 0UL; i < sizeof(data); ++i)
+      {
+        data[i] = static_cast<uint8_t>((i * 37U) + 0x80U);
+      }
+
+      for (size_t offset = 0UL; offset < 4UL; ++offset)
+      {
+        for (size_t length = 0UL; length < (sizeof(data) - offset); ++length)
+        {
+          const uint8_t* begin = data + offset;
+
+          uint32_t hash = etl::murmur3<uint32_t>(begin, begin + length);
+
+          uint32_t compare;
+          MurmurHash3_x86_32(begin, static_cast<uint32_t>(length), 0, &compare);
+
+          CHECK_EQUAL(compare, hash);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_32_contiguous_after_partial_block)
+    {
+      const char data[] = "The quick brown fox jumps over the lazy dog";
+      const size_t length = sizeof(data) - 1U;
+
+      for (size_t split = 0UL; split <= length; ++split)
+      {
+        etl::murmur3<uint32_t> murmur3_32_calculator;
+
+        for (size_t i = 0UL; i < split; ++i)
+        {
+          murmur3_32_calculator.add(static_cast<uint8_t>(data[i]));
+        }
+
+        murmur3_32_calculator.add(data + split, data + length);
+
+        uint32_t compare;
+        MurmurHash3_x86_32(data, static_cast<uint32_t>(length), 0, &compare);
+
+        CHECK_EQUAL(compare, murmur3_32_calculator.value());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_32_contiguous_matches_iterator)
+    {
+      std::string data("\x80\xFF\x01\xFEhigh bit characters\xC3\xA9");
+
+      uint32_t hash1 = etl::murmur3<uint32_t>(data.begin(), data.end());
+      uint32_t hash2 = etl::murmur3<uint32_t>(data.data(), data.data() + data.size());
+
+      uint32_t compare;
+      MurmurHash3_x86_32(data.data(), static_cast<uint32_t>(data.size()), 0, &compare);
+
+      CHECK_EQUAL(compare, hash1);
+      CHECK_EQUAL(compare, hash2);
+    }
   }
 } // namespace
@@ -494,7 +494,7 @@ namespace
       etl::poly_span<int, 4U> s1(data);
 
       size_t hashdata =
-        etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&s1[0]), reinterpret_cast<const uint8_t*>(&s1[s1.size()]));
+        etl::private_hash::buffer_hash<size_t>(reinterpret_cast<const uint8_t*>(&s1[0]), reinterpret_cast<const uint8_t*>(&s1[s1.size()]));
 
       size_t hashview = etl::hash<etl::poly_span<int, 4U>>()(s1);
 
@@ -29,10 +29,12 @@ SOFTWARE.
 #include "unit_test_framework.h"
 
 #include "etl/quantize.h"
+#include "etl/functional.h"
 
 #include <algorithm>
 #include <array>
 #include <math.h>
+#include <vector>
 
 namespace
 {
@@ -96,5 +98,124 @@ namespace
       bool isEqual = std::equal(output2.begin(), output2.end(), result2a.begin(), Compare());
       CHECK(isEqual);
     }
+
+    //*************************************************************************
+    TEST(test_int_quantize_sorted)
+    {
+      IntQuantize quantize(etl::sorted_thresholds, thresholds1.data(), quantizations1.data(), quantizations1.size());
+
+      std::transform(input1.begin(), input1.end(), output1.begin(), quantize);
+
+      bool isEqual = std::equal(output1.begin(), output1.end(), result1a.begin());
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST(test_double_quantize_sorted)
+    {
+      DoubleQuantize quantize(etl::sorted_thresholds, thresholds2.data(), quantizations2.data(), quantizations2.size());
+
+      std::transform(input2.begin(), input2.end(), output2.begin(), quantize);
+
+      bool isEqual = std::equal(output2.begin(), output2.end(), result2a.begin(), Compare());
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST(test_int_quantize_sorted_greater)
+    {
+      const std::array<int, NThresholds> thresholds = {25, 22, 18, 14};
+
+      const std::array<int, Size> result = {5, 5, 5, 5, 5, 4, 4, 4, 4, 3, 3, 3, 3, 2, 2, 2, 1, 1, 1, 1};
+
+      etl::quantize<int, etl::greater<int>> linear(thresholds.data(), quantizations1.data(), quantizations1.size());
+      etl::quantize<int, etl::greater<int>> sorted(etl::sorted_thresholds, thresholds.data(), quantizations1.data(), quantizations1.size());
+
+      for (size_t i = 0UL; i < Size; ++i)
+      {
+        CHECK_EQUAL(result[i], linear(input1[i]));
+        CHECK_EQUAL(result[i], sorted(input1[i]));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_int_quantize_span)
+    {
+      IntQuantize linear(thresholds1.data(), quantizations1.data(), quantizations1.size());
+      IntQuantize sorted(etl::sorted_thresholds, thresholds1.data(), quantizations1.data(), quantizations1.size());
+
+      output1.fill(0);
+      linear(etl::span<const int>(input1.data(), input1.size()), etl::span<int>(output1.data(), output1.size()));
+      CHECK(std::equal(output1.begin(), output1.end(), result1a.begin()));
+
+      output1.fill(0);
+      sorted(etl::span<const int>(input1.data(), input1.size()), etl::span<int>(output1.data(), output1.size()));
+      CHECK(std::equal(output1.begin(), output1.end(), result1a.begin()));
+
+      // Only as many as the shorter span.
+      output1.fill(0);
+      sorted(etl::span<const int>(input1.data(), input1.size()), etl::span<int>(output1.data(), Size - 1U));
+      CHECK(std::equal(output1.begin(), output1.end() - 1, result1a.begin()));
+      CHECK_EQUAL(0, output1.back());
+    }
+
+    //*************************************************************************
+    TEST(test_quantize_sorted_many_levels)
+    {
+      const size_t Levels  = 256UL;
+      const size_t Samples = 1001UL;
+
+      std::vector<int> thresholds;
+      std::vector<int> quantizations;
+
+      for (size_t i = 0UL; i < Levels; ++i)
+      {
+        quantizations.push_back(int(i));
+
+        if (i != 0UL)
+        {
+          thresholds.push_back(int(i * 7UL) - 900);
+        }
+      }
+
+      std::vector<int> input;
+      uint32_t         x = 1U;
+
+      for (size_t i = 0UL; i < Samples; ++i)
+      {
+        x = (x * 1664525U) + 1013904223U;
+        input.push_back(int(x % 2000U) - 1000);
+      }
+
+      // Exact threshold values.
+      input[0] = thresholds.front();
+      input[1] = thresholds.back();
+
+      IntQuantize linear(thresholds.data(), quantizations.data(), quantizations.size());
+      IntQuantize sorted(etl::sorted_thresholds, thresholds.data(), quantizations.data(), quantizations.size());
+
+      std::vector<int> output(Samples);
+      sorted(etl::span<const int>(input.data(), input.size()), etl::span<int>(output.data(), output.size()));
+
+      for (size_t i = 0UL; i < Samples; ++i)
+      {
+        CHECK_EQUAL(linear(input[i]), sorted(input[i]));
+        CHECK_EQUAL(linear(input[i]), output[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_quantize_sorted_single_level)
+    {
+      const int quantization = 42;
+
+      IntQuantize sorted(etl::sorted_thresholds, ETL_NULLPTR, &quantization, 1U);
+
+      std::array<int, 5> output = {};
+      sorted(etl::span<const int>(input1.data(), 5U), etl::span<int>(output.data(), output.size()));
+
+      CHECK_EQUAL(42, sorted(10));
+      CHECK(std::all_of(output.begin(), output.end(), [](int value) { return value == 42; }));
+    }
   }
 } // namespace
@@ -0,0 +1,732 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "etl/queue_mpmc_atomic.h"
+
+#include "data.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  struct Data
+  {
+    Data(int a_, int b_ = 2, int c_ = 3, int d_ = 4)
+      : a(a_)
+      , b(b_)
+      , c(c_)
+      , d(d_)
+    {
+    }
+
+    Data()
+      : a(0)
+      , b(0)
+      , c(0)
+      , d(0)
+    {
+    }
+
+    int a;
+    int b;
+    int c;
+    int d;
+  };
+
+  bool operator==(const Data& lhs, const Data& rhs)
+  {
+    return (lhs.a == rhs.a) && (lhs.b == rhs.b) && (lhs.c == rhs.c) && (lhs.d == rhs.d);
+  }
+
+  using ItemM = TestDataM<int>;
+
+  SUITE(test_queue_mpmc_atomic)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      CHECK_EQUAL(4U, queue.max_size());
+      CHECK_EQUAL(4U, queue.capacity());
+    }
+
+    //*************************************************************************
+    TEST(test_size_push_pop)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      CHECK_EQUAL(0U, queue.size());
+
+      CHECK_EQUAL(4U, queue.available());
+      CHECK_EQUAL(0U, queue.size());
+
+      queue.push(1);
+      CHECK_EQUAL(1U, queue.size());
+      CHECK_EQUAL(3U, queue.available());
+
+      queue.push(2);
+      CHECK_EQUAL(2U, queue.size());
+      CHECK_EQUAL(2U, queue.available());
+
+      queue.push(3);
+      CHECK_EQUAL(3U, queue.size());
+      CHECK_EQUAL(1U, queue.available());
+
+      queue.push(4);
+      CHECK_EQUAL(4U, queue.size());
+      CHECK_EQUAL(0U, queue.available());
+
+      // Queue full.
+      CHECK(!queue.push(5));
+
+      queue.pop();
+      // Queue not full (buffer rollover)
+      CHECK(queue.push(5));
+
+      // Queue full.
+      CHECK(!queue.push(6));
+
+      queue.pop();
+      // Queue not full (buffer rollover)
+      CHECK(queue.push(6));
+
+      int i;
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(3, i);
+      CHECK_EQUAL(3U, queue.size());
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(4, i);
+      CHECK_EQUAL(2U, queue.size());
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(5, i);
+      CHECK_EQUAL(1U, queue.size());
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(6, i);
+      CHECK_EQUAL(0U, queue.size());
+
+      CHECK(!queue.pop(i));
+      CHECK(!queue.pop(i));
+    }
+
+  #if !defined(ETL_FORCE_TEST_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    TEST(test_move_push_pop)
+    {
+      etl::queue_mpmc_atomic<ItemM, 4, etl::memory_model::MEMORY_MODEL_SMALL> queue;
+
+      ItemM p1(1);
+      ItemM p2(2);
+      ItemM p3(3);
+      ItemM p4(4);
+
+      queue.push(std::move(p1));
+      queue.push(std::move(p2));
+      queue.push(std::move(p3));
+      queue.push(std::move(p4));
+
+      CHECK(!bool(p1));
+      CHECK(!bool(p2));
+      CHECK(!bool(p3));
+      CHECK(!bool(p4));
+
+      ItemM pr(0);
+
+      queue.pop(pr);
+      CHECK_EQUAL(1, pr.value);
+
+      queue.pop(pr);
+      CHECK_EQUAL(2, pr.value);
+
+      queue.pop(pr);
+      CHECK_EQUAL(3, pr.value);
+
+      queue.pop(pr);
+      CHECK_EQUAL(4, pr.value);
+    }
+  #endif
+
+    //*************************************************************************
+    TEST(test_size_push_pop_iqueue)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      etl::iqueue_mpmc_atomic<int>& iqueue = queue;
+
+      CHECK_EQUAL(0U, iqueue.size());
+
+      iqueue.push(1);
+      CHECK_EQUAL(1U, iqueue.size());
+
+      iqueue.push(2);
+      CHECK_EQUAL(2U, iqueue.size());
+
+      iqueue.push(3);
+      CHECK_EQUAL(3U, iqueue.size());
+
+      iqueue.push(4);
+      CHECK_EQUAL(4U, iqueue.size());
+
+      CHECK(!iqueue.push(5));
+      CHECK(!iqueue.push(5));
+
+      int i;
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(1, i);
+      CHECK_EQUAL(3U, iqueue.size());
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(2, i);
+      CHECK_EQUAL(2U, iqueue.size());
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(3, i);
+      CHECK_EQUAL(1U, iqueue.size());
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(4, i);
+      CHECK_EQUAL(0U, iqueue.size());
+
+      CHECK(!iqueue.pop(i));
+      CHECK(!iqueue.pop(i));
+    }
+
+    //*************************************************************************
+    TEST(test_size_push_pop_void)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      CHECK_EQUAL(0U, queue.size());
+
+      queue.push(1);
+      CHECK_EQUAL(1U, queue.size());
+
+      queue.push(2);
+      CHECK_EQUAL(2U, queue.size());
+
+      queue.push(3);
+      CHECK_EQUAL(3U, queue.size());
+
+      queue.push(4);
+      CHECK_EQUAL(4U, queue.size());
+
+      CHECK(!queue.push(5));
+      CHECK(!queue.push(5));
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(3U, queue.size());
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(2U, queue.size());
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(1U, queue.size());
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(0U, queue.size());
+
+      CHECK(!queue.pop());
+      CHECK(!queue.pop());
+    }
+
+    //*************************************************************************
+    TEST(test_size_push_front_pop)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      CHECK_EQUAL(0U, queue.size());
+
+      queue.push(1);
+      queue.push(2);
+      queue.push(3);
+      queue.push(4);
+      CHECK_EQUAL(4U, queue.size());
+
+      CHECK_EQUAL(1, queue.front());
+      CHECK_EQUAL(4U, queue.size());
+
+      CHECK_EQUAL(1, queue.front());
+      CHECK_EQUAL(4U, queue.size());
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(3U, queue.size());
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(2U, queue.size());
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(1U, queue.size());
+
+      CHECK_EQUAL(4, queue.front());
+      CHECK_EQUAL(1U, queue.size());
+
+      CHECK_EQUAL(4, queue.front());
+      CHECK_EQUAL(1U, queue.size());
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(0U, queue.size());
+    }
+
+    //*************************************************************************
+    TEST(test_multiple_emplace)
+    {
+      etl::queue_mpmc_atomic<Data, 5> queue;
+
+      queue.emplace();
+      queue.emplace(1);
+      queue.emplace(1, 2);
+      queue.emplace(1, 2, 3);
+      queue.emplace(1, 2, 3, 4);
+
+      CHECK_EQUAL(5U, queue.size());
+
+      Data popped;
+
+      queue.pop(popped);
+      CHECK(popped == Data(0, 0, 0, 0));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      CHECK_EQUAL(0U, queue.size());
+
+      queue.push(1);
+      queue.push(2);
+      queue.clear();
+      CHECK_EQUAL(0U, queue.size());
+
+      // Do it again to check that clear() didn't screw up the internals.
+      queue.push(1);
+      queue.push(2);
+      CHECK_EQUAL(2U, queue.size());
+      queue.clear();
+      CHECK_EQUAL(0U, queue.size());
+    }
+
+    //*************************************************************************
+    TEST(test_empty)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+      CHECK(queue.empty());
+
+      queue.push(1);
+      CHECK(!queue.empty());
+
+      queue.clear();
+      CHECK(queue.empty());
+
+      queue.push(1);
+      CHECK(!queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+      CHECK(!queue.full());
+
+      queue.push(1);
+      queue.push(2);
+      queue.push(3);
+      queue.push(4);
+      CHECK(queue.full());
+
+      queue.clear();
+      CHECK(!queue.full());
+
+      queue.push(1);
+      queue.push(2);
+      queue.push(3);
+      queue.push(4);
+      CHECK(queue.full());
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop_span)
+    {
+      etl::queue_mpmc_atomic<int, 6> queue;
+
+      const int input[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+      int       output[8] = { 0 };
+
+      CHECK_EQUAL(0U, queue.push(etl::span<const int>(input, size_t(0))));
+      CHECK_EQUAL(4U, queue.push(etl::span<const int>(input, 4U)));
+      CHECK_EQUAL(4U, queue.size());
+
+      // Only two of the remaining four fit.
+      CHECK_EQUAL(2U, queue.push(etl::span<const int>(input + 4, 4U)));
+      CHECK_EQUAL(6U, queue.size());
+      CHECK(queue.full());
+      CHECK_EQUAL(0U, queue.push(etl::span<const int>(input + 6, 2U)));
+
+      CHECK_EQUAL(3U, queue.pop(etl::span<int>(output, 3U)));
+      CHECK_EQUAL(1, output[0]);
+      CHECK_EQUAL(2, output[1]);
+      CHECK_EQUAL(3, output[2]);
+      CHECK_EQUAL(3U, queue.size());
+
+      // Wraps around the end of the buffer.
+      CHECK_EQUAL(2U, queue.push(etl::span<const int>(input + 6, 2U)));
+      CHECK_EQUAL(5U, queue.size());
+
+      // Asks for more than is available.
+      CHECK_EQUAL(5U, queue.pop(etl::span<int>(output, 8U)));
+      CHECK_EQUAL(4, output[0]);
+      CHECK_EQUAL(5, output[1]);
+      CHECK_EQUAL(6, output[2]);
+      CHECK_EQUAL(7, output[3]);
+      CHECK_EQUAL(8, output[4]);
+      CHECK(queue.empty());
+
+      CHECK_EQUAL(0U, queue.pop(etl::span<int>(output, 8U)));
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop_span_mixed_with_single)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      const int input[] = { 2, 3, 4 };
+      int       output[4] = { 0 };
+
+      CHECK(queue.push(1));
+      CHECK_EQUAL(3U, queue.push(etl::span<const int>(input, 3U)));
+      CHECK(!queue.push(5));
+
+      int i;
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(1, i);
+      CHECK(queue.push(5));
+
+      CHECK_EQUAL(4U, queue.pop(etl::span<int>(output, 4U)));
+      CHECK_EQUAL(2, output[0]);
+      CHECK_EQUAL(3, output[1]);
+      CHECK_EQUAL(4, output[2]);
+      CHECK_EQUAL(5, output[3]);
+      CHECK(!queue.pop(i));
+    }
+
+    //*************************************************************************
+    TEST(test_positions_on_separate_cache_lines)
+    {
+      CHECK(sizeof(etl::queue_mpmc_atomic<char, 1>) >= (3 * ETL_CACHE_LINE_SIZE));
+    }
+
+  #if !defined(ETL_FORCE_TEST_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    TEST(test_pop_span_non_trivial)
+    {
+      etl::queue_mpmc_atomic<ItemM, 4> queue;
+
+      queue.push(ItemM(1));
+      queue.push(ItemM(2));
+      queue.push(ItemM(3));
+
+      ItemM output[4] = { ItemM(0), ItemM(0), ItemM(0), ItemM(0) };
+
+      CHECK_EQUAL(3U, queue.pop(etl::span<ItemM>(output, 4U)));
+      CHECK_EQUAL(1, output[0].value);
+      CHECK_EQUAL(2, output[1].value);
+      CHECK_EQUAL(3, output[2].value);
+      CHECK(queue.empty());
+    }
+  #endif
+
+
+    //*************************************************************************
+    TEST(test_many_laps_small_memory_model)
+    {
+      // The positions wrap many times in a uint8_t.
+      etl::queue_mpmc_atomic<int, 5, etl::memory_model::MEMORY_MODEL_SMALL> queue;
+
+      int next_in  = 0;
+      int next_out = 0;
+
+      for (int lap = 0; lap < 1000; ++lap)
+      {
+        while (queue.push(next_in))
+        {
+          ++next_in;
+        }
+
+        CHECK(queue.full());
+        CHECK_EQUAL(5U, queue.size());
+
+        int i;
+
+        for (int j = 0; j < (1 + (lap % 5)); ++j)
+        {
+          CHECK(queue.pop(i));
+          CHECK_EQUAL(next_out, i);
+          ++next_out;
+        }
+      }
+
+      int i;
+
+      while (queue.pop(i))
+      {
+        CHECK_EQUAL(next_out, i);
+        ++next_out;
+      }
+
+      CHECK_EQUAL(next_in, next_out);
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_threads_multiple_producers_and_consumers)
+    {
+      static etl::queue_mpmc_atomic<int, 64> queue;
+
+      const size_t Producers = 4U;
+      const size_t Consumers = 4U;
+      const int    Length    = 50000;
+      const size_t Total     = Producers * size_t(Length);
+
+      std::vector<std::thread>      threads;
+      std::vector<std::vector<int>> received(Consumers);
+      std::atomic<size_t>           popped(0U);
+
+      for (size_t p = 0U; p < Producers; ++p)
+      {
+        threads.push_back(std::thread([p]()
+        {
+          int values[8];
+          int next = 0;
+
+          while (next < Length)
+          {
+            if ((next % 3) == 0)
+            {
+              if (queue.push((int(p) * Length) + next))
+              {
+                ++next;
+              }
+              else
+              {
+                std::this_thread::yield();
+              }
+            }
+            else
+            {
+              size_t n = 0;
+
+              while ((n < 8U) && ((next + int(n)) < Length))
+              {
+                values[n] = (int(p) * Length) + next + int(n);
+                ++n;
+              }
+
+              size_t pushed = queue.push(etl::span<const int>(values, n));
+
+              if (pushed == 0U)
+              {
+                std::this_thread::yield();
+              }
+
+              next += int(pushed);
+            }
+          }
+        }));
+      }
+
+      for (size_t c = 0U; c < Consumers; ++c)
+      {
+        threads.push_back(std::thread([c, &received, &popped, Total]()
+        {
+          int values[5];
+
+          while (popped.load() < Total)
+          {
+            if ((c % 2U) == 0U)
+            {
+              int i;
+
+              if (queue.pop(i))
+              {
+                received[c].push_back(i);
+                ++popped;
+              }
+              else
+              {
+                std::this_thread::yield();
+              }
+            }
+            else
+            {
+              size_t n = queue.pop(etl::span<int>(values, 5U));
+              received[c].insert(received[c].end(), values, values + n);
+              popped += n;
+
+              if (n == 0U)
+              {
+                std::this_thread::yield();
+              }
+            }
+          }
+        }));
+      }
+
+      for (size_t t = 0U; t < threads.size(); ++t)
+      {
+        threads[t].join();
+      }
+
+      std::vector<int> all;
+      bool             per_producer_in_order = true;
+
+      for (size_t c = 0U; c < Consumers; ++c)
+      {
+        // Each consumer sees each producer's values in the order they were pushed.
+        std::vector<int> last(Producers, -1);
+
+        for (size_t i = 0U; i < received[c].size(); ++i)
+        {
+          int    value = received[c][i];
+          size_t p     = size_t(value / Length);
+
+          per_producer_in_order = per_producer_in_order && (value > last[p]);
+          last[p]               = value;
+        }
+
+        all.insert(all.end(), received[c].begin(), received[c].end());
+      }
+
+      std::sort(all.begin(), all.end());
+
+      bool all_received = (all.size() == Total);
+
+      for (size_t i = 0U; all_received && (i < all.size()); ++i)
+      {
+        all_received = (all[i] == int(i));
+      }
+
+      CHECK(per_producer_in_order);
+      CHECK(all_received);
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_threads_small_memory_model)
+    {
+      // The positions wrap a period every 252 pushes, often while a thread is preempted.
+      static etl::queue_mpmc_atomic<int, 4, etl::memory_model::MEMORY_MODEL_SMALL> queue;
+
+      const size_t Producers = 3U;
+      const size_t Consumers = 3U;
+      const int    Length    = 50000;
+      const size_t Total     = Producers * size_t(Length);
+
+      std::vector<std::thread> threads;
+      std::vector<int>         counts(Producers * size_t(Length), 0);
+      std::atomic<size_t>      popped(0U);
+
+      for (size_t p = 0U; p < Producers; ++p)
+      {
+        threads.push_back(std::thread([p]()
+        {
+          int next = 0;
+
+          while (next < Length)
+          {
+            if (queue.push((int(p) * Length) + next))
+            {
+              ++next;
+            }
+            else
+            {
+              std::this_thread::yield();
+            }
+          }
+        }));
+      }
+
+      for (size_t c = 0U; c < Consumers; ++c)
+      {
+        threads.push_back(std::thread([&counts, &popped, Total]()
+        {
+          int i;
+
+          while (popped.load() < Total)
+          {
+            if (queue.pop(i))
+            {
+              ++counts[size_t(i)];
+              ++popped;
+            }
+            else
+            {
+              std::this_thread::yield();
+            }
+          }
+        }));
+      }
+
+      for (size_t t = 0U; t < threads.size(); ++t)
+      {
+        threads[t].join();
+      }
+
+      bool all_received_once = true;
+
+      for (size_t i = 0U; i < counts.size(); ++i)
+      {
+        all_received_once = all_received_once && (counts[i] == 1);
+      }
+
+      CHECK(all_received_once);
+      CHECK(queue.empty());
+    }
+  }
+} // namespace
+
+#endif
@@ -34,6 +34,7 @@ SOFTWARE.
 #include "etl/state_chart.h"
 
 #include <iostream>
+#include <string>
 
 namespace
 {
@@ -227,6 +228,74 @@ namespace
 
   MotorControl motorControl;
 
+  //***********************************
+  // Records the transitions taken, for comparing the indexed and linear
+  // searches of the transition table.
+  //***********************************
+  class Recorder : public etl::state_chart<Recorder>
+  {
+  public:
+
+    Recorder(const transition* begin, const transition* end)
+      : etl::state_chart<Recorder>(*this, begin, end, ETL_NULLPTR, ETL_NULLPTR, 0)
+      , log()
+    {
+    }
+
+    void A() { log += 'A'; }
+    void B() { log += 'B'; }
+    void C() { log += 'C'; }
+    void D() { log += 'D'; }
+    void E() { log += 'E'; }
+    void F() { log += 'F'; }
+
+    bool Pass() { return true; }
+    bool Fail() { return false; }
+
+    std::string log;
+  };
+
+  // Ordered by state, then by event, with the 'from any state' transitions at the end.
+  const Recorder::transition indexedTable[] = {
+    Recorder::transition(0, 0, 1, &Recorder::A, &Recorder::Fail),
+    Recorder::transition(0, 0, 1, &Recorder::B, &Recorder::Pass),
+    Recorder::transition(0, 0, 2, &Recorder::C),
+    Recorder::transition(0, 2, 0, &Recorder::D),
+    Recorder::transition(1, 1, 2, &Recorder::C),
+    Recorder::transition(2, 2, 0, &Recorder::D, &Recorder::Fail),
+    Recorder::transition(0, 1, &Recorder::E, &Recorder::Fail),
+    Recorder::transition(0, 2, &Recorder::F),
+    Recorder::transition(2, 0, &Recorder::E)};
+
+  // The same transitions in an order that has to be searched linearly.
+  const Recorder::transition linearTable[] = {
+    Recorder::transition(1, 1, 2, &Recorder::C),
+    Recorder::transition(2, 2, 0, &Recorder::D, &Recorder::Fail),
+    Recorder::transition(0, 2, 0, &Recorder::D),
+    Recorder::transition(0, 0, 1, &Recorder::A, &Recorder::Fail),
+    Recorder::transition(0, 0, 1, &Recorder::B, &Recorder::Pass),
+    Recorder::transition(0, 0, 2, &Recorder::C),
+    Recorder::transition(0, 1, &Recorder::E, &Recorder::Fail),
+    Recorder::transition(0, 2, &Recorder::F),
+    Recorder::transition(2, 0, &Recorder::E)};
+
+  //***********************************
+  std::string RecordEvents(const Recorder::transition* begin, const Recorder::transition* end)
+  {
+    Recorder recorder(begin, end);
+    recorder.start();
+
+    const etl::state_chart_traits::event_id_t events[] = {3, 0, 0, 1, 0, 2, 2, 2, 0, 1, 1, 2};
+
+    for (size_t i = 0U; i < (sizeof(events) / sizeof(events[0])); ++i)
+    {
+      recorder.process_event(events[i]);
+      recorder.log += char('0' + recorder.get_state_id());
+    }
+
+    return recorder.log;
+  }
+
   SUITE(test_state_chart_class)
   {
     //*************************************************************************
@@ -595,5 +664,14 @@ namespace
       motorControl.process_event(EventId::ABORT);
       CHECK_EQUAL(StateId::IDLE, int(motorControl.get_state_id()));
     }
+
+    //*************************************************************************
+    TEST(test_indexed_transition_table)
+    {
+      const std::string expected = "0B1F22F2E0D0D0B1C22E0";
+
+      CHECK_EQUAL(expected, RecordEvents(ETL_OR_STD::begin(indexedTable), ETL_OR_STD::end(indexedTable)));
+      CHECK_EQUAL(expected, RecordEvents(ETL_OR_STD::begin(linearTable), ETL_OR_STD::end(linearTable)));
+    }
   }
 } // namespace
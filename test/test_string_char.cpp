@@ -3815,6 +3815,65 @@ namespace
       CHECK_EQUAL(TextL::npos, position2);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_from_npos)
+    {
+      TextL haystack(STR("A haystack with a needle"));
+      Text  needle(STR("needle"));
+      Text  empty;
+
+      // Starting positions past the end must not wrap around.
+      CHECK_EQUAL(TextL::npos, haystack.find(needle, TextL::npos));
+      CHECK_EQUAL(TextL::npos, haystack.find(View(needle), TextL::npos));
+      CHECK_EQUAL(TextL::npos, haystack.find(STR("needle"), TextL::npos));
+      CHECK_EQUAL(TextL::npos, haystack.find(STR("needle"), TextL::npos, 6U));
+      CHECK_EQUAL(TextL::npos, haystack.find(STR("needle"), TextL::npos - 2U, 6U));
+      CHECK_EQUAL(TextL::npos, haystack.find(empty, TextL::npos));
+      CHECK_EQUAL(TextL::npos, haystack.find(empty, haystack.size() + 1U));
+
+      // An empty string is found at the end.
+      CHECK_EQUAL(haystack.size(), haystack.find(empty, haystack.size()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_in_long_text)
+    {
+      // A small alphabet, so that there are many partial matches.
+      TextSTD compare_text(500U, STR(' '));
+
+      uint32_t random = 1U;
+
+      for (size_t i = 0U; i < compare_text.size(); ++i)
+      {
+        random          = (random * 1664525U) + 1013904223U;
+        compare_text[i] = STR("ab c")[(random >> 16U) % 4U];
+      }
+
+      etl::string<500> text(compare_text.c_str());
+
+      for (size_t length = 0U; length < 20U; ++length)
+      {
+        for (size_t start = 0U; (start + length) <= compare_text.size(); start += 31U)
+        {
+          const TextSTD needle = compare_text.substr(start, length);
+
+          for (size_t position = 0U; position <= compare_text.size(); position += 83U)
+          {
+            CHECK_EQUAL(compare_text.find(needle.c_str(), position, needle.size()), text.find(needle.c_str(), position, needle.size()));
+          }
+        }
+      }
+
+      for (size_t position = 0U; position < compare_text.size(); position += 7U)
+      {
+        CHECK_EQUAL(compare_text.find(STR('c'), position), text.find(STR('c'), position));
+        CHECK_EQUAL(compare_text.find_first_of(STR("bc"), position), text.find_first_of(STR("bc"), position));
+        CHECK_EQUAL(compare_text.find_first_not_of(STR("ab "), position), text.find_first_not_of(STR("ab "), position));
+        CHECK_EQUAL(compare_text.find_last_of(STR("bc"), position), text.find_last_of(STR("bc"), position));
+        CHECK_EQUAL(compare_text.find_last_not_of(STR("ab "), position), text.find_last_not_of(STR("ab "), position));
+      }
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_contains_string)
     {
@@ -5126,7 +5185,7 @@ namespace
       Text   text(STR("ABCDEFHIJKL"));
       size_t hash = etl::hash<Text>()(text);
       size_t compare_hash =
-        etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()), reinterpret_cast<const uint8_t*>(text.data_end()));
+        etl::private_hash::buffer_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()), reinterpret_cast<const uint8_t*>(text.data_end()));
       CHECK_EQUAL(compare_hash, hash);
 
       // Test with interface string type.
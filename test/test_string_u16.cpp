@@ -5198,7 +5198,7 @@ namespace
       Text   text(STR("ABCDEFHIJKL"));
       size_t hash = etl::hash<Text>()(text);
       size_t compare_hash =
-        etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()), reinterpret_cast<const uint8_t*>(text.data_end()));
+        etl::private_hash::buffer_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()), reinterpret_cast<const uint8_t*>(text.data_end()));
       CHECK_EQUAL(compare_hash, hash);
 
       // Test with interface string type.
@@ -1099,6 +1099,97 @@ namespace
       CHECK(View::npos == view.find_last_not_of(s6, 10, 8));
     }
 
+
+    //*************************************************************************
+#if ETL_USING_CPP14
+    TEST(test_constexpr_find)
+    {
+      constexpr etl::string_view view("Hello World");
+
+      constexpr size_t find_view              = view.find(etl::string_view("World"));
+      constexpr size_t find_character         = view.find('o', 5U);
+      constexpr size_t find_first_of          = view.find_first_of(etl::string_view("Wr"));
+      constexpr size_t find_first_not_of      = view.find_first_not_of(etl::string_view("Hel"));
+      constexpr size_t find_last_of           = view.find_last_of(etl::string_view("lo"));
+      constexpr size_t find_last_not_of       = view.find_last_not_of(etl::string_view("dlr"));
+
+      CHECK_EQUAL(6U, find_view);
+      CHECK_EQUAL(7U, find_character);
+      CHECK_EQUAL(6U, find_first_of);
+      CHECK_EQUAL(4U, find_first_not_of);
+      CHECK_EQUAL(9U, find_last_of);
+      CHECK_EQUAL(7U, find_last_not_of);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_find_in_long_text)
+    {
+      // A small alphabet, so that there are many partial matches.
+      std::string text(1000U, ' ');
+
+      uint32_t random = 1U;
+
+      for (size_t i = 0U; i < text.size(); ++i)
+      {
+        random  = (random * 1664525U) + 1013904223U;
+        text[i] = "ab c\xFF"[(random >> 16U) % 5U];
+      }
+
+      View view(text.data(), text.size());
+
+      for (size_t length = 1U; length < 24U; ++length)
+      {
+        for (size_t start = 0U; (start + length) <= text.size(); start += 37U)
+        {
+          const std::string needle = text.substr(start, length);
+
+          for (size_t position = 0U; position < text.size(); position += 101U)
+          {
+            CHECK_EQUAL(text.find(needle, position), view.find(View(needle.data(), needle.size()), position));
+          }
+        }
+      }
+
+      CHECK_EQUAL(text.find('\xFF', 10U), view.find('\xFF', 10U));
+      CHECK_EQUAL(std::string::npos, view.find("abababab"));
+      CHECK_EQUAL(std::string::npos, view.find('x'));
+
+      const char* sets[] = {"a", "b\xFF", "abc", "ab c\xFF", "xyz"};
+
+      for (size_t i = 0U; i < (sizeof(sets) / sizeof(sets[0])); ++i)
+      {
+        for (size_t position = 0U; position < text.size(); position += 7U)
+        {
+          CHECK_EQUAL(text.find_first_of(sets[i], position), view.find_first_of(sets[i], position));
+          CHECK_EQUAL(text.find_first_not_of(sets[i], position), view.find_first_not_of(sets[i], position));
+          CHECK_EQUAL(text.find_last_of(sets[i], position), view.find_last_of(sets[i], position));
+          CHECK_EQUAL(text.find_last_not_of(sets[i], position), view.find_last_not_of(sets[i], position));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_find_wide_characters)
+    {
+      const char16_t text[] = {u'a', u'\u0100', u'b', u'\u0161', u'\u0100', u'c', u'\0'};
+
+      U16View view(text);
+
+      CHECK_EQUAL(1U, view.find(u'\u0100'));
+      CHECK_EQUAL(4U, view.find(u'\u0100', 2U));
+      CHECK_EQUAL(3U, view.find(U16View(u"\u0161\u0100")));
+      CHECK_EQUAL(3U, view.find_first_of(U16View(u"\u0161c")));
+      CHECK_EQUAL(1U, view.find_first_not_of(U16View(u"ab")));
+      CHECK_EQUAL(2U, view.find_first_not_of(U16View(u"a\u0100")));
+      CHECK_EQUAL(4U, view.find_last_of(U16View(u"\u0100")));
+      CHECK_EQUAL(3U, view.find_last_not_of(U16View(u"c\u0100")));
+
+      // The low byte of U+0161 is 'a'.
+      CHECK_EQUAL(U16View::npos, view.find_first_of(U16View(u"\u0161"), 4U));
+      CHECK_EQUAL(0U, view.find_first_of(U16View(u"a")));
+      CHECK_EQUAL(U16View::npos, view.find_first_of(U16View(u"a"), 1U));
+    }
     //*************************************************************************
     TEST(test_hash)
     {
@@ -584,6 +584,27 @@ namespace
       CHECK(!etl::to_arithmetic<uint64_t>(uint64_overflow_max.c_str(), uint64_overflow_max.size(), etl::dec));
     }
 
+    //*************************************************************************
+    TEST(test_decimal_numerics_in_blocks_of_eight)
+    {
+      const Text text1(STR("00000000000000000127"));
+      const Text text2(STR("-1234567812345678"));
+      const Text text3(STR("000000000000000000004294967295"));
+      const Text text4(STR("12345678x"));
+      const Text text5(STR("123456781234567812345678"));
+      const Text text6(STR("4294967296"));
+      const Text text7(STR("12345678123456781x"));
+
+      CHECK_EQUAL(127, int(etl::to_arithmetic<int8_t>(text1.c_str(), text1.size()).value()));
+      CHECK_EQUAL(-1234567812345678LL, etl::to_arithmetic<int64_t>(text2.c_str(), text2.size()).value());
+      CHECK_EQUAL(4294967295UL, etl::to_arithmetic<uint32_t>(text3.c_str(), text3.size()).value());
+
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, etl::to_arithmetic<uint32_t>(text4.c_str(), text4.size()).error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, etl::to_arithmetic<uint64_t>(text5.c_str(), text5.size()).error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, etl::to_arithmetic<uint32_t>(text6.c_str(), text6.size()).error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, etl::to_arithmetic<uint64_t>(text7.c_str(), text7.size()).error());
+    }
+
     //*************************************************************************
     TEST(test_invalid_hex_numerics)
     {
@@ -1016,6 +1037,34 @@ namespace
       CHECK_EQUAL(etl::to_arithmetic_status::Overflow, etl::to_arithmetic<long double>(text.c_str(), text.size()).error());
     }
 
+    //*************************************************************************
+    TEST(test_floating_point_is_correctly_rounded)
+    {
+      // Exact bit patterns, as strtod gives.
+      CHECK_EQUAL(0.1, etl::to_arithmetic<double>(STR("0.1")).value());
+      CHECK_EQUAL(0.3, etl::to_arithmetic<double>(STR("0.30000000000000000000000001")).value());
+      CHECK_EQUAL(0.30000000000000004, etl::to_arithmetic<double>(STR("0.30000000000000004")).value());
+      CHECK_EQUAL(1.7976931348623157e308, etl::to_arithmetic<double>(STR("1.7976931348623157e308")).value());
+      CHECK_EQUAL(2.2250738585072014e-308, etl::to_arithmetic<double>(STR("2.2250738585072014e-308")).value());
+      CHECK_EQUAL(4.9406564584124654e-324, etl::to_arithmetic<double>(STR("4.9406564584124654e-324")).value());
+      CHECK_EQUAL(1e-300, etl::to_arithmetic<double>(STR("1e-300")).value());
+      CHECK_EQUAL(0.0, etl::to_arithmetic<double>(STR("1e-400")).value());
+      CHECK_EQUAL(0.0, etl::to_arithmetic<double>(STR("1e-99999999999")).value());
+
+      // Half way between two doubles rounds to even, unless later digits say otherwise.
+      CHECK_EQUAL(9007199254740992.0, etl::to_arithmetic<double>(STR("9007199254740993")).value());
+      CHECK_EQUAL(9007199254740994.0, etl::to_arithmetic<double>(STR("9007199254740993.0000000000000000000001")).value());
+      CHECK_EQUAL(9007199254740992.0, etl::to_arithmetic<double>(STR("9007199254740992.9999999999999999999999")).value());
+
+      CHECK_EQUAL(0.1f, etl::to_arithmetic<float>(STR("0.1")).value());
+      CHECK_EQUAL(3.4028235e38f, etl::to_arithmetic<float>(STR("3.4028235e38")).value());
+      CHECK_EQUAL(1.0f, etl::to_arithmetic<float>(STR("1.00000005960464477539")).value());
+      CHECK_EQUAL(1.00000012f, etl::to_arithmetic<float>(STR("1.00000005960464477540")).value());
+
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, etl::to_arithmetic<float>(STR("3.5e38")).error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, etl::to_arithmetic<double>(STR("1e99999999999")).error());
+    }
+
     //*************************************************************************
     TEST(test_all_api_variants)
     {
@@ -266,6 +266,43 @@ namespace
       CHECK(etl::string<17>(STR("1e240")) == etl::to_string(123456, str, Format().hex()));
     }
 
+    //*************************************************************************
+    TEST(test_digit_count_boundaries)
+    {
+      etl::string<24> str;
+
+      uint64_t power = 1U;
+
+      for (int digits = 1; digits < 20; ++digits)
+      {
+        std::ostringstream expected_below;
+        std::ostringstream expected_power;
+        expected_below << (power - 1U);
+        expected_power << power;
+
+        CHECK_EQUAL(expected_below.str(), std::string(etl::to_string(power - 1U, str).c_str()));
+        CHECK_EQUAL(expected_power.str(), std::string(etl::to_string(power, str).c_str()));
+
+        power *= 10U;
+      }
+
+      CHECK(etl::string<24>(STR("18446744073709551615")) == etl::to_string(UINT64_MAX, str));
+      CHECK(etl::string<24>(STR("0XFFFFFFFFFFFFFFFF")) == etl::to_string(UINT64_MAX, str, Format().hex().upper_case(true).show_base(true)));
+      CHECK(etl::string<24>(STR("0x100000000")) == etl::to_string(uint64_t(0x100000000ull), str, Format().hex().show_base(true)));
+      CHECK(etl::string<24>(STR("0")) == etl::to_string(0, str, Format().hex().show_base(true)));
+    }
+
+    //*************************************************************************
+    TEST(test_truncated_integer_keeps_leading_digits)
+    {
+      etl::string<4> str;
+
+      etl::to_string(123456, str);
+
+      CHECK(etl::string<4>(STR("1234")) == str);
+      CHECK(str.is_truncated());
+    }
+
     //*************************************************************************
     TEST(test_floating_point_no_append)
     {
@@ -301,6 +338,35 @@ namespace
       CHECK(etl::string<20>(STR("-2.000000 ")) == etl::to_string(-1.9999996, str, Format().precision(6).width(10).left()));
     }
 
+    //*************************************************************************
+    TEST(test_floating_point_exact_rounding)
+    {
+      etl::string<32> str;
+
+      CHECK(etl::string<32>(STR("0.10000000000000001")) == etl::to_string(0.1, str, Format().precision(17)));
+      CHECK(etl::string<32>(STR("0.10000000")) == etl::to_string(0.1f, str, Format().precision(8)));
+      CHECK(etl::string<32>(STR("2.67")) == etl::to_string(2.675, str, Format().precision(2)));
+      CHECK(etl::string<32>(STR("2.68")) == etl::to_string(2.6750001, str, Format().precision(2)));
+      CHECK(etl::string<32>(STR("0.12")) == etl::to_string(0.125, str, Format().precision(2)));
+      CHECK(etl::string<32>(STR("0.38")) == etl::to_string(0.375, str, Format().precision(2)));
+      CHECK(etl::string<32>(STR("2")) == etl::to_string(2.5, str, Format().precision(0)));
+      CHECK(etl::string<32>(STR("4294967296.5")) == etl::to_string(4294967296.5, str, Format().precision(1)));
+      CHECK(etl::string<32>(STR("10000000000000000000000")) == etl::to_string(1e22, str, Format().precision(0)));
+      CHECK(etl::string<32>(STR("0.0000000001")) == etl::to_string(1e-10, str, Format().precision(10)));
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_exact_digits_beyond_64_bits)
+    {
+      etl::string<32> str;
+
+      CHECK(etl::string<32>(STR("864569230984345.250000")) == etl::to_string(864569230984345.25, str, Format().precision(6)));
+      CHECK(etl::string<32>(STR("0.10000000000000000555")) == etl::to_string(0.1, str, Format().precision(20)));
+      CHECK(etl::string<32>(STR("99999999999999991611392")) == etl::to_string(1e23, str, Format().precision(0)));
+      CHECK(etl::string<32>(STR("0.0000000000000000000000")) == etl::to_string(1e-23, str, Format().precision(22)));
+      CHECK(etl::string<32>(STR("0.00000000000000000000001")) == etl::to_string(1e-23, str, Format().precision(23)));
+    }
+
     //*************************************************************************
     TEST(test_floating_point_append)
     {
@@ -1097,5 +1097,45 @@ namespace
       CHECK_TRUE(data.contains("FF"));
       CHECK_FALSE(data.contains(not_inserted));
     }
+
+    //*************************************************************************
+    TEST(test_bucket_index_with_power_of_2_buckets)
+    {
+      typedef etl::unordered_multiset<uint32_t, 16, 16> Pow2;
+      typedef etl::unordered_multiset<uint32_t, 16, 10> NotPow2;
+
+      Pow2    pow2;
+      NotPow2 not_pow2;
+
+      for (uint32_t key = 0U; key < 100U; ++key)
+      {
+        CHECK_EQUAL(size_t(key % 16U), pow2.get_bucket_index(key));
+        CHECK_EQUAL(size_t(key % 10U), not_pow2.get_bucket_index(key));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_finalised_hash_selects_bucket)
+    {
+      typedef etl::finalised_hash<etl::hash<uint32_t>, etl::murmur3_hash_finaliser> Hash;
+      typedef etl::unordered_multiset<uint32_t, 16, 16, Hash> Data;
+
+      Data data;
+
+      for (uint32_t i = 0U; i < 16U; ++i)
+      {
+        data.insert(i * 16U);
+      }
+
+      // Each key is in the bucket that the finalised hash selects.
+      for (uint32_t i = 0U; i < 16U; ++i)
+      {
+        const size_t bucket = data.get_bucket_index(i * 16U);
+
+        CHECK_EQUAL(Hash()(i * 16U) & 15U, bucket);
+        CHECK(data.begin(bucket) != data.end(bucket));
+        CHECK_EQUAL(1U, data.count(i * 16U));
+      }
+    }
   }
 } // namespace
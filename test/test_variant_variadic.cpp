@@ -1924,6 +1924,80 @@ namespace
       CHECK_EQUAL(3 * 2, res);
     }
 
+    //*************************************************************************
+    template <size_t N>
+    struct visit_tag
+    {
+      static constexpr int value = int(N);
+    };
+
+    template <size_t... I>
+    etl::variant<visit_tag<I>...> make_visit_tags(etl::index_sequence<I...>);
+
+    struct test_variant_visit_tag_helper
+    {
+      template <typename T1, typename T2, typename T3>
+      int operator()(const T1&, const T2&, const T3&) const
+      {
+        return (T1::value * 100) + (T2::value * 10) + T3::value;
+      }
+
+      template <typename T>
+      int operator()(const T&) const
+      {
+        return T::value;
+      }
+    };
+
+    TEST(test_variant_multiple_visit_all_combinations)
+    {
+      using variant1_t = decltype(make_visit_tags(etl::make_index_sequence<2>{}));
+      using variant2_t = decltype(make_visit_tags(etl::make_index_sequence<3>{}));
+      using variant3_t = decltype(make_visit_tags(etl::make_index_sequence<4>{}));
+
+      const variant1_t variants1[] = {visit_tag<0>{}, visit_tag<1>{}};
+      const variant2_t variants2[] = {visit_tag<0>{}, visit_tag<1>{}, visit_tag<2>{}};
+      const variant3_t variants3[] = {visit_tag<0>{}, visit_tag<1>{}, visit_tag<2>{}, visit_tag<3>{}};
+
+      for (int i = 0; i < 2; ++i)
+      {
+        for (int j = 0; j < 3; ++j)
+        {
+          for (int k = 0; k < 4; ++k)
+          {
+            CHECK_EQUAL((i * 100) + (j * 10) + k, etl::visit(test_variant_visit_tag_helper{}, variants1[i], variants2[j], variants3[k]));
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_variant_visit_and_accept_many_types)
+    {
+      using variant_t = decltype(make_visit_tags(etl::make_index_sequence<40>{}));
+
+      variant_t variant = visit_tag<37>{};
+
+      CHECK_EQUAL(37, etl::visit(test_variant_visit_tag_helper{}, variant));
+
+      int  value = -1;
+      auto f     = [&value](const auto& tag)
+      {
+        value = etl::remove_cvref_t<decltype(tag)>::value;
+      };
+
+      variant.accept(f);
+      CHECK_EQUAL(37, value);
+
+      variant = visit_tag<39>{};
+      variant.accept(f);
+      CHECK_EQUAL(39, value);
+
+      variant = visit_tag<0>{};
+      variant.accept(f);
+      CHECK_EQUAL(0, value);
+    }
+
     //*************************************************************************
     TEST(test_variant_visit_void)
     {
@@ -0,0 +1,173 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <stdint.h>
+#include <string.h>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "etl/wyhash.h"
+
+#if ETL_USING_64BIT_TYPES
+
+namespace
+{
+  struct test_vector
+  {
+    const char* text;
+    uint64_t    seed;
+    uint64_t    hash;
+  };
+
+  // Reference values from the wyhash test vectors.
+  const test_vector test_vectors[] = {
+    {"", 0U, 0x93228A4DE0EEC5A2ULL},
+    {"a", 1U, 0xC5BAC3DB178713C4ULL},
+    {"abc", 2U, 0xA97F2F7B1D9B3314ULL},
+    {"message digest", 3U, 0x786D1F1DF3801DF4ULL},
+    {"abcdefghijklmnopqrstuvwxyz", 4U, 0xDCA5A8138AD37C87ULL},
+    {"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789", 5U, 0xB9E734F117CFAF70ULL},
+    {"12345678901234567890123456789012345678901234567890123456789012345678901234567890", 6U, 0x6CC5EAB49A92D617ULL}};
+
+  SUITE(test_wyhash)
+  {
+    //*************************************************************************
+    TEST(test_wyhash_reference_values)
+    {
+      for (size_t i = 0UL; i < (sizeof(test_vectors) / sizeof(test_vectors[0])); ++i)
+      {
+        const test_vector& tv = test_vectors[i];
+
+        CHECK_EQUAL(tv.hash, etl::wyhash(tv.text, strlen(tv.text), tv.seed).value());
+        CHECK_EQUAL(tv.hash, uint64_t(etl::wyhash(tv.text, tv.text + strlen(tv.text), tv.seed)));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_alignment_independent)
+    {
+      const std::string text("The quick brown fox jumps over the lazy dog, again and again and again");
+
+      const uint64_t compare = etl::wyhash(text.data(), text.size());
+
+      for (size_t offset = 0UL; offset < 8UL; ++offset)
+      {
+        std::vector<char> buffer(text.size() + offset);
+        memcpy(&buffer[offset], text.data(), text.size());
+
+        const char* begin = &buffer[offset];
+
+        CHECK_EQUAL(compare, etl::wyhash(begin, begin + text.size()).value());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_lengths_are_distinct)
+    {
+      // Covers the 1-3, 4-16, 17-48 and 48+ byte paths.
+      std::vector<uint8_t> data(200U, 0x5AU);
+      std::set<uint64_t>   hashes;
+
+      for (size_t length = 0UL; length <= data.size(); ++length)
+      {
+        hashes.insert(etl::wyhash(data.data(), data.data() + length).value());
+      }
+
+      CHECK_EQUAL(data.size() + 1U, hashes.size());
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_every_bit_affects_the_hash)
+    {
+      const size_t lengths[] = {1U, 3U, 4U, 8U, 15U, 16U, 17U, 47U, 48U, 49U, 100U};
+
+      for (size_t l = 0UL; l < (sizeof(lengths) / sizeof(lengths[0])); ++l)
+      {
+        std::vector<uint8_t> data(lengths[l]);
+
+        for (size_t i = 0UL; i < data.size(); ++i)
+        {
+          data[i] = static_cast<uint8_t>(i * 13U);
+        }
+
+        const uint64_t compare = etl::wyhash(data.data(), data.data() + data.size());
+
+        for (size_t bit = 0UL; bit < (data.size() * 8U); ++bit)
+        {
+          data[bit / 8U] ^= static_cast<uint8_t>(1U << (bit % 8U));
+          CHECK(compare != etl::wyhash(data.data(), data.data() + data.size()).value());
+          data[bit / 8U] ^= static_cast<uint8_t>(1U << (bit % 8U));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_seed)
+    {
+      const std::string text("seeded");
+
+      CHECK(etl::wyhash(text.data(), text.size(), 0U).value() != etl::wyhash(text.data(), text.size(), 1U).value());
+      CHECK_EQUAL(etl::wyhash(text.data(), text.size(), 1234U).value(), etl::wyhash(text.data(), text.size(), 1234U).value());
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_portable_multiply)
+    {
+      const uint64_t values[] = {0U, 1U, 0xFFFFFFFFULL, 0x100000000ULL, 0x8BB84B93962EACC9ULL, 0xFFFFFFFFFFFFFFFFULL, 0x123456789ABCDEF0ULL};
+
+      for (size_t i = 0UL; i < (sizeof(values) / sizeof(values[0])); ++i)
+      {
+        for (size_t j = 0UL; j < (sizeof(values) / sizeof(values[0])); ++j)
+        {
+          uint64_t a1 = values[i];
+          uint64_t b1 = values[j];
+          uint64_t a2 = values[i];
+          uint64_t b2 = values[j];
+
+          etl::private_wyhash::multiply_128(a1, b1);
+          etl::private_wyhash::multiply_128_portable(a2, b2);
+
+          CHECK_EQUAL(a1, a2);
+          CHECK_EQUAL(b1, b2);
+        }
+      }
+
+      // 0xFFFFFFFFFFFFFFFF squared == 0xFFFFFFFFFFFFFFFE0000000000000001
+      uint64_t a = 0xFFFFFFFFFFFFFFFFULL;
+      uint64_t b = 0xFFFFFFFFFFFFFFFFULL;
+      etl::private_wyhash::multiply_128_portable(a, b);
+      CHECK_EQUAL(0x0000000000000001ULL, a);
+      CHECK_EQUAL(0xFFFFFFFFFFFFFFFEULL, b);
+    }
+  }
+} // namespace
+
+#endif